@@ -0,0 +1,146 @@
+#ifndef ARRAYS_ARRAY_KERNELS_H
+#define ARRAYS_ARRAY_KERNELS_H
+
+#include "array.h"
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @file array_kernels.h
+ * @brief Defines vectorised scans over arrays of numbers.
+ */
+
+/**
+ * @defgroup ARRAY_KERNELS Array Kernels API
+ * @ingroup ARRAYS
+ * @brief Search and reduction kernels over @ref struct array views of integers and floats.
+ *
+ * @details
+ * Every kernel has SSE2, AVX2 and AVX-512 implementations on x86 and a scalar fallback
+ * everywhere. The widest instruction set the CPU supports is selected on first use.
+ * Dynarrays are viewed by casting, `(struct array *) &dynarray`.
+ * ### Global Constraints
+ * - **NULL Pointers**: All `struct array *arr` and value pointers must be non-NULL.
+ * - **Object Type**: obj_size of @p arr must match @p type, checked by assert.
+ * - **Floating Point**: NaNs never compare equal, their place in min/max is unspecified.
+ * - Sums of floats are accumulated in lanes, so rounding differs from a sequential loop.
+ * @{
+ */
+
+/**
+ * @enum array_type
+ * @brief Element types kernels work on, named after the stdint/float types.
+ */
+enum array_type {
+    ARRAY_I8,
+    ARRAY_U8,
+    ARRAY_I16,
+    ARRAY_U16,
+    ARRAY_I32,
+    ARRAY_U32,
+    ARRAY_I64,
+    ARRAY_U64,
+    ARRAY_F32,
+    ARRAY_F64,
+    ARRAY_TYPE_COUNT,
+};
+
+/** @return Size in bytes of an element of @p type. */
+static inline size_t array_type_size(enum array_type type)
+{
+    static const unsigned char sizes[ARRAY_TYPE_COUNT] = { 1, 1, 2, 2, 4, 4, 8, 8, 4, 8 };
+    assert(type < ARRAY_TYPE_COUNT);
+    return sizes[type];
+}
+
+/**
+ * @enum array_isa
+ * @brief Instruction sets kernels are implemented with.
+ */
+enum array_isa {
+    ARRAY_ISA_SCALAR,
+    ARRAY_ISA_SSE2,
+    ARRAY_ISA_AVX2,
+    ARRAY_ISA_AVX512,
+};
+
+/**
+ * @name Search
+ * Functions to find values, all of them **O(N)**.
+ * @{
+ */
+
+/**
+ * @brief Finds the first element equal to @p value.
+ * @param[in] value Pointer to a value of @p type.
+ * @return Index of the element, array_size(arr) if there is none.
+ */
+size_t array_find(const struct array *arr, enum array_type type, const void *value);
+
+/**
+ * @brief Counts elements equal to @p value.
+ * @param[in] value Pointer to a value of @p type.
+ */
+size_t array_count(const struct array *arr, enum array_type type, const void *value);
+
+/** @} */ // End of Search
+
+/**
+ * @name Reduction
+ * Functions to fold arrays, all of them **O(N)**.
+ * @{
+ */
+
+/**
+ * @brief Writes the smallest element into @p result.
+ * @param[out] result Pointer to a value of @p type.
+ * @return 0 on success, non-zero if the array is empty.
+ */
+int array_min(const struct array *arr, enum array_type type, void *result);
+
+/**
+ * @brief Writes the largest element into @p result.
+ * @see array_min
+ */
+int array_max(const struct array *arr, enum array_type type, void *result);
+
+/**
+ * @brief Sums the elements.
+ * @param[out] result int64_t for signed, uint64_t for unsigned integers, double for floats.
+ * Integer sums wrap around on overflow.
+ */
+void array_sum(const struct array *arr, enum array_type type, void *result);
+
+/** @} */ // End of Reduction
+
+/**
+ * @name Dispatch
+ * Functions to query and override the selected instruction set.
+ * @{
+ */
+
+/** @return Instruction set kernels currently run with. */
+enum array_isa array_kernels_isa(void);
+
+/**
+ * @brief Forces kernels to use @p isa, mainly for testing and benchmarking.
+ * @return 0 on success, non-zero if the CPU or the build does not support @p isa.
+ * @note Not thread safe against concurrent kernel calls.
+ */
+int array_kernels_set_isa(enum array_isa isa);
+
+/** @return Name of @p isa, e.g. "avx2". */
+const char *array_isa_name(enum array_isa isa);
+
+/** @} */ // End of Dispatch
+
+/** @} */ // End of ARRAY_KERNELS group
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // ARRAYS_ARRAY_KERNELS_H
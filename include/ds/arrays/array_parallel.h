@@ -0,0 +1,70 @@
+#ifndef ARRAYS_ARRAY_PARALLEL_H
+#define ARRAYS_ARRAY_PARALLEL_H
+
+#include <ds/utils/thread_pool.h>
+#include "array.h"
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @file array_parallel.h
+ * @brief Defines multi-threaded algorithms over arrays.
+ */
+
+/**
+ * @defgroup ARRAY_PARALLEL Array Parallel API
+ * @ingroup ARRAYS
+ * @brief Loops, reductions and sorting of @ref struct array views on a @ref THREAD_POOL.
+ *
+ * @details
+ * Arrays are split into contiguous ranges handed to the pool as tasks, the calling
+ * thread takes part until every range is done. Dynarrays are viewed by casting,
+ * `(struct array *) &dynarray`.
+ * ### Global Constraints
+ * - **NULL Pointers**: All `struct array *arr` and callbacks must be non-NULL. A NULL
+ * - pool runs everything on the calling thread.
+ * - **Grain**: Count of objects per range, 0 splits the array into a few ranges per thread.
+ * @{
+ */
+
+/**
+ * @brief Calls @p body on consecutive ranges of @p arr, concurrently.
+ * @param[in] body Called with a view of the range, index of its first object in @p arr
+ * and @p context. Ranges never overlap.
+ */
+void array_parallel_for(struct thread_pool *pool, struct array *arr, size_t grain, void *context,
+                        void (*body) (struct array *range, size_t first, void *context));
+
+/**
+ * @brief Folds @p arr into @p result, concurrently.
+ * @param[in, out] result On entry the identity of @p combine (e.g. 0 for sums), the reduction on return.
+ * @param[in] result_size Size of @p result in bytes.
+ * @param[in] map Folds a range into @p partial, which starts as a copy of the identity.
+ * @param[in] combine Folds @p partial into @p result. Called on the calling thread, in order of ranges.
+ * @return 0 on success, non-zero if partial results could not be allocated.
+ */
+int array_parallel_reduce(struct thread_pool *pool, const struct array *arr, size_t grain,
+                          void *result, size_t result_size, void *context,
+                          void (*map) (const struct array *range, void *partial, void *context),
+                          void (*combine) (void *result, const void *partial, void *context));
+
+/**
+ * @brief Sorts @p arr in ascending order of @p cmp, concurrently.
+ * @details Ranges are sorted by @ref array_sort, then merged pairwise. Every merge is split
+ * at binary searched positions into independent pieces, so all threads work in every round.
+ * @return 0 on success, non-zero if the scratch copy could not be allocated, @p arr is
+ * then left untouched.
+ * @note Not stable, objects are moved bitwise.
+ */
+int array_parallel_sort(struct thread_pool *pool, struct array *arr, int (*cmp) (const void *a, const void *b));
+
+/** @} */ // End of ARRAY_PARALLEL group
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // ARRAYS_ARRAY_PARALLEL_H
@@ -0,0 +1,64 @@
+#ifndef ARRAYS_ARRAY_SORT_H
+#define ARRAYS_ARRAY_SORT_H
+
+#include "array.h"
+#include "array_kernels.h"
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @file array_sort.h
+ * @brief Defines sorting algorithms over arrays.
+ */
+
+/**
+ * @defgroup ARRAY_SORT Array Sort API
+ * @ingroup ARRAYS
+ * @brief In place sorting of @ref struct array views.
+ *
+ * @details
+ * Two algorithms are provided:
+ * - @ref array_sort, a pattern-defeating quicksort taking a comparator, **O(N log N)** worst case.
+ * - @ref array_radix_sort, a radix sort on a fixed-width number embedded in each object, **O(N)**.
+ * Dynarrays are sorted by casting, `(struct array *) &dynarray`.
+ * ### Global Constraints
+ * - **NULL Pointers**: All `struct array *arr` and comparators must be non-NULL.
+ * - **Object Type**: Objects are moved bitwise, store pointers to objects which cannot be relocated.
+ * @{
+ */
+
+/**
+ * @brief Sorts @p arr in ascending order of @p cmp, not stable.
+ * @param[in] cmp Returns negative, zero or positive if @p a is less, equal or greater than @p b.
+ * @details Pattern-defeating quicksort: insertion sort for small ranges, ninther pivots,
+ * linear time on sorted, reversed and all-equal inputs, heapsort once partitions degrade.
+ */
+void array_sort(struct array *arr, int (*cmp) (const void *a, const void *b));
+
+/**
+ * @brief Sorts @p arr in ascending order of the key stored inside each object.
+ * @param[in] key_offset Byte offset of the key inside an object, key does not need to be aligned.
+ * @param[in] key_type Type of the key, see @ref array_type.
+ * @param[in] stable Non-zero for an LSD radix sort keeping equal keys in their order, which
+ * allocates a scratch copy of @p arr. Zero for an in place MSD radix sort, which allocates nothing.
+ * @return 0 on success, non-zero if the scratch copy could not be allocated.
+ * @note Negative zero sorts before zero, NaNs sort to the ends by their sign.
+ */
+int array_radix_sort(struct array *arr, size_t key_offset, enum array_type key_type, int stable);
+
+/**
+ * @brief Checks whether @p arr is sorted in ascending order of @p cmp.
+ * @return 1 if sorted, 0 otherwise.
+ */
+int array_is_sorted(const struct array *arr, int (*cmp) (const void *a, const void *b));
+
+/** @} */ // End of ARRAY_SORT group
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // ARRAYS_ARRAY_SORT_H
@@ -3,6 +3,8 @@
 
 #include <ds/utils/debug.h>
 #include <ds/utils/object_concept.h>
+#include <ds/utils/allocator_concept.h>
+#include <ds/utils/stats.h>
 #include "array.h"
 #include <stddef.h>
 
@@ -23,12 +25,34 @@ extern "C" {
  * @details
  * ### Global Constraints
  * - **NULL Pointers**: All `struct dynarray *arr` must be non-NULL nor invalid. .init method of `struct object_concept`
- * - must be given strictly valid, .deinit method might be NULL if you store PODs.
+ * - might be NULL for trivially copyable types, objects are then copied bitwise and bulk insert, resize
+ * - and push back become memcpy/memmove. .deinit method might be NULL if you store PODs, deinit loops are skipped.
+ * - .move method relocates objects while shifting and growing, NULL relocates them bitwise. Objects with
+ * - a relocator are never grown in place by the allocator.
  * - **Ownership**: Internal slots are owned by the dynarray and managed thru object_concept given by user
  * - to init and deinit objects in place.
+ * - **Growth**: Capacity doubles by default, see @ref dynarray_set_growth for other policies.
  * @{
  */
 
+/**
+ * @brief Growth policy, computes the next capacity.
+ * @param capacity Current capacity.
+ * @param required Capacity needed by the operation, greater than @p capacity.
+ * @param obj_size Size of the stored objects.
+ * @param param Policy parameter given to @ref dynarray_set_growth.
+ * @return New capacity, must be at least @p required.
+ */
+typedef size_t (*dynarray_growth_cb) (size_t capacity, size_t required, size_t obj_size, size_t param);
+
+/**
+ * @struct dynarray_stats
+ * @brief Event counters of a dynarray, maintained only if DS_STATS is defined.
+ */
+struct dynarray_stats {
+  size_t                  reallocs;     ///< Count of successful buffer reallocations.
+};
+
 /**
  * @struct dynarray
  * @note Aggregate of the @ref struct array.
@@ -38,6 +62,10 @@ struct dynarray {
   struct array            base;         ///< Enables us to use array viewers implementation.
   size_t                  capacity;     ///< Temporary capacity of the internal buffer.
   struct object_concept   oc;           ///< For initing and deiniting objects in the buffer.
+  struct sized_allocator_concept sac;   ///< Allocates the internal buffer.
+  dynarray_growth_cb      growth;       ///< Computes capacities when the buffer is full.
+  size_t                  growth_param; ///< Parameter passed into growth.
+  DS_STATS_FIELD(struct dynarray_stats, stats) ///< Event counters, only if DS_STATS is defined.
 };
 
 /**
@@ -57,6 +85,16 @@ struct dynarray {
   */
 int dynarray_init(struct dynarray *arr, size_t capacity, size_t obj_size, struct object_concept oc);
 
+/**
+ * @brief Initializes dynarray whose buffer is managed by @p sac.
+ * @param[in] sac Pointer to sized_allocator_concept, copied into the dynarray.
+ * NULL for the global heap, which is what @ref dynarray_init uses.
+ * @return 0 in case of success, non-zero otherwise
+ * @see dynarray_init
+ */
+int dynarray_init_with(struct dynarray *arr, size_t capacity, size_t obj_size, struct object_concept oc,
+                       const struct sized_allocator_concept *sac);
+
 /**
  * @brief Deinitializes the dynarray.
  * @param[in, out] arr Pointer to the dynarray instance.
@@ -67,8 +105,89 @@ int dynarray_init(struct dynarray *arr, size_t capacity, size_t obj_size, struct
  */
 void dynarray_deinit(struct dynarray *arr);
 
+/**
+ * @struct dynarray_inline_storage
+ * @brief Inline buffer of a small-buffer-optimised dynarray, see @ref DYNARRAY_SBO.
+ * @note Acts as the sized allocator of the dynarray: the inline buffer is handed out
+ * while it fits, the global heap is used once the dynarray outgrows it.
+ */
+struct dynarray_inline_storage {
+  void                    *buffer;      ///< Inline buffer.
+  size_t                  size;         ///< Size of the inline buffer in bytes.
+  int                     in_use;       ///< Whether the dynarray currently uses the inline buffer.
+};
+
+/**
+ * @brief Declares a dynarray type keeping its first @p N objects of type @p T inside itself.
+ * @details Usage: `DYNARRAY_SBO(int, 8) scratch; dynarray_sbo_init(&scratch, oc);` then
+ * `&scratch.arr` works with every dynarray function, @ref dynarray_deinit included.
+ * @warning Instances must not be copied or moved while they are in use, the dynarray points
+ * into them.
+ */
+#define DYNARRAY_SBO(T, N)                                                                    \
+  struct {                                                                                    \
+    struct dynarray                 arr;                                                      \
+    struct dynarray_inline_storage  sbo;                                                      \
+    T                               storage[N];                                               \
+  }
+
+/** @brief Initializes a @ref DYNARRAY_SBO instance pointed by @p s, see @ref dynarray_init_inline. */
+#define dynarray_sbo_init(s, oc)                                                              \
+  dynarray_init_inline(&(s)->arr, &(s)->sbo, (s)->storage,                                    \
+                       sizeof((s)->storage) / sizeof((s)->storage[0]), sizeof((s)->storage[0]), (oc))
+
+/**
+ * @brief Initializes dynarray whose first @p capacity objects live in @p buffer.
+ * @param[out] st Inline storage state, must outlive the dynarray.
+ * @param[in] buffer Buffer of at least @p capacity * @p obj_size bytes, aligned for the objects.
+ * @return 0 in case of success, non-zero otherwise
+ * @note No allocation happens until the dynarray outgrows @p buffer. Shrinking back
+ * into it (@ref dynarray_shrink_to_fit) returns to the inline buffer.
+ * @see DYNARRAY_SBO
+ */
+int dynarray_init_inline(struct dynarray *arr, struct dynarray_inline_storage *st, void *buffer,
+                         size_t capacity, size_t obj_size, struct object_concept oc);
+
+/** @return 1 if @p arr stores its objects in the inline buffer of @p st, 0 otherwise. */
+static inline int dynarray_is_inline(const struct dynarray *arr, const struct dynarray_inline_storage *st)
+{
+  return arr->base.buffer == st->buffer;
+}
+
 /** @} */ // End of Initialization & Deinitalization
 
+/**
+ * @name Growth Policies
+ * Built-in @ref dynarray_growth_cb implementations.
+ * @{
+ */
+
+/** @brief Doubles the capacity, the default. @p param is unused. */
+size_t dynarray_growth_double(size_t capacity, size_t required, size_t obj_size, size_t param);
+
+/** @brief Grows the capacity by half, lower peak memory and allows reusing freed blocks. @p param is unused. */
+size_t dynarray_growth_golden(size_t capacity, size_t required, size_t obj_size, size_t param);
+
+/**
+ * @brief Grows by half, then rounds the buffer up to the size class of the allocator so
+ * no slack bytes are wasted. Classes are powers of two up to @p param bytes, multiples of
+ * @p param above, 0 means 4096 (pages of @ref MMAP_ALLOCATOR, slabs of @ref SLAB_POOL).
+ */
+size_t dynarray_growth_size_class(size_t capacity, size_t required, size_t obj_size, size_t param);
+
+/** @brief Grows by fixed chunks of @p param objects, for memory-constrained nodes. 0 means 1. */
+size_t dynarray_growth_chunk(size_t capacity, size_t required, size_t obj_size, size_t param);
+
+/**
+ * @brief Sets the policy used when insertion needs more capacity.
+ * @param[in] growth One of the built-in policies or a custom one, must be non-NULL.
+ * @param[in] param Passed into @p growth as is.
+ * @note @ref dynarray_reserve still allocates exactly what is asked.
+ */
+void dynarray_set_growth(struct dynarray *arr, dynarray_growth_cb growth, size_t param);
+
+/** @} */ // End of Growth Policies
+
 /**
  * @name Insertion & Removal
  * Functions for insertion and removal.
@@ -99,6 +218,23 @@ int dynarray_insert(struct dynarray *arr, size_t index, void *begin, void *end);
  */
 int dynarray_push_back(struct dynarray *arr, void *new_data);
 
+/**
+ * @brief Appends an uninitialized slot to construct an object in place.
+ * @return Pointer to the slot, NULL if growing fails.
+ * @warning The slot already counts as an element, construct it before any other call
+ * on the dynarray, otherwise deinit or move might see garbage.
+ * @note Returned pointer is invalidated by the next growth, like any iterator.
+ */
+void *dynarray_emplace_back(struct dynarray *arr);
+
+/**
+ * @brief Opens an uninitialized slot at @p index to construct an object in place.
+ * @return Pointer to the slot, NULL if growing fails.
+ * @warning Same constraints with @ref dynarray_emplace_back, index check is done by assert.
+ * @note Objects after @p index are relocated thru .move of the object_concept.
+ */
+void *dynarray_emplace_at(struct dynarray *arr, size_t index);
+
 /**
  * @brief Replaces the element at @p index with @p value.
  * @return 0 on success, non-zero if index is out of bounds.
@@ -125,6 +261,14 @@ void dynarray_delete(struct dynarray *arr, size_t begin, size_t end);
  */
 void dynarray_pop_back(struct dynarray *arr);
 
+/**
+ * @brief Relocates the last object into @p dest and removes it without deinitializing.
+ * @param[out] dest Uninitialized memory block big enough to hold the object.
+ * @return 0 on success, non-zero if the dynarray is empty.
+ * @note Uses .move of the object_concept, so owned resources are transferred, not copied.
+ */
+int dynarray_extract_back(struct dynarray *arr, void *dest);
+
 /** @} */ // End of Insertion & Removal
 
 /**
@@ -0,0 +1,190 @@
+#ifndef ARRAYS_FLAT_MAP_H
+#define ARRAYS_FLAT_MAP_H
+
+#include "dynarray.h"
+#include "array.h"
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @file flat_map.h
+ * @brief Defines the interface for sorted flat map.
+ */
+
+/**
+ * @defgroup FLAT_MAP Flat Map API
+ * @ingroup ARRAYS
+ * @brief Ordered map kept as a sorted dynarray of entries, for read-heavy tables.
+ *
+ * @details
+ * Entries are stored contiguously in key order, lookups are binary searches whose
+ * comparisons pick the next half thru conditional moves instead of branches. Very large
+ * tables can additionally keep an Eytzinger (breadth first) copy of their keys, see
+ * @ref flat_map_set_layout, whose searches touch one cache line per few levels and
+ * prefetch the lines of the levels below. Inserting and erasing are **O(N)**, build
+ * tables in bulk with @ref flat_map_build.
+ * ### Global Constraints
+ * - **NULL Pointers**: All `struct flat_map *fm` and keys must be non-NULL nor invalid.
+ * - **Entry Layout**: Every entry starts with its key, so a key and an entry can be passed
+ * - to the same comparator. A flat set is a flat map whose entries are only keys.
+ * - **Object Type**: Entries are copied bitwise, they must be trivially copyable.
+ * - **Pointer Validity**: Pointers to entries are invalidated by insertion, erasure and build.
+ * @{
+ */
+
+/**
+ * @enum flat_map_layout
+ * @brief How lookups search the keys.
+ */
+enum flat_map_layout {
+    FLAT_MAP_SORTED,        ///< Branchless binary search over the entries.
+    FLAT_MAP_EYTZINGER,     ///< Search over an Eytzinger copy of the keys, costs key_size + sizeof(size_t) per entry.
+};
+
+/**
+ * @struct flat_map
+ */
+struct flat_map {
+    struct dynarray         entries;        ///< Entries sorted by key, no duplicate keys.
+    size_t                  key_size;       ///< Size of the key at the start of each entry.
+    int                     (*cmp) (const void *a, const void *b); ///< Compares two keys.
+    enum flat_map_layout    layout;         ///< Layout lookups use.
+    char                    *index;         ///< Eytzinger slots from 1, NULL for FLAT_MAP_SORTED.
+    size_t                  slot_size;      ///< Size of a slot, key then its entry index.
+};
+
+/**
+ * @name Initialization & Deinitialization
+ * Functions for setting up the flat map.
+ * @{
+ */
+
+/**
+ * @brief Initializes an empty flat map in FLAT_MAP_SORTED layout.
+ * @param[in] entry_size Size of an entry, key included.
+ * @param[in] key_size Size of the key at the start of an entry, at most @p entry_size.
+ * @param[in] cmp Returns negative, zero or positive if key @p a is less, equal or greater than key @p b.
+ * @return 0 in case of success, non-zero otherwise
+ */
+int flat_map_init(struct flat_map *fm, size_t entry_size, size_t key_size, int (*cmp) (const void *a, const void *b));
+
+/**
+ * @brief Releases the entries and the index.
+ */
+void flat_map_deinit(struct flat_map *fm);
+
+/**
+ * @brief Switches the layout lookups use, building or releasing the Eytzinger index.
+ * @return 0 on success, non-zero if the index could not be allocated, layout is FLAT_MAP_SORTED then.
+ */
+int flat_map_set_layout(struct flat_map *fm, enum flat_map_layout layout);
+
+/** @} */ // End of Initialization & Deinitialization
+
+/**
+ * @name Insertion & Removal
+ * Functions for modifying the flat map.
+ * @{
+ */
+
+/**
+ * @brief Replaces the contents with @p count entries of unsorted @p entries.
+ * @details Entries are copied, sorted and deduplicated in **O(N log N)**.
+ * Of entries with equal keys only one is kept, which one is unspecified.
+ * @return 0 on success, non-zero otherwise, the flat map is empty then.
+ */
+int flat_map_build(struct flat_map *fm, const void *entries, size_t count);
+
+/**
+ * @brief Inserts @p entry, replacing the entry with the same key if any.
+ * @return 0 on success, non-zero if the entry could not be inserted.
+ * @note If the Eytzinger index cannot follow, insert and erase still succeed and the
+ * layout falls back to FLAT_MAP_SORTED.
+ * @note This operation is **O(N)**, linear time.
+ */
+int flat_map_insert(struct flat_map *fm, const void *entry);
+
+/**
+ * @brief Erases the entry with @p key.
+ * @return 0 on success, non-zero if there is no such entry.
+ * @note This operation is **O(N)**, linear time.
+ */
+int flat_map_erase(struct flat_map *fm, const void *key);
+
+/**
+ * @brief Erases every entry.
+ */
+void flat_map_clear(struct flat_map *fm);
+
+/** @} */ // End of Insertion & Removal
+
+/**
+ * @name Lookup
+ * Functions for searching keys, all of them **O(log N)**.
+ * @{
+ */
+
+/** @return Pointer to the entry with @p key, NULL if there is none. */
+void *flat_map_find(struct flat_map *fm, const void *key);
+
+/** @return Index of the first entry whose key is not less than @p key, size if there is none. */
+size_t flat_map_lower_bound(const struct flat_map *fm, const void *key);
+
+/** @return Index of the first entry whose key is greater than @p key, size if there is none. */
+size_t flat_map_upper_bound(const struct flat_map *fm, const void *key);
+
+/**
+ * @brief Views the entries whose keys are in [@p low, @p high).
+ * @return View over the entries, use it with array functions. It might be empty, its
+ * buffer is still valid then.
+ */
+struct array flat_map_range(struct flat_map *fm, const void *low, const void *high);
+
+/** @} */ // End of Lookup
+
+/**
+ * @name Inspection
+ * Functions to query the flat map.
+ * @{
+ */
+
+/** @return Count of entries. */
+static inline size_t flat_map_size(const struct flat_map *fm)
+{
+    return dynarray_size(&fm->entries);
+}
+
+/** @return 1 if empty, 0 otherwise. */
+static inline int flat_map_empty(const struct flat_map *fm)
+{
+    return dynarray_empty(&fm->entries);
+}
+
+/**
+ * @return Pointer to the entry at @p index in key order.
+ * @warning **Array Bounds**: Bound checks are done by assert.
+ */
+static inline void *flat_map_at(struct flat_map *fm, size_t index)
+{
+    assert(index < flat_map_size(fm));
+    return dynarray_iterator_at(&fm->entries, index);
+}
+
+/** @return View over every entry in key order. */
+static inline struct array flat_map_entries(struct flat_map *fm)
+{
+    return fm->entries.base;
+}
+
+/** @} */ // End of Inspection
+
+/** @} */ // End of FLAT_MAP group
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // ARRAYS_FLAT_MAP_H
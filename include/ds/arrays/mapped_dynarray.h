@@ -0,0 +1,151 @@
+#ifndef ARRAYS_MAPPED_DYNARRAY_H
+#define ARRAYS_MAPPED_DYNARRAY_H
+
+#include "dynarray.h"
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @file mapped_dynarray.h
+ * @brief Defines the interface for file backed dynarray.
+ */
+
+/**
+ * @defgroup MAPPED_DYNARRAY Mapped Dynarray API
+ * @ingroup ARRAYS
+ * @brief Dynarray whose buffer is a shared mapping of a file, for persistent and larger than RAM arrays.
+ *
+ * @details
+ * The file holds a small header followed by the objects, so reopening it maps the objects
+ * back without reading or deserializing anything, pages are faulted in as they are touched.
+ * The dynarray allocates its buffer thru a @ref sized_allocator_concept that grows the file
+ * with `ftruncate` and the mapping with `mremap`, so every dynarray and array function works
+ * on @ref mapped_dynarray_base.
+ *
+ * @code
+ * struct mapped_dynarray md;
+ * mapped_dynarray_open(&md, "points.bin", sizeof(struct point), 1024, 0);
+ * dynarray_push_back(mapped_dynarray_base(&md), &p);
+ * mapped_dynarray_close(&md);
+ * @endcode
+ *
+ * ### Global Constraints
+ * - **NULL Pointers**: All `struct mapped_dynarray *md` must be non-NULL nor invalid.
+ * - **Object Type**: Objects are stored bitwise and outlive the process, they must be
+ * - trivially copyable and must not hold pointers.
+ * - **Durability**: Object count is written into the header by @ref mapped_dynarray_sync
+ * - and @ref mapped_dynarray_close only. After a crash the file reopens with the last synced count.
+ * - **Pinning**: Instances must not be copied or moved while open, the dynarray points into them.
+ * - **Platform Support**: Growth in place needs `mremap`, which is Linux specific. Elsewhere
+ * - the file is remapped at a new address.
+ * @{
+ */
+
+/** @brief Identifies files written by this module, "DSMAPARR" in little endian. */
+#define MAPPED_DYNARRAY_MAGIC 0x52524150414D5344ull
+
+/** @brief Bumped whenever @ref mapped_dynarray_header changes. */
+#define MAPPED_DYNARRAY_VERSION 1
+
+/**
+ * @enum mapped_dynarray_flags
+ * @brief Behaviour switches of @ref mapped_dynarray_open.
+ */
+enum mapped_dynarray_flags {
+    MAPPED_DYNARRAY_TRUNCATE = 1 << 0,  ///< Discard objects already in the file.
+    MAPPED_DYNARRAY_POPULATE = 1 << 1,  ///< Prefault the whole file on open with `MAP_POPULATE`.
+};
+
+/**
+ * @struct mapped_dynarray_header
+ * @brief First bytes of the file, objects start right after it.
+ */
+struct mapped_dynarray_header {
+    uint64_t    magic;          ///< @ref MAPPED_DYNARRAY_MAGIC.
+    uint32_t    version;        ///< @ref MAPPED_DYNARRAY_VERSION.
+    uint32_t    reserved;
+    uint64_t    obj_size;       ///< Size of the stored objects.
+    uint64_t    size;           ///< Count of objects at the last sync.
+    uint64_t    padding[4];     ///< Keeps the objects 64 byte aligned.
+};
+
+/**
+ * @struct mapped_dynarray
+ */
+struct mapped_dynarray {
+    struct dynarray     arr;        ///< Dynarray over the objects in the mapping.
+    int                 fd;         ///< Descriptor of the backing file.
+    int                 flags;      ///< Bitwise or of @ref mapped_dynarray_flags.
+    char                *mapping;   ///< Start of the mapping, the header.
+    size_t              length;     ///< Length of the mapping, equal to the file size.
+};
+
+/**
+ * @name Open & Close
+ * Functions for attaching the dynarray to its file.
+ * @{
+ */
+
+/**
+ * @brief Opens the file at @p path, creating it if it does not exist or is empty.
+ * @param[in] obj_size Size of the objects, must match the one the file was written with.
+ * @param[in] capacity Minimum capacity, cannot be zero. Existing files keep their larger capacity.
+ * @param[in] flags Bitwise or of @ref mapped_dynarray_flags.
+ * @return 0 in case of success, non-zero if the file cannot be opened or mapped, or is not
+ * a mapped dynarray of @p obj_size objects.
+ */
+int mapped_dynarray_open(struct mapped_dynarray *md, const char *path, size_t obj_size, size_t capacity, int flags);
+
+/**
+ * @brief Syncs the file, then unmaps and closes it.
+ * @return 0 in case of success, non-zero if the sync failed. The file is closed either way.
+ */
+int mapped_dynarray_close(struct mapped_dynarray *md);
+
+/**
+ * @brief Writes the object count into the header and flushes dirty pages with `msync`.
+ * @return 0 in case of success, non-zero otherwise.
+ */
+int mapped_dynarray_sync(struct mapped_dynarray *md);
+
+/** @} */ // End of Open & Close
+
+/**
+ * @name Access
+ * @{
+ */
+
+/**
+ * @return Dynarray to use with dynarray functions, cast it to `struct array *` for array ones.
+ * @warning Do not call @ref dynarray_deinit on it, use @ref mapped_dynarray_close.
+ */
+static inline struct dynarray *mapped_dynarray_base(struct mapped_dynarray *md)
+{
+    return &md->arr;
+}
+
+/** @return Count of objects. */
+static inline size_t mapped_dynarray_size(const struct mapped_dynarray *md)
+{
+    return dynarray_size(&md->arr);
+}
+
+/** @return Size of the backing file in bytes. */
+static inline size_t mapped_dynarray_file_size(const struct mapped_dynarray *md)
+{
+    return md->length;
+}
+
+/** @} */ // End of Access
+
+/** @} */ // End of MAPPED_DYNARRAY group
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // ARRAYS_MAPPED_DYNARRAY_H
@@ -0,0 +1,216 @@
+#ifndef ARRAYS_SEGARRAY_H
+#define ARRAYS_SEGARRAY_H
+
+#include <ds/utils/debug.h>
+#include <ds/utils/object_concept.h>
+#include <ds/utils/allocator_concept.h>
+#include "array.h"
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @file segarray.h
+ * @brief Defines the interface for segmented array.
+ */
+
+/**
+ * @defgroup SEGARRAY Segarray API
+ * @ingroup ARRAYS
+ * @brief Double-ended array of fixed size chunks, cpp deque like.
+ *
+ * @details
+ * Objects live in chunks of `chunk_capacity` objects, a directory of chunk pointers
+ * maps indices to chunks. Growing only reallocates the directory, objects are never
+ * copied after insertion.
+ * ### Global Constraints
+ * - **NULL Pointers**: All `struct segarray *sa` must be non-NULL nor invalid.
+ * - **Ownership**: Objects are owned by the segarray and managed thru object_concept given by user,
+ * - chunks are allocated thru allocator_concept given by user.
+ * - **Address Stability**: Pointers to objects stay valid until the object is popped, pushes on
+ * - either end never move existing objects.
+ * @{
+ */
+
+/**
+ * @struct segarray
+ * @note Logical positions count slots from the start of the first directory entry,
+ * position of the object at index i is begin + i.
+ */
+struct segarray {
+    void                    **chunks;           ///< Directory, NULL entries outside the used range.
+    size_t                  dir_capacity;       ///< Count of entries in the directory.
+    size_t                  begin;              ///< Logical position of the first object.
+    size_t                  size;               ///< Count of the objects stored.
+    size_t                  chunk_shift;        ///< log2 of objects per chunk.
+    size_t                  obj_size;           ///< Size of the object type stored.
+    struct object_concept   oc;                 ///< For initing and deiniting objects in chunks.
+    struct allocator_concept ac;                ///< Allocates the chunks.
+    size_t                  chunk_count;        ///< Count of the chunks allocated thru ac.
+};
+
+/**
+ * @name Initialization & Deinitialization
+ * Functions for setting up the segarray.
+ * @{
+ */
+
+/**
+ * @brief Initializes segarray.
+ * @param[in] obj_size Size of object type to be stored.
+ * @param[in] chunk_capacity Objects per chunk, must be a power of two.
+ * @param[in] oc object_concept of the stored type, see @ref DYNARRAY for NULL methods.
+ * @param[in] ac allocator_concept to allocate chunks, must be non-NULL and valid.
+ * Use @ref segarray_chunk_sizeof() to pass object size into your allocator.
+ * @return 0 in case of success, non-zero otherwise
+ * @note Nothing is allocated until the first push.
+ */
+int segarray_init(struct segarray *sa, size_t obj_size, size_t chunk_capacity, struct object_concept oc,
+                  struct allocator_concept *ac);
+
+/**
+ * @brief Deinitializes the objects, releases chunks and the directory.
+ */
+void segarray_deinit(struct segarray *sa);
+
+/** @return Bytes a chunk of @p chunk_capacity objects of @p obj_size bytes takes. */
+static inline size_t segarray_chunk_sizeof(size_t chunk_capacity, size_t obj_size)
+{
+    return chunk_capacity * obj_size;
+}
+
+/** @} */ // End of Initialization & Deinitialization
+
+/**
+ * @name Insertion & Removal
+ * Functions for both ends, all of them amortized **O(1)**.
+ * @{
+ */
+
+/**
+ * @brief Appends a copy of @p value.
+ * @return 0 on success, non-zero otherwise.
+ * @note This operation provides strong guarantee.
+ */
+int segarray_push_back(struct segarray *sa, void *value);
+
+/**
+ * @brief Prepends a copy of @p value.
+ * @return 0 on success, non-zero otherwise.
+ * @note This operation provides strong guarantee.
+ */
+int segarray_push_front(struct segarray *sa, void *value);
+
+/**
+ * @brief Removes the last object.
+ * @param[out] dest Memory to relocate the object into, thru .move of the object_concept.
+ * It is deinitialized instead if NULL.
+ * @return 0 on success, non-zero if the segarray is empty.
+ */
+int segarray_pop_back(struct segarray *sa, void *dest);
+
+/**
+ * @brief Removes the first object.
+ * @see segarray_pop_back
+ */
+int segarray_pop_front(struct segarray *sa, void *dest);
+
+/**
+ * @brief Removes every object, chunks are released too.
+ */
+void segarray_clear(struct segarray *sa);
+
+/** @} */ // End of Insertion & Removal
+
+/**
+ * @name Inspection
+ * Functions to query segarray.
+ * @{
+ */
+
+/** @return Current size (number of objects stored). */
+static inline size_t segarray_size(const struct segarray *sa)
+{
+    return sa->size;
+}
+
+/** @return 1 if empty, 0 otherwise. */
+static inline int segarray_empty(const struct segarray *sa)
+{
+    return sa->size == 0;
+}
+
+/** @return Objects per chunk. */
+static inline size_t segarray_chunk_capacity(const struct segarray *sa)
+{
+    return (size_t) 1 << sa->chunk_shift;
+}
+
+/**
+ * @return Pointer to the object at @p index, in **O(1)**.
+ * @warning **Array Bounds**: Bound checks are done by assert.
+ */
+static inline void *segarray_at(const struct segarray *sa, size_t index)
+{
+    assert(index < sa->size);
+    size_t pos = sa->begin + index;
+    size_t mask = ((size_t) 1 << sa->chunk_shift) - 1;
+    return (char *) sa->chunks[pos >> sa->chunk_shift] + (pos & mask) * sa->obj_size;
+}
+
+/** @return Pointer to the first object, NULL if empty. */
+static inline void *segarray_front(const struct segarray *sa)
+{
+    return (sa->size) ? segarray_at(sa, 0) : NULL;
+}
+
+/** @return Pointer to the last object, NULL if empty. */
+static inline void *segarray_back(const struct segarray *sa)
+{
+    return (sa->size) ? segarray_at(sa, sa->size - 1) : NULL;
+}
+
+/**
+ * @return Bytes held by the chunks and the directory, the struct segarray itself excluded.
+ */
+static inline size_t segarray_memory_usage(const struct segarray *sa)
+{
+    return sa->chunk_count * segarray_chunk_sizeof(segarray_chunk_capacity(sa), sa->obj_size)
+           + sa->dir_capacity * sizeof(void *);
+}
+
+/** @} */ // End of Inspection
+
+/**
+ * @name Iteration
+ * Functions to visit objects chunk by chunk.
+ * @{
+ */
+
+/**
+ * @brief Views the contiguous run of objects from @p index to the end of its chunk.
+ * @return View whose size is at least 1, use it with array functions.
+ * @details Usage:
+ * `for (size_t i = 0; i < segarray_size(sa); ) { struct array span = segarray_span(sa, i); ...; i += span.size; }`
+ * @warning **Array Bounds**: @p index must be less than the size, checked by assert.
+ */
+struct array segarray_span(const struct segarray *sa, size_t index);
+
+/**
+ * @brief Iterates over the segarray from front to back.
+ * @param[in] context Pointer to an arbitrary context for ease.
+ * @param[in] handler Called with every object and @p context.
+ */
+void segarray_walk(struct segarray *sa, void *context, void (*handler) (void *data, void *context));
+
+/** @} */ // End of Iteration
+
+/** @} */ // End of SEGARRAY group
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // ARRAYS_SEGARRAY_H
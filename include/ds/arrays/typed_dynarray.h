@@ -0,0 +1,179 @@
+#ifndef ARRAYS_TYPED_DYNARRAY_H
+#define ARRAYS_TYPED_DYNARRAY_H
+
+#include "dynarray.h"
+#include <stddef.h>
+#include <assert.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @file typed_dynarray.h
+ * @brief Generates dynarrays specialised for a single object type.
+ */
+
+/**
+ * @defgroup TYPED_DYNARRAY Typed Dynarray API
+ * @ingroup ARRAYS
+ * @brief Type specialised front end of @ref DYNARRAY.
+ *
+ * @details
+ * Generic dynarray functions scale indices by a runtime obj_size and copy objects thru
+ * object_concept callbacks. Functions generated by @ref DEFINE_DYNARRAY index a `T *`
+ * and copy by assignment instead, so the compiler can inline and vectorise loops over them.
+ * Only growth falls back to the generic implementation.
+ * ### Global Constraints
+ * - **Object Type**: `T` must be trivially copyable, the object_concept of the underlying
+ * - dynarray is all NULL.
+ * - **Interop**: Every instance embeds a plain `struct dynarray`, reachable thru `name_base()`,
+ * - and all @ref DYNARRAY functions work on it.
+ * @{
+ */
+
+/**
+ * @def DEFINE_DYNARRAY(name, T)
+ * @brief Defines `struct name` storing objects of type @p T and its inline functions.
+ * @details Generated functions, where `a` is a `struct name *`:
+ * - `name_init(a, capacity)`, `name_init_with(a, capacity, sac)`, `name_deinit(a)`
+ * - `name_base(a)` returns the underlying `struct dynarray *`
+ * - `name_size(a)`, `name_capacity(a)`, `name_data(a)`, `name_begin(a)`, `name_end(a)`
+ * - `name_at(a, index)` returns `T *`, `name_get(a, index)` returns `T`, `name_set(a, index, value)`
+ * - `name_push_back(a, value)`, `name_insert(a, index, value)`, `name_insert_range(a, index, src, count)`
+ * - `name_pop_back(a)` returns `T`, `name_erase(a, begin, end)`, `name_clear(a)`, `name_reserve(a, capacity)`
+ *
+ * Usage:
+ * `DEFINE_DYNARRAY(intvec, int)` at file scope, then
+ * `struct intvec v; intvec_init(&v, 16); intvec_push_back(&v, 42);`
+ * @note Functions returning int return 0 on success, non-zero otherwise, like their generic
+ * counterparts. Bound checks are done by assert.
+ */
+#define DEFINE_DYNARRAY(name, T)                                                              \
+  struct name {                                                                               \
+    struct dynarray arr;                                                                      \
+  };                                                                                          \
+                                                                                              \
+  static inline int name##_init(struct name *a, size_t capacity)                              \
+  {                                                                                           \
+    struct object_concept oc = { NULL, NULL, NULL };                                          \
+    return dynarray_init(&a->arr, capacity, sizeof(T), oc);                                   \
+  }                                                                                           \
+                                                                                              \
+  static inline int name##_init_with(struct name *a, size_t capacity,                         \
+                                     const struct sized_allocator_concept *sac)               \
+  {                                                                                           \
+    struct object_concept oc = { NULL, NULL, NULL };                                          \
+    return dynarray_init_with(&a->arr, capacity, sizeof(T), oc, sac);                         \
+  }                                                                                           \
+                                                                                              \
+  static inline void name##_deinit(struct name *a)                                            \
+  {                                                                                           \
+    dynarray_deinit(&a->arr);                                                                 \
+  }                                                                                           \
+                                                                                              \
+  static inline struct dynarray *name##_base(struct name *a)                                  \
+  {                                                                                           \
+    return &a->arr;                                                                           \
+  }                                                                                           \
+                                                                                              \
+  static inline size_t name##_size(const struct name *a)                                      \
+  {                                                                                           \
+    return a->arr.base.size;                                                                  \
+  }                                                                                           \
+                                                                                              \
+  static inline size_t name##_capacity(const struct name *a)                                  \
+  {                                                                                           \
+    return a->arr.capacity;                                                                   \
+  }                                                                                           \
+                                                                                              \
+  static inline T *name##_data(struct name *a)                                                \
+  {                                                                                           \
+    return (T *) a->arr.base.buffer;                                                          \
+  }                                                                                           \
+                                                                                              \
+  static inline T *name##_begin(struct name *a)                                               \
+  {                                                                                           \
+    return name##_data(a);                                                                    \
+  }                                                                                           \
+                                                                                              \
+  static inline T *name##_end(struct name *a)                                                 \
+  {                                                                                           \
+    return name##_data(a) + a->arr.base.size;                                                 \
+  }                                                                                           \
+                                                                                              \
+  static inline T *name##_at(struct name *a, size_t index)                                    \
+  {                                                                                           \
+    assert(index < a->arr.base.size);                                                         \
+    return name##_data(a) + index;                                                            \
+  }                                                                                           \
+                                                                                              \
+  static inline T name##_get(struct name *a, size_t index)                                    \
+  {                                                                                           \
+    return *name##_at(a, index);                                                              \
+  }                                                                                           \
+                                                                                              \
+  static inline void name##_set(struct name *a, size_t index, T value)                        \
+  {                                                                                           \
+    *name##_at(a, index) = value;                                                             \
+  }                                                                                           \
+                                                                                              \
+  static inline int name##_push_back(struct name *a, T value)                                 \
+  {                                                                                           \
+    if (a->arr.base.size < a->arr.capacity) {                                                 \
+      name##_data(a)[a->arr.base.size++] = value;                                             \
+      return 0;                                                                               \
+    }                                                                                         \
+    /* Growth policy lives in the generic implementation */                                   \
+    T *slot = (T *) dynarray_emplace_back(&a->arr);                                           \
+    if (!slot)                                                                                \
+      return 1;                                                                               \
+    *slot = value;                                                                            \
+    return 0;                                                                                 \
+  }                                                                                           \
+                                                                                              \
+  static inline int name##_insert(struct name *a, size_t index, T value)                      \
+  {                                                                                           \
+    T *slot = (T *) dynarray_emplace_at(&a->arr, index);                                      \
+    if (!slot)                                                                                \
+      return 1;                                                                               \
+    *slot = value;                                                                            \
+    return 0;                                                                                 \
+  }                                                                                           \
+                                                                                              \
+  static inline int name##_insert_range(struct name *a, size_t index, const T *src,           \
+                                        size_t count)                                         \
+  {                                                                                           \
+    if (count == 0)                                                                           \
+      return 0;                                                                               \
+    return dynarray_insert(&a->arr, index, (void *) src, (void *) (src + count));             \
+  }                                                                                           \
+                                                                                              \
+  static inline T name##_pop_back(struct name *a)                                             \
+  {                                                                                           \
+    assert(a->arr.base.size != 0);                                                            \
+    return name##_data(a)[--a->arr.base.size];                                                \
+  }                                                                                           \
+                                                                                              \
+  static inline void name##_erase(struct name *a, size_t begin, size_t end)                   \
+  {                                                                                           \
+    dynarray_delete(&a->arr, begin, end);                                                     \
+  }                                                                                           \
+                                                                                              \
+  static inline void name##_clear(struct name *a)                                             \
+  {                                                                                           \
+    a->arr.base.size = 0;                                                                     \
+  }                                                                                           \
+                                                                                              \
+  static inline int name##_reserve(struct name *a, size_t capacity)                           \
+  {                                                                                           \
+    return dynarray_reserve(&a->arr, capacity);                                               \
+  }
+
+/** @} */ // End of TYPED_DYNARRAY group
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // ARRAYS_TYPED_DYNARRAY_H
@@ -4,6 +4,8 @@
 #include <ds/utils/debug.h>
 #include <ds/utils/object_concept.h>
 #include <ds/utils/hash_concept.h>
+#include <ds/utils/allocator_concept.h>
+#include <ds/utils/stats.h>
 #include <stddef.h>
 
 #ifdef __cplusplus
@@ -24,6 +26,7 @@ extern "C" {
  * ### Global Constraints
  * - **NULL Pointers**: All `struct hash_table *ht`, `void *key` and `void *value` poiners must be non-NULL and valid.
  * - **Ownership**: Hash table stores references, objects should not go out of scope or freed before hash_table is freed.
+ * - **Probing**: @ref hash_table_create uses HASH_TABLE_PROBE_CONCEPT, see @ref hash_table_config for the others.
  * @{
  */
 
@@ -33,6 +36,64 @@ extern "C" {
  */
 struct hash_table;
 
+/**
+ * @enum hash_table_probing
+ * @brief How a table walks its slots for a key.
+ */
+enum hash_table_probing {
+    HASH_TABLE_PROBE_CONCEPT,       ///< hash_concept::hash gives every slot, prime capacities.
+    HASH_TABLE_PROBE_LINEAR,        ///< hash_concept::hash64 once, then next slot, power of two capacities.
+    HASH_TABLE_PROBE_QUADRATIC,     ///< hash_concept::hash64 once, then triangular steps, power of two capacities.
+    HASH_TABLE_PROBE_ROBIN_HOOD,    ///< Linear probing that keeps runs sorted by probe distance and deletes by
+                                    ///< backward shift, no tombstones. Costs 4 bytes per slot.
+};
+
+/**
+ * @enum hash_table_engine
+ * @brief Slot layout and probing implementation behind a hash_table.
+ */
+enum hash_table_engine {
+    HASH_TABLE_ENGINE_OPEN,         ///< Key value slots probed one by one as hash_table_probing says.
+    HASH_TABLE_ENGINE_SWISS,        ///< @ref SWISSTABLE, probing is ignored and hash64 must be set.
+};
+
+/**
+ * @struct hash_table_config
+ * @brief Per instance options, zero initialized config gives @ref hash_table_create behaviour.
+ */
+struct hash_table_config {
+    enum hash_table_probing probing;    ///< Probe sequence, hash64 must be set unless HASH_TABLE_PROBE_CONCEPT.
+    enum hash_table_engine  engine;     ///< Implementation, every hash_table_* function forwards to it.
+    int                     store_hash; ///< Non-zero keeps each key's hash64 in its slot, costs 8 bytes per slot.
+                                        ///< Probes compare it before calling cmp_key and resizes reuse it.
+                                        ///< Needs hash64 probing, ignored by HASH_TABLE_ENGINE_SWISS.
+    int                     incremental;///< Non-zero zeroes the new array of a resize a few slots per insert, remove
+                                        ///< and search, then moves the old slots over the same way, lookups check both
+                                        ///< meanwhile. No call touches more than a fixed count of slots. Not for Robin
+                                        ///< Hood probing, ignored by HASH_TABLE_ENGINE_SWISS.
+};
+
+/** @brief Buckets of the probe length histogram, longer probes fall into the last one. */
+#define HASH_TABLE_PROBE_BUCKETS 16
+
+/**
+ * @struct hash_table_stats
+ * @brief Event counters of a table, maintained only if DS_STATS is defined.
+ */
+struct hash_table_stats {
+    size_t probes[HASH_TABLE_PROBE_BUCKETS];   ///< Count of insert, remove and search calls by extra probes they took.
+    size_t resizes;                             ///< Count of bucket array rebuilds.
+};
+
+/**
+ * @struct hash_table_probe_stats
+ * @brief Probe lengths of the stored keys, computed on demand.
+ */
+struct hash_table_probe_stats {
+    size_t  max;        ///< Extra probes of the farthest key from its first slot (group for the swiss engine).
+    double  mean;       ///< Mean extra probes over the stored keys.
+};
+
 /**
  * @name Create & Destroy
  * @{
@@ -45,6 +106,25 @@ struct hash_table;
  */
 struct hash_table* hash_table_create(struct hash_concept *hc);
 
+/**
+ * @brief Creates the hash table whose bucket array is managed by @p sac.
+ * @param[in] hc Pointer to hash_concept. Must be non-NULL and valid.
+ * @param[in] sac Pointer to sized_allocator_concept, NULL for the global heap.
+ * @return Pointer to struct hash_table instance.
+ */
+struct hash_table* hash_table_create_with(struct hash_concept *hc, const struct sized_allocator_concept *sac);
+
+/**
+ * @brief Creates the hash table with given options.
+ * @param[in] hc Pointer to hash_concept. Must be non-NULL and valid.
+ * @param[in] sac Pointer to sized_allocator_concept, NULL for the global heap.
+ * @param[in] config Pointer to hash_table_config, NULL for defaults.
+ * @return Pointer to struct hash_table instance, NULL if allocation fails or
+ * @p config needs a hash64 that @p hc lacks.
+ */
+struct hash_table* hash_table_create_config(struct hash_concept *hc, const struct sized_allocator_concept *sac,
+    const struct hash_table_config *config);
+
 /**
  * @brief Destroys the table and its contents.
  * @param[in,out] ht The table instance.
@@ -94,6 +174,21 @@ size_t hash_table_size(const struct hash_table* ht);
 /** @return Current internal bucket capacity */
 size_t hash_table_capacity(const struct hash_table* ht);
 
+/**
+ * @brief Measures how far stored keys are from their first slot, in O(capacity).
+ * @param[out] out Filled with the maximum and mean probe lengths.
+ * @note Exact and cheap for HASH_TABLE_PROBE_ROBIN_HOOD, other modes replay each key's probes.
+ */
+void hash_table_get_probe_stats(const struct hash_table* ht, struct hash_table_probe_stats* out);
+
+#ifdef DS_STATS
+/** @return Event counters of the table, see @ref DS_STATS. */
+const struct hash_table_stats *hash_table_get_stats(const struct hash_table* ht);
+
+/** @brief Zeroes event counters of the table. */
+void hash_table_reset_stats(struct hash_table* ht);
+#endif // DS_STATS
+
 /** @} */ // End of Properties
 
 /**
@@ -157,6 +252,11 @@ int string_cmp(const void* _obj1, const void* _obj2)
 }
 
 struct hash_concept hc = { .hash = double_hash, .cmp_key = string_cmp };
+
+// or hash once per operation and probe a power of two table
+struct hash_concept hc64 = { .cmp_key = string_cmp, .hash64 = hash64_string };
+struct hash_table_config config = { .probing = HASH_TABLE_PROBE_LINEAR };
+struct hash_table* ht = hash_table_create_config(&hc64, NULL, &config);
 */
 
 #ifdef __cplusplus
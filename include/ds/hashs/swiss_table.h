@@ -0,0 +1,136 @@
+#ifndef HASHS_SWISS_TABLE_H
+#define HASHS_SWISS_TABLE_H
+
+#include <ds/utils/debug.h>
+#include <ds/utils/object_concept.h>
+#include <ds/utils/hash_concept.h>
+#include <ds/utils/allocator_concept.h>
+#include <ds/hashs/hash_table.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @file swiss_table.h
+ * @brief Defines the interface for the control byte hash table engine.
+ */
+
+/**
+ * @defgroup SWISSTABLE Swiss Table
+ * @ingroup HASHS
+ * @brief Key-Value pair container probing 16 control bytes at once.
+ *
+ * @details
+ * Every slot has a control byte next to the others in a separate array: empty, deleted,
+ * or full with 7 bits of the key's hash64. A probe loads a group of 16 control bytes,
+ * compares all of them with the key's 7 bits in one SSE2 instruction (a scalar loop
+ * without SSE2) and calls `cmp_key` only on matches. Groups are probed quadratically,
+ * a group with an empty byte ends the search.
+ *
+ * The functions mirror @ref HASHTABLE, a hash_table created with HASH_TABLE_ENGINE_SWISS
+ * forwards to them, so the engine can be chosen per instance.
+ *
+ * ### Global Constraints
+ * - **NULL Pointers**: All `struct swiss_table *st`, `void *key` and `void *value` poiners must be non-NULL and valid.
+ * - **Ownership**: Table stores references, objects should not go out of scope or freed before swiss_table is freed.
+ * - **Hashing**: Only hash_concept::hash64 and hash_concept::cmp_key are used, hash64 must be set.
+ * @{
+ */
+
+/**
+ * @struct swiss_table
+ * @brief Opaque handle for the Swiss Table.
+ */
+struct swiss_table;
+
+/** @brief Slots whose control bytes are probed at once. */
+#define SWISS_TABLE_GROUP 16
+
+/**
+ * @name Create & Destroy
+ * @{
+ */
+
+/**
+ * @brief Creates the table with given concepts.
+ * @param[in] hc Pointer to hash_concept. Must be non-NULL, hash64 must be set.
+ * @param[in] sac Pointer to sized_allocator_concept, NULL for the global heap.
+ * @return Pointer to struct swiss_table instance, NULL if allocation fails or hash64 is missing.
+ */
+struct swiss_table* swiss_table_create(struct hash_concept *hc, const struct sized_allocator_concept *sac);
+
+/**
+ * @brief Destroys the table and its contents.
+ * @param[in] oc Pointer to object_concept to deinit key value pairs, can be NULL if you store POD.
+ */
+void swiss_table_destroy(struct swiss_table* st, struct object_concept *oc);
+
+/** @} */ // End of Create & Destroy
+
+/**
+ * @name Insertion & Removal
+ * @{
+ */
+
+/**
+ * @brief Inserts new key-value pair, replaces the value if the key exists.
+ * @return 0 if succeeds, non-zero if growing the table fails.
+ * @note This function provides strong guarantee
+ */
+int swiss_table_insert(struct swiss_table* st, void* key, void* value);
+
+/**
+ * @brief Removes given key from the table.
+ * @return 0 if succeeds, non-zero if the key is missing or shrinking the table fails.
+ * @note This function provides strong guarantee
+ */
+int swiss_table_remove(struct swiss_table* st, const void* key);
+
+/** @} */ // End of Insertion & Removal
+
+/**
+ * @name Properties
+ * @{
+ */
+
+/** @return Count of the objects whose references are stored here */
+size_t swiss_table_size(const struct swiss_table* st);
+
+/** @return Current slot capacity, a power of two multiple of SWISS_TABLE_GROUP */
+size_t swiss_table_capacity(const struct swiss_table* st);
+
+/** @brief Probe lengths of the stored keys in groups, see @ref hash_table_get_probe_stats. */
+void swiss_table_get_probe_stats(const struct swiss_table* st, struct hash_table_probe_stats* out);
+
+#ifdef DS_STATS
+/** @return Event counters of the table, probes count extra groups. See @ref DS_STATS. */
+const struct hash_table_stats *swiss_table_get_stats(const struct swiss_table* st);
+
+/** @brief Zeroes event counters of the table. */
+void swiss_table_reset_stats(struct swiss_table* st);
+#endif // DS_STATS
+
+/** @} */ // End of Properties
+
+/**
+ * @name Search & Iteration
+ * @{
+ */
+
+/** @return Value of @p key, NULL if it is missing. */
+void* swiss_table_search(struct swiss_table* st, const void* key);
+
+/** @brief Calls @p exec on every key value pair, in slot order. */
+void swiss_table_walk(struct swiss_table* st, void* context, void (*exec) (void* key, void* value, void* context));
+
+/** @} */ // End of Search & Iteration
+
+/** @} */ // End of SWISSTABLE group
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // HASHS_SWISS_TABLE_H
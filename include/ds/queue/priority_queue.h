@@ -6,6 +6,7 @@ extern "C" {
 #endif
 
 #include <ds/utils/object_concept.h>
+#include <ds/utils/allocator_concept.h>
 #include <ds/utils/debug.h>
 #include <stddef.h>
 
@@ -42,6 +43,15 @@ struct priority_queue;
  */
 struct priority_queue *priority_queue_create(size_t obj_size, struct object_concept *oc, int (*cmp) (const void *a, const void *b));
 
+/**
+ * @brief Creates a new Priority Queue whose buffer is managed by @p sac.
+ * @param[in] sac Pointer to sized_allocator_concept, NULL for the global heap.
+ * @return Pointer to new priority_queue, or NULL on failure.
+ * @see array_heap_init_with
+ */
+struct priority_queue *priority_queue_create_with(size_t obj_size, struct object_concept *oc, int (*cmp) (const void *a, const void *b),
+                                                  const struct sized_allocator_concept *sac);
+
 void priority_queue_destroy(struct priority_queue* pq);
 
 /** @} */
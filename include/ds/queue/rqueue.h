@@ -0,0 +1,168 @@
+#ifndef QUEUE_RQUEUE_H
+#define QUEUE_RQUEUE_H
+
+#include <ds/utils/debug.h>
+#include <ds/utils/object_concept.h>
+#include <ds/utils/allocator_concept.h>
+#include <ds/arrays/array.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @file rqueue.h
+ * @brief Defines the interface for Ring Queue.
+ */
+
+/**
+ * @defgroup RQUEUE Ring Queue
+ * @ingroup QUEUE
+ * @brief Implements queue ADT using a circular buffer. Allocation free once it is large enough.
+ *
+ * @details
+ * Objects live in one contiguous buffer whose capacity is a power of two, so wrapping
+ * indices is a mask. Growing doubles the buffer and unwraps the ring, objects stay in
+ * FIFO order. Store pointers by passing `sizeof(void *)` as the object size.
+ * ### Global Constraints
+ * - **NULL Pointers**: All `struct rqueue *rq` must be non-NULL nor invalid. Methods of `struct object_concept`
+ * - might be NULL for trivially copyable types, see @ref DYNARRAY.
+ * - **Ownership**: Internal slots are owned by the queue and managed thru object_concept given by user
+ * - to init, deinit and relocate objects in place.
+ * - **Pointer Validity**: Pointers and spans into the queue are invalidated by enqueueing.
+ * @{
+ */
+
+/**
+ * @struct rqueue
+ * @brief Queue ADT based on a circular buffer.
+ */
+struct rqueue;
+
+/**
+ * @name Create & Destroy
+ * Functions for setting up the queue.
+ * @{
+ */
+
+/**
+ * @brief Creates the queue ADT.
+ * @param[in] obj_size Size of object type to be stored.
+ * @param[in] oc copy concept of object to init and deinit objects.
+ * @return rqueue, NULL otherwise.
+ * @see object_concept
+ */
+struct rqueue *rqueue_create(size_t obj_size, struct object_concept *oc);
+
+/**
+ * @brief Creates the queue ADT whose buffer is managed by @p sac.
+ * @param[in] sac Pointer to sized_allocator_concept, NULL for the global heap.
+ * @return rqueue, NULL otherwise.
+ * @see rqueue_create
+ */
+struct rqueue *rqueue_create_with(size_t obj_size, struct object_concept *oc, const struct sized_allocator_concept *sac);
+
+/**
+ * @brief Destroys the queue ADT, deinitializing remaining objects.
+ * @param[in, out] rq Pointer to the queue instance.
+ */
+void rqueue_destroy(struct rqueue *rq);
+
+/**
+ * @brief Grows the buffer to hold at least @p capacity objects, rounded up to a power of two.
+ * @return 0 on success, non-zero otherwise.
+ */
+int rqueue_reserve(struct rqueue *rq, size_t capacity);
+
+/** @} */ // End of Create & Destroy
+
+/**
+ * @name Enqueue & Dequeue
+ * Functions to enqueue and dequeue items.
+ * @{
+ */
+
+/**
+ * @brief Enqueues new item.
+ * @param[in] new_item Item copied into the queue thru .init of the object_concept.
+ * @return 0 on success, non-zero otherwise.
+ */
+int renqueue(struct rqueue *rq, void *new_item);
+
+/**
+ * @brief Dequeues the front item.
+ * @param[in, out] dequeued_item Pointer to memory block to relocate dequeued item into,
+ * thru .move of the object_concept. Dequeued item is deinitialized instead if NULL.
+ * @return 0 on success, negative if the queue is empty.
+ */
+int rdequeue(struct rqueue *rq, void *dequeued_item);
+
+/**
+ * @brief Enqueues @p count contiguous items at once.
+ * @details Trivially copyable items are copied with at most two memcpy calls.
+ * @return 0 on success, non-zero otherwise. No item is enqueued on failure.
+ */
+int renqueue_n(struct rqueue *rq, void *items, size_t count);
+
+/**
+ * @brief Dequeues up to @p count items at once.
+ * @param[in, out] items Buffer of @p count objects to relocate the items into, in FIFO order.
+ * Items are deinitialized instead if NULL.
+ * @return Count of dequeued items.
+ */
+size_t rdequeue_n(struct rqueue *rq, void *items, size_t count);
+
+/** @} */ // End of Enqueue & Dequeue
+
+/**
+ * @name Inspection
+ * Functions to query queue ADT.
+ * @{
+ */
+
+/**
+ * @param[in, out] front_item Pointer to memory block to store front item.
+ * @return 0 on success, positive if copy ctor fails, negative if the queue is empty.
+ */
+int rqueue_front(struct rqueue *rq, void *front_item);
+
+/**
+ * @return Pointer to the object @p index places behind the front, NULL if there is none.
+ */
+void *rqueue_at(struct rqueue *rq, size_t index);
+
+/**
+ * @brief Views the queued objects in place, without copying them.
+ * @param[out] first View from the front item up to the end of the buffer or the rear item.
+ * @param[out] second View of the items wrapped around to the start of the buffer, might be empty.
+ * @note Concatenating @p first and @p second gives the items in FIFO order.
+ */
+void rqueue_spans(struct rqueue *rq, struct array *first, struct array *second);
+
+/** @return 1 if the queue is empty, 0 otherwise. */
+int rqueue_empty(const struct rqueue *rq);
+
+/** @return Count of the objects stored in the queue. */
+size_t rqueue_size(const struct rqueue *rq);
+
+/** @return Count of the objects the queue can hold before growing. */
+size_t rqueue_capacity(const struct rqueue *rq);
+
+/** @} */ // End of Inspection
+
+/**
+ * @brief Iterates over the queue, from front to rear.
+ * @param[in] context Pointer to an arbitrary context for ease.
+ * @param[in] handler Pointer to a function pointer that executes
+ * taking data reference and context pointer.
+ */
+void rqueue_walk(struct rqueue *rq, void *context, void (*handler) (void *item, void *context));
+
+/** @} */ // End of RQUEUE group
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // QUEUE_RQUEUE_H
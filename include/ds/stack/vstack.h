@@ -3,6 +3,7 @@
 
 #include <ds/utils/debug.h>
 #include <ds/utils/object_concept.h>
+#include <ds/utils/allocator_concept.h>
 #include <stddef.h>
 
 #ifdef __cplusplus
@@ -22,7 +23,7 @@ extern "C" {
  * @details
  * ### Global Constraints
  * - **NULL Pointers**: All `struct vstack *vs` must be non-NULL nor invalid. Methods of `struct object_concept`
- * - must be given and implemented.
+ * - might be NULL for trivially copyable types, see @ref DYNARRAY.
  * - **Ownership**: Internal slots are owned by underlying dynarray (vector) and managed thru object_concept
  * - given by user to init and deinit objects in place.
  * @{
@@ -32,8 +33,8 @@ extern "C" {
  * @struct vstack
  * @brief Stack ADT based on a dynamic array.
  * @details **Ownership**: Internal slots are owned by the underlying `dynarray` 
- * and managed via `object_concept` for in-place construction. .init method of
- * the object_concept should never be NULL.
+ * and managed via `object_concept` for in-place construction. NULL .init method
+ * of the object_concept means bitwise copy.
  */
 struct vstack;
 
@@ -53,6 +54,15 @@ struct vstack;
  */
 struct vstack *vstack_create(size_t obj_size, struct object_concept *oc);
 
+/**
+ * @brief Creates the stack ADT whose buffer is managed by @p sac.
+ * @param[in] sac Pointer to sized_allocator_concept, NULL for the global heap.
+ * @return vstack, NULL otherwise.
+ * @see vstack_create
+ * @see dynarray_init_with
+ */
+struct vstack *vstack_create_with(size_t obj_size, struct object_concept *oc, const struct sized_allocator_concept *sac);
+
 /**
  * @brief Destroy the stack ADT.
  * @param[in, out] vs Pointer to the stack instance.
@@ -77,9 +87,9 @@ int vpush(struct vstack *vs, void *new_item);
 /**
  * @brief Pops the stack ADT.
  * @param[in, out] popped_item Pointer to memory block to
- * store popped item. Nothing is copied if NULL.
- * @return 0 on success, positive if copy ctor fails, negative
- * if the stack is empty.
+ * relocate popped item into, thru .move of the object_concept.
+ * Popped item is deinitialized instead if NULL.
+ * @return 0 on success, negative if the stack is empty.
  */
 int vpop(struct vstack *vs, void *popped_item);
 
@@ -4,6 +4,7 @@
 #include <ds/utils/debug.h>
 #include <ds/utils/allocator_concept.h>
 #include <ds/utils/object_concept.h>
+#include <ds/utils/stats.h>
 #include "common/traversals.h"
 #include "common/status.h"
 #include "mwaytree.h"
@@ -32,6 +33,17 @@ extern "C" {
  * @{
  */
 
+/**
+ * @struct Btree_stats
+ * @brief Event counters of a tree, maintained only if DS_STATS is defined.
+ */
+struct Btree_stats {
+    size_t                          splits;             ///< Count of overflowed nodes split.
+    size_t                          merges;             ///< Count of underflowed siblings merged.
+    size_t                          borrows_left;       ///< Count of entries borrowed from the left sibling.
+    size_t                          borrows_right;      ///< Count of entries borrowed from the right sibling.
+};
+
 /**
  * @struct Btree
  */
@@ -40,6 +52,8 @@ struct Btree {
     struct allocator_concept        ac;                 ///< Used by the tree to allocate new nodes to maintain the tree.
     int (*cmp) (const void *key, const void *data);     ///< Pointer to function that returns negative if a<b, 0 if a==b, positive if a>b. 
     size_t                          size;               ///< Count of the objects whose references are stored here.
+    size_t                          node_count;         ///< Count of the nodes allocated thru ac.
+    DS_STATS_FIELD(struct Btree_stats, stats)           ///< Event counters, only if DS_STATS is defined.
 };
 
 /**
@@ -62,6 +76,8 @@ int Btree_init(struct Btree *tree, size_t order, int (*cmp) (const void *key, co
 /**
  * @brief Deinitializes the B-tree.
  * @param[in] oc object_concept to deinit data references.
+ * @note If the allocator has no `.free` (see @ref ARENA) and @p oc has no `.deinit`,
+ * nodes are not visited at all, release them by resetting the allocator.
  * @warning Only root is set to NULL after freeing the internal tree.
  */
 void Btree_deinit(struct Btree *tree, struct object_concept *oc);
@@ -142,6 +158,22 @@ static inline size_t Btree_order(const struct Btree* tree)
     return tree->root->capacity + 1;
 }
 
+/** @return Count of the nodes the tree holds. */
+static inline size_t Btree_node_count(const struct Btree* tree)
+{
+    return tree->node_count;
+}
+
+/**
+ * @return Bytes held by the nodes of the tree, the struct Btree itself excluded.
+ * @note Allocator overhead is not included, wrap the allocator with @ref ALLOC_STATS
+ * to measure what it actually consumes.
+ */
+static inline size_t Btree_memory_usage(const struct Btree* tree)
+{
+    return (tree->node_count) ? tree->node_count * Btree_node_sizeof(Btree_order(tree)) : 0;
+}
+
 /** @} */ // End of Inspection
 
 /**
@@ -53,6 +53,16 @@ struct array_heap {
  */
 int array_heap_init(struct array_heap *tree, size_t obj_size, struct object_concept *oc, int (*cmp) (const void *a, const void *b));
 
+/**
+ * @brief Initializes the array_heap whose buffer is managed by @p sac.
+ * @param[in] sac Pointer to sized_allocator_concept, NULL for the global heap.
+ * @return 0 on success, non-zero otherwise.
+ * @see array_heap_init
+ * @see dynarray_init_with
+ */
+int array_heap_init_with(struct array_heap *tree, size_t obj_size, struct object_concept *oc, int (*cmp) (const void *a, const void *b),
+                         const struct sized_allocator_concept *sac);
+
 /** @brief Deinits the array_heap. */
 void array_heap_deinit(struct array_heap *tree);
 
@@ -72,9 +82,11 @@ void array_heap_deinit(struct array_heap *tree);
 int array_heap_add(struct array_heap *tree, void *new_data);
 
 /**
- * @brief Removes
+ * @brief Removes the root, relocating it into @p removed.
  * @param[out] removed Memory block that is able to hold type
- * of the object the array_heap stores.
+ * of the object the array_heap stores, becomes its owner.
+ * @note Sifting relocates objects thru .move of the object_concept,
+ * nothing is copied or deinitialized.
  * @return 0 on success, non-zero otherwise.
  */
 int array_heap_remove(struct array_heap *tree, void *removed);
@@ -4,6 +4,7 @@
 #include <ds/utils/debug.h>
 #include <ds/utils/object_concept.h>
 #include <ds/utils/macros.h>
+#include <ds/utils/stats.h>
 #include "bintree.h"
 #include <stddef.h>
 #include <stdint.h>
@@ -61,6 +62,15 @@ struct avl_node {
     struct bintree      btree;      ///< Inheriting from bintree, since avl is conceptually a binary tree.
 };
 
+/**
+ * @struct avl_stats
+ * @brief Event counters of a tree, maintained only if DS_STATS is defined.
+ */
+struct avl_stats {
+    size_t              rotations_left;     ///< Count of left rotations.
+    size_t              rotations_right;    ///< Count of right rotations.
+};
+
 /**
  * @struct avl
  * @brief Aggregation of generic binary tree.
@@ -69,6 +79,7 @@ struct avl {
     struct avl_node     *root;      ///< Root of the tree.
     size_t              size;       ///< Count of the objects whose references are stored here.
     bst_cmp_cb          cmp;        ///< Pointer to function that returns negative if a<b, 0 if a==b, positive if a>b.
+    DS_STATS_FIELD(struct avl_stats, stats) ///< Event counters, only if DS_STATS is defined.
 };
 
 /**
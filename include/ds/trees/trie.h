@@ -6,6 +6,7 @@
 #include <ds/utils/allocator_concept.h>
 #include <ds/utils/debug.h>
 #include <ds/utils/object_concept.h>
+#include <ds/utils/stats.h>
 #include <stddef.h>
 
 #ifdef __cplusplus
@@ -46,6 +47,14 @@ typedef size_t (*trie_map_cb) (unsigned char c);
  */
 typedef unsigned char (*trie_unmap_cb) (size_t i);
 
+/**
+ * @struct trie_stats
+ * @brief Event counters of a trie, maintained only if DS_STATS is defined.
+ */
+struct trie_stats {
+    size_t                          node_allocs;        ///< Count of the nodes allocated by puts.
+};
+
 /**
  * @struct trie
  * @brief Simple trie.
@@ -63,8 +72,10 @@ struct trie {
     struct allocator_concept        ac;                 ///< Allocator for internal nodes.
     size_t                          alphabet_size;      ///< Capacity (N) for mway nodes.
     size_t                          count;              ///< Count of objects in the dictionary.
+    size_t                          node_count;         ///< Count of the nodes allocated thru ac.
     trie_map_cb                     mapper;             ///< Maps char -> index.
     trie_unmap_cb                   unmapper;           ///< UNmaps index -> char.
+    DS_STATS_FIELD(struct trie_stats, stats)            ///< Event counters, only if DS_STATS is defined.
 };
 
 /**
@@ -87,6 +98,8 @@ void trie_init(struct trie *tr, struct allocator_concept *ac, size_t alphabet_si
  * @brief Destroys the Trie and frees all nodes.
  * @param tr Pointer to the trie.
  * @param oc Optional object_concept to free the `void*` data stored in the trie.
+ * @note If the allocator has no `.free` (see @ref ARENA) and @p oc has no `.deinit`,
+ * nodes are not visited at all, release them by resetting the allocator.
  * @warning This function only sets root.child and root.data to NULL. Remaining fields
  * remain same, i decided this thinking we might not always need to NULLify the object
  * for example, we might just free it and forget it. Any ideas?
@@ -153,6 +166,24 @@ static inline int trie_is_empty(struct trie *tr)
     return tr->count == 0;
 }
 
+/** @return Count of the nodes the trie holds. */
+static inline size_t trie_node_count(const struct trie *tr)
+{
+    assert(tr != NULL);
+    return tr->node_count;
+}
+
+/**
+ * @return Bytes held by the nodes of the trie, the struct trie itself excluded.
+ * @note Allocator overhead is not included, wrap the allocator with @ref ALLOC_STATS
+ * to measure what it actually consumes.
+ */
+static inline size_t trie_memory_usage(const struct trie *tr)
+{
+    assert(tr != NULL);
+    return tr->node_count * trie_node_sizeof(tr->alphabet_size);
+}
+
 /** @} */ // End of Dictionary Operations
 
 /**
@@ -0,0 +1,171 @@
+#ifndef UTILS_ALLOC_STATS_H
+#define UTILS_ALLOC_STATS_H
+
+#include "allocator_concept.h"
+#include <stddef.h>
+#include <stdio.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @file alloc_stats.h
+ * @brief Defines the interface for allocator instrumentation.
+ */
+
+/**
+ * @defgroup ALLOC_STATS Allocator Statistics
+ * @ingroup UTILS
+ * @brief Counting wrapper around @ref allocator_concept and @ref sized_allocator_concept.
+ *
+ * @details
+ * The wrapper forwards every request to the inner allocator and keeps allocation and
+ * free counts, live objects, bytes in use and their high-water mark. Give every
+ * container its own wrapper to attribute memory per container, wrappers can share
+ * one inner allocator:
+ *
+ * @code
+ * struct alloc_stats st;
+ * alloc_stats_init(&st, &pool_ac, Btree_node_sizeof(order));
+ * struct allocator_concept ac = alloc_stats_concept(&st);
+ * Btree_init(&tree, order, cmp, &ac);
+ * ...
+ * alloc_stats_dump(&st, stderr, "index tree");
+ * @endcode
+ *
+ * ### Global Constraints
+ * - **NULL Pointers**: All `struct alloc_stats *st` must be non-NULL nor invalid.
+ * - **Thread Safety**: None, counters are updated without synchronization.
+ * - **Region Allocators**: If the inner free is NULL, so is the free of the wrapper
+ * and containers skip per-node frees; live counts then only drop on @ref alloc_stats_reset.
+ * @{
+ */
+
+/**
+ * @struct alloc_counters
+ * @brief Snapshot of the counters of a wrapper.
+ */
+struct alloc_counters {
+    size_t      alloc_count;    ///< Successful allocations, reallocations excluded.
+    size_t      free_count;     ///< Frees forwarded to the inner allocator.
+    size_t      failed_count;   ///< Allocations and reallocations the inner allocator failed.
+    size_t      live_objects;   ///< Blocks allocated but not freed yet.
+    size_t      live_bytes;     ///< Bytes of the live blocks.
+    size_t      peak_bytes;     ///< High-water mark of live_bytes.
+};
+
+/**
+ * @struct alloc_stats
+ * @brief Wrapper state, stack allocatable but must not be moved while in use.
+ */
+struct alloc_stats {
+    struct allocator_concept        inner;          ///< Wrapped fixed size allocator, if any.
+    struct sized_allocator_concept  inner_sized;    ///< Wrapped sized allocator, if any.
+    size_t                          obj_size;       ///< Bytes accounted per fixed size allocation.
+    struct alloc_counters           counters;       ///< Current counters.
+};
+
+/**
+ * @name Initialization
+ * @{
+ */
+
+/**
+ * @brief Wraps a fixed size allocator.
+ * @param[in, out] st Pointer to the wrapper instance.
+ * @param[in] inner Allocator to forward to, copied into the wrapper.
+ * @param[in] obj_size Size of the objects @p inner allocates, since
+ * @ref allocator_concept does not carry it.
+ */
+void alloc_stats_init(struct alloc_stats *st, const struct allocator_concept *inner, size_t obj_size);
+
+/**
+ * @brief Wraps a sized allocator, bytes are taken from the requests.
+ * @param[in] inner Allocator to forward to, NULL for the global heap.
+ */
+void alloc_stats_init_sized(struct alloc_stats *st, const struct sized_allocator_concept *inner);
+
+/** @brief Zeroes every counter, e.g. after resetting an inner arena. */
+void alloc_stats_reset(struct alloc_stats *st);
+
+/** @} */ // End of Initialization
+
+/**
+ * @name Allocator Concepts
+ * Functions to pass into the concepts with `.allocator = &st`.
+ * @{
+ */
+
+/** @brief Forwards to the inner fixed size allocator. */
+void *alloc_stats_alloc(void *allocator);
+
+/** @brief Forwards to the inner fixed size allocator. */
+void alloc_stats_free(void *allocator, void *ptr);
+
+/** @brief Forwards to the inner sized allocator. */
+void *alloc_stats_alloc_sized(void *allocator, size_t size, size_t align);
+
+/** @brief Forwards to the inner sized allocator, emulating realloc if it has none. */
+void *alloc_stats_realloc_sized(void *allocator, void *ptr, size_t old_size, size_t new_size, size_t align);
+
+/** @brief Forwards to the inner sized allocator. */
+void alloc_stats_free_sized(void *allocator, void *ptr, size_t size);
+
+/** @return allocator_concept counting into @p st, free is NULL if the inner one is. */
+static inline struct allocator_concept alloc_stats_concept(struct alloc_stats *st)
+{
+    struct allocator_concept ac = { st, alloc_stats_alloc, (st->inner.free) ? alloc_stats_free : NULL };
+    return ac;
+}
+
+/** @return sized_allocator_concept counting into @p st, free is NULL if the inner one is. */
+static inline struct sized_allocator_concept alloc_stats_sized_concept(struct alloc_stats *st)
+{
+    struct sized_allocator_concept sac = {
+        st, alloc_stats_alloc_sized, alloc_stats_realloc_sized, (st->inner_sized.free) ? alloc_stats_free_sized : NULL
+    };
+    return sac;
+}
+
+/** @} */ // End of Allocator Concepts
+
+/**
+ * @name Inspection
+ * @{
+ */
+
+/** @return Snapshot of the counters. */
+static inline struct alloc_counters alloc_stats_get(const struct alloc_stats *st)
+{
+    return st->counters;
+}
+
+/** @return Bytes currently in use thru the wrapper. */
+static inline size_t alloc_stats_live_bytes(const struct alloc_stats *st)
+{
+    return st->counters.live_bytes;
+}
+
+/** @return High-water mark of bytes in use thru the wrapper. */
+static inline size_t alloc_stats_peak_bytes(const struct alloc_stats *st)
+{
+    return st->counters.peak_bytes;
+}
+
+/**
+ * @brief Prints the counters in one line.
+ * @param[in] out Stream to print into.
+ * @param[in] name Label of the line, might be NULL.
+ */
+void alloc_stats_dump(const struct alloc_stats *st, FILE *out, const char *name);
+
+/** @} */ // End of Inspection
+
+/** @} */ // End of ALLOC_STATS group
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // UTILS_ALLOC_STATS_H
@@ -26,13 +26,16 @@ extern "C" {
  * pool, or heap) interchangeably.
  * @warning You must provide a valid @p allocator context, @p alloc, and @p free 
  * functions to avoid segmentation faults.
+ * @note @p free might be NULL for region allocators (see @ref ARENA), which release
+ * memory in bulk. Containers then skip per-node frees, and their deinit functions
+ * skip walking the nodes if there is nothing to deinit.
  * @note **Platform Support**: Signatures match x86 and ARM pointer sizes but 
  * may require wrappers for strict C standard compliance on other architectures.
  */
 struct allocator_concept {
     void *allocator;                                ///< Pointer to the specific pool or context.
     void *(*alloc) (void *allocator);               ///< Allocation function pointer.
-    void (*free) (void *allocator, void *ptr);      ///< Deallocation function pointer.
+    void (*free) (void *allocator, void *ptr);      ///< Deallocation function pointer, NULL if it is a no-op.
 };
 
 /**
@@ -50,6 +53,45 @@ void *sysalloc(void *allocator);
 /** @brief Free wrapper for @ref syspool. */
 void sysfree(void *allocator, void *ptr);
 
+/**
+ * @struct sized_allocator_concept
+ * @brief Stores function pointers for variable sized buffers.
+ * Containers with one contiguous buffer (dynarray, hash_table) use this instead of
+ * @ref allocator_concept, since their requests differ in size every time they grow.
+ * @note @p realloc might be NULL, containers then allocate, copy and free instead.
+ * @note @p free might be NULL for region allocators (see @ref ARENA).
+ * @note Sizes passed into @p realloc and @p free are always the ones the block was
+ * requested with, so allocators do not need to store them.
+ */
+struct sized_allocator_concept {
+    void *allocator;                                                                                ///< Pointer to the specific pool or context.
+    void *(*alloc) (void *allocator, size_t size, size_t align);                                    ///< Allocation function pointer.
+    void *(*realloc) (void *allocator, void *ptr, size_t old_size, size_t new_size, size_t align);  ///< Reallocation function pointer, might be NULL.
+    void (*free) (void *allocator, void *ptr, size_t size);                                         ///< Deallocation function pointer, NULL if it is a no-op.
+};
+
+/** @brief Aligned malloc wrapper, @p allocator is unused. */
+void *sysalloc_sized(void *allocator, size_t size, size_t align);
+
+/** @brief Realloc wrapper, falls back to copying for over-aligned blocks. */
+void *sysrealloc_sized(void *allocator, void *ptr, size_t old_size, size_t new_size, size_t align);
+
+/** @brief Free wrapper, @p allocator and @p size are unused. */
+void sysfree_sized(void *allocator, void *ptr, size_t size);
+
+/** @return sized_allocator_concept backed by the global heap. */
+static inline struct sized_allocator_concept sysallocator_sized(void)
+{
+    struct sized_allocator_concept sac = { NULL, sysalloc_sized, sysrealloc_sized, sysfree_sized };
+    return sac;
+}
+
+/**
+ * @brief Grows or shrinks @p ptr thru @p sac, emulating realloc if it is NULL.
+ * @return Pointer to the block, NULL on failure in which case @p ptr is untouched.
+ */
+void *sized_realloc(const struct sized_allocator_concept *sac, void *ptr, size_t old_size, size_t new_size, size_t align);
+
 /** @} */
 
 #ifdef __cplusplus
@@ -0,0 +1,125 @@
+#ifndef UTILS_ARENA_H
+#define UTILS_ARENA_H
+
+#include "allocator_concept.h"
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @file arena.h
+ * @brief Defines the interface for bump (arena) allocator.
+ */
+
+/**
+ * @defgroup ARENA Arena
+ * @ingroup UTILS
+ * @brief Bump allocator whose objects are released all at once.
+ *
+ * @details
+ * Objects are carved out of chunks by bumping a cursor, individual objects are
+ * never freed. Pass it into @ref allocator_concept with `.free = NULL`, so that
+ * containers built per batch (trie, Btree) can be torn down in O(number of chunks)
+ * by @ref arena_reset or @ref arena_destroy instead of walking every node:
+ *
+ * @code
+ * struct arena ar;
+ * arena_init(&ar, trie_node_sizeof(256), 0);
+ * struct allocator_concept ac = { .allocator = &ar, .alloc = arena_alloc, .free = NULL };
+ * trie_init(&tr, &ac, 256, mapper, unmapper);
+ * ...
+ * trie_deinit(&tr, NULL);  // does not visit the nodes
+ * arena_reset(&ar);        // ready for the next batch
+ * @endcode
+ *
+ * Buffers of dynarray and hash_table can live in an arena too, thru
+ * @ref sized_allocator_concept with `.alloc = arena_alloc_sized`,
+ * `.realloc = arena_realloc_sized` and `.free = NULL`.
+ *
+ * ### Global Constraints
+ * - **NULL Pointers**: All `struct arena *ar` must be non-NULL nor invalid.
+ * - **Thread Safety**: None, an arena must be owned by one thread at a time.
+ * @{
+ */
+
+/** @brief Chunk size used if zero is passed into @ref arena_init. */
+#define ARENA_DEFAULT_CHUNK_SIZE (256 * 1024)
+
+/**
+ * @struct arena
+ * @brief Arena state, stack allocatable.
+ */
+struct arena {
+    size_t      obj_size;       ///< Size of the objects returned by @ref arena_alloc.
+    size_t      chunk_size;     ///< Usable size of each regular chunk in bytes.
+    size_t      chunk_count;    ///< Count of chunks currently held.
+    void        *chunks;        ///< Singly linked list of chunks, newest first.
+    char        *cursor;        ///< Next free byte in the newest chunk.
+    char        *end;           ///< End of the newest chunk.
+};
+
+/**
+ * @name Initialization & Destruction
+ * @{
+ */
+
+/**
+ * @brief Initializes the arena, no chunk is allocated until the first request.
+ * @param[in, out] ar Pointer to the arena instance.
+ * @param[in] obj_size Size of the objects allocated thru @ref arena_alloc. Might be
+ * zero if you only use @ref arena_alloc_aligned.
+ * @param[in] chunk_size Usable size of each chunk. Pass 0 for @ref ARENA_DEFAULT_CHUNK_SIZE.
+ */
+void arena_init(struct arena *ar, size_t obj_size, size_t chunk_size);
+
+/**
+ * @brief Invalidates every object, keeping one chunk for reuse.
+ * @note This operation is **O(C)**, C being the number of chunks.
+ */
+void arena_reset(struct arena *ar);
+
+/**
+ * @brief Releases every chunk.
+ * @note This operation is **O(C)**, C being the number of chunks.
+ */
+void arena_destroy(struct arena *ar);
+
+/** @} */ // End of Initialization & Destruction
+
+/**
+ * @name Allocation
+ * @{
+ */
+
+/**
+ * @brief Allocates @p size bytes aligned to @p align.
+ * @param[in] align Power of two alignment.
+ * @return Pointer to the memory, NULL on failure.
+ * @note Requests larger than the chunk size get a dedicated chunk.
+ */
+void *arena_alloc_aligned(struct arena *ar, size_t size, size_t align);
+
+/** @brief allocator_concept compatible allocation of `obj_size` bytes. */
+void *arena_alloc(void *allocator);
+
+/** @brief sized_allocator_concept compatible wrapper of @ref arena_alloc_aligned. */
+void *arena_alloc_sized(void *allocator, size_t size, size_t align);
+
+/**
+ * @brief sized_allocator_concept compatible reallocation.
+ * @note The most recent allocation grows in place if its chunk has room, others
+ * are copied into a new block and the old bytes stay unused until reset.
+ */
+void *arena_realloc_sized(void *allocator, void *ptr, size_t old_size, size_t new_size, size_t align);
+
+/** @} */ // End of Allocation
+
+/** @} */ // End of ARENA group
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // UTILS_ARENA_H
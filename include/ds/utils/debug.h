@@ -21,6 +21,7 @@
     #include <limits.h>
     #include <string.h>
     #include <stdio.h>
+    #include "logger.h"
 
     #define CINFO "\x1b[32m[INFO]\x1b[0m"
     #define CWARNING "\x1b[33m[WARNING]\x1b[0m"
@@ -37,27 +38,20 @@
         #define DBGLVL 0
     #endif // DBGLVL
 
+    // Records are formatted asynchronously, see logger.h. Status must be one of
+    // CINFO, CWARNING and CERROR, it selects the severity for compile-time filtering.
     #define LOG(xxx_123_lvl, xxx_123_status, xxx_123_fmt, ...)      \
     do                                      \
     {                                       \
         if (xxx_123_lvl >= DBGLVL)                  \
-        {                                   \
-            char time_buff[21];             \
-            time_t curr_time = time(NULL);  \
-            strftime(time_buff, sizeof(time_buff), "%Y-%m-%d %H:%M:%S", localtime(&curr_time));                                         \
-            if (errno == 0)                                                                                                             \
-                fprintf(stderr, "\x1b[35m%s\x1b[0m " xxx_123_status " %s\x1b[34m@\x1b[36mfn-%s\x1b[34m@\x1b[36mln-%d\x1b[0m: " xxx_123_fmt "\n", time_buff, __FILE__, __func__, __LINE__, ##__VA_ARGS__);     \
-            else                                                                                                                        \
-                fprintf(stderr, "\x1b[35m%s\x1b[0m " xxx_123_status " %s\x1b[34m@\x1b[36mfn-%s\x1b[34m@\x1b[36mln-%d\x1b[0m: " xxx_123_fmt " (%s)\n", time_buff, __FILE__, __func__, __LINE__, ##__VA_ARGS__, strerror(errno)); \
-            errno = 0;  \
-        }   \
+            DS_LOG(DS_LOG_SEVERITY_##xxx_123_status, xxx_123_status, xxx_123_fmt, ##__VA_ARGS__);  \
     } while (0)
 
     #define LOG_IF(xxx_123_cond, xxx_123_lvl, xxx_123_status, xxx_123_fmt, ...)  \
     do                                              \
     {                                               \
-        if (xxx_123_cond)                                   \
-            LOG(xxx_123_lvl, xxx_123_status, xxx_123_fmt, ##__VA_ARGS__);   \
+        if ((xxx_123_cond) && xxx_123_lvl >= DBGLVL)        \
+            DS_LOG(DS_LOG_SEVERITY_##xxx_123_status, xxx_123_status, xxx_123_fmt, ##__VA_ARGS__);  \
     } while (0)                                     \
 
 #endif
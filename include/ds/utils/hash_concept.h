@@ -2,6 +2,7 @@
 #define HASH_CONCEPT_H
 
 #include <stddef.h>
+#include <stdint.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -11,6 +12,12 @@ extern "C" {
  * @defgroup HASH_CONCEPT Hash Concept
  * @ingroup UTILS
  * @brief Metadata for hashing and key comparison.
+ *
+ * @details
+ * Two kinds of hash functions are supported. @ref hash_fn maps a key straight into a
+ * slot for a given attempt, so tables call it again on every probe. @ref hash64_fn
+ * hashes a key once into 64 bits, tables derive every probe from that value (see
+ * @ref hash_table_config). Prefer the latter, keys are then read once per operation.
  * @{
  */
 
@@ -22,19 +29,62 @@ extern "C" {
  */
 typedef size_t (*hash_fn)(const void* key, size_t capacity, size_t attempts);
 
+/**
+ * @brief Signature for a 64-bit hash function, called once per operation.
+ * @param key The key to hash.
+ * @return Hash of the key. Every bit should depend on every bit of the key, tables use
+ * the low bits for the slot, see @ref hash64_mix.
+ */
+typedef uint64_t (*hash64_fn)(const void* key);
+
 /**
  * @struct hash_concept
  * @brief Bundles hashing and comparison logic for keys.
  */
 struct hash_concept {
-    hash_fn hash;                                       ///< The hashing algorithm.
+    hash_fn hash;                                       ///< The hashing algorithm, used by HASH_TABLE_PROBE_CONCEPT.
     int (*cmp_key) (const void* a, const void* b);      ///< Key equality comparator.
+    hash64_fn hash64;                                   ///< Single 64-bit hash per key, used by power of two tables.
 };
 
+/**
+ * @name 64-bit Hash Functions
+ * Ready made @ref hash64_fn implementations and helpers to build new ones.
+ * @{
+ */
+
+/** @brief Finalizer of MurmurHash3, spreads every input bit over the whole word. */
+static inline uint64_t hash64_mix(uint64_t x)
+{
+    x ^= x >> 33;
+    x *= 0xff51afd7ed558ccdull;
+    x ^= x >> 33;
+    x *= 0xc4ceb9fe1a85ec53ull;
+    x ^= x >> 33;
+    return x;
+}
+
+/**
+ * @brief Hashes @p len bytes at @p data, eight bytes per step.
+ * @param[in] seed Arbitrary value to derive independent hash functions.
+ */
+uint64_t hash64_bytes(const void* data, size_t len, uint64_t seed);
+
+/** @brief @ref hash64_fn for NUL terminated strings. */
+uint64_t hash64_string(const void* key);
+
+/** @brief @ref hash64_fn for `uint64_t` and `int64_t` keys. */
+uint64_t hash64_u64(const void* key);
+
+/** @brief @ref hash64_fn for `uint32_t` and `int` keys. */
+uint64_t hash64_u32(const void* key);
+
+/** @} */ // End of 64-bit Hash Functions
+
 /** @} */
 
 #ifdef __cplusplus
 }
 #endif
 
-#endif // HASH_CONCEPT_H
\ No newline at end of file
+#endif // HASH_CONCEPT_H
@@ -0,0 +1,195 @@
+#ifndef UTILS_LOGGER_H
+#define UTILS_LOGGER_H
+
+#include <stddef.h>
+#include <stdio.h>
+#include <errno.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @file logger.h
+ * @brief Defines the interface for asynchronous binary logger behind LOG().
+ */
+
+/**
+ * @defgroup LOGGER Logger
+ * @ingroup UTILS
+ * @brief Per-thread lock-free ring buffers of raw log records, formatted later.
+ *
+ * @details
+ * A log call only stores a timestamp, a pointer to a static description of the call
+ * site (file, function, line, status and format string) which acts as the format id,
+ * errno and the raw arguments into a single producer single consumer ring owned by the
+ * calling thread. Formatting and I/O happen in @ref ds_log_flush, called explicitly, by
+ * the background thread of @ref ds_log_start or at exit.
+ *
+ * ### Compile-time Filtering
+ * Define `DS_LOG_MIN_SEVERITY` to one of `DS_LOG_SEVERITY_CINFO`, `DS_LOG_SEVERITY_CWARNING`
+ * or `DS_LOG_SEVERITY_CERROR` (0, 1, 2) before including debug.h, e.g. with
+ * `-DDS_LOG_MIN_SEVERITY=1`. Calls below it fold into dead code and their arguments
+ * are never evaluated.
+ *
+ * ### Global Constraints
+ * - **Arguments**: At most @ref DS_LOG_MAX_ARGS arguments, `*` widths are not supported.
+ * Strings are copied into the record up to @ref DS_LOG_TEXT_SIZE bytes in total.
+ * - **Overflow**: Records of a full ring are dropped and counted, a log call never blocks.
+ * @{
+ */
+
+/** @brief Maximum count of arguments a single record can hold. */
+#define DS_LOG_MAX_ARGS 8
+
+/** @brief Bytes of string arguments a single record can hold. */
+#define DS_LOG_TEXT_SIZE 64
+
+/** @brief Records per thread ring, must be a power of two. */
+#define DS_LOG_RING_SIZE 1024
+
+#define DS_LOG_SEVERITY_CINFO 0
+#define DS_LOG_SEVERITY_CWARNING 1
+#define DS_LOG_SEVERITY_CERROR 2
+
+#ifndef DS_LOG_MIN_SEVERITY
+    #define DS_LOG_MIN_SEVERITY DS_LOG_SEVERITY_CINFO
+#endif // DS_LOG_MIN_SEVERITY
+
+/**
+ * @struct ds_log_site
+ * @brief Static description of a log call, records point to it instead of carrying strings.
+ */
+struct ds_log_site {
+    const char      *file;      ///< __FILE__ of the call.
+    const char      *func;      ///< __func__ of the call.
+    const char      *status;    ///< Colored status label.
+    const char      *fmt;       ///< printf format of the message.
+    int             line;       ///< __LINE__ of the call.
+};
+
+/** @brief Type tags of the captured arguments. */
+enum ds_log_arg_type {
+    DS_LOG_ARG_INT,         ///< Signed integer, widened to long long.
+    DS_LOG_ARG_UINT,        ///< Unsigned integer, widened to unsigned long long.
+    DS_LOG_ARG_DOUBLE,      ///< Floating point, widened to double.
+    DS_LOG_ARG_STR,         ///< String, copied into the record.
+    DS_LOG_ARG_PTR,         ///< Any other pointer, stored as is.
+};
+
+/**
+ * @struct ds_log_arg
+ * @brief One raw argument of a log call.
+ */
+struct ds_log_arg {
+    int type;                       ///< One of @ref ds_log_arg_type.
+    union {
+        long long           i;
+        unsigned long long  u;
+        double              d;
+        const char          *s;
+        const void          *p;
+    } v;                            ///< Value, selected by type.
+};
+
+/**
+ * @name Logging
+ * @{
+ */
+
+/**
+ * @brief Appends a record into the ring of the calling thread, called by LOG().
+ * @param[in] site Static description of the call site.
+ * @param[in] err errno at the time of the call.
+ * @param[in] argc Count of the arguments in @p argv.
+ * @param[in] argv Raw arguments, might be NULL if @p argc is zero.
+ */
+void ds_log_write(const struct ds_log_site *site, int err, size_t argc, const struct ds_log_arg *argv);
+
+/**
+ * @brief Formats every pending record of every thread into the output.
+ * @note Safe to call from any thread, flushes are serialized.
+ */
+void ds_log_flush(void);
+
+/**
+ * @brief Sets the stream records are formatted into, stderr by default.
+ * @note Pending records are flushed into the previous stream first.
+ */
+void ds_log_set_output(FILE *out);
+
+/**
+ * @brief Starts a background thread flushing every @p interval_ms milliseconds.
+ * @return 0 on success or if it is already running, non-zero otherwise.
+ */
+int ds_log_start(unsigned interval_ms);
+
+/** @brief Stops the background thread, if any, and flushes. */
+void ds_log_stop(void);
+
+/** @return Count of the records dropped since start because a ring was full. */
+size_t ds_log_dropped(void);
+
+/** @} */ // End of Logging
+
+/** @cond INTERNAL */
+
+static inline struct ds_log_arg ds_log_arg_int(long long x) { struct ds_log_arg a; a.type = DS_LOG_ARG_INT; a.v.i = x; return a; }
+static inline struct ds_log_arg ds_log_arg_uint(unsigned long long x) { struct ds_log_arg a; a.type = DS_LOG_ARG_UINT; a.v.u = x; return a; }
+static inline struct ds_log_arg ds_log_arg_double(double x) { struct ds_log_arg a; a.type = DS_LOG_ARG_DOUBLE; a.v.d = x; return a; }
+static inline struct ds_log_arg ds_log_arg_str(const char *x) { struct ds_log_arg a; a.type = DS_LOG_ARG_STR; a.v.s = x; return a; }
+static inline struct ds_log_arg ds_log_arg_ptr(const void *x) { struct ds_log_arg a; a.type = DS_LOG_ARG_PTR; a.v.p = x; return a; }
+
+#define DS_LOG_ARG(x) _Generic((x),                                         \
+    _Bool: ds_log_arg_uint, char: ds_log_arg_int,                           \
+    signed char: ds_log_arg_int, unsigned char: ds_log_arg_uint,            \
+    short: ds_log_arg_int, unsigned short: ds_log_arg_uint,                 \
+    int: ds_log_arg_int, unsigned int: ds_log_arg_uint,                     \
+    long: ds_log_arg_int, unsigned long: ds_log_arg_uint,                   \
+    long long: ds_log_arg_int, unsigned long long: ds_log_arg_uint,         \
+    float: ds_log_arg_double, double: ds_log_arg_double,                    \
+    long double: ds_log_arg_double,                                         \
+    char *: ds_log_arg_str, const char *: ds_log_arg_str,                   \
+    default: ds_log_arg_ptr)(x)
+
+#define DS_LOG_NARGS(...) DS_LOG_NARGS_IMPL(0, ##__VA_ARGS__, 8, 7, 6, 5, 4, 3, 2, 1, 0)
+#define DS_LOG_NARGS_IMPL(_0, _1, _2, _3, _4, _5, _6, _7, _8, N, ...) N
+
+#define DS_LOG_CAT(a, b) DS_LOG_CAT_IMPL(a, b)
+#define DS_LOG_CAT_IMPL(a, b) a##b
+
+#define DS_LOG_ARGV_0() NULL
+#define DS_LOG_ARGV_1(a) ((const struct ds_log_arg[]) { DS_LOG_ARG(a) })
+#define DS_LOG_ARGV_2(a, b) ((const struct ds_log_arg[]) { DS_LOG_ARG(a), DS_LOG_ARG(b) })
+#define DS_LOG_ARGV_3(a, b, c) ((const struct ds_log_arg[]) { DS_LOG_ARG(a), DS_LOG_ARG(b), DS_LOG_ARG(c) })
+#define DS_LOG_ARGV_4(a, b, c, d) ((const struct ds_log_arg[]) { DS_LOG_ARG(a), DS_LOG_ARG(b), DS_LOG_ARG(c), DS_LOG_ARG(d) })
+#define DS_LOG_ARGV_5(a, b, c, d, e) ((const struct ds_log_arg[]) { DS_LOG_ARG(a), DS_LOG_ARG(b), DS_LOG_ARG(c), DS_LOG_ARG(d), DS_LOG_ARG(e) })
+#define DS_LOG_ARGV_6(a, b, c, d, e, f) ((const struct ds_log_arg[]) { DS_LOG_ARG(a), DS_LOG_ARG(b), DS_LOG_ARG(c), DS_LOG_ARG(d), DS_LOG_ARG(e), DS_LOG_ARG(f) })
+#define DS_LOG_ARGV_7(a, b, c, d, e, f, g) ((const struct ds_log_arg[]) { DS_LOG_ARG(a), DS_LOG_ARG(b), DS_LOG_ARG(c), DS_LOG_ARG(d), DS_LOG_ARG(e), DS_LOG_ARG(f), DS_LOG_ARG(g) })
+#define DS_LOG_ARGV_8(a, b, c, d, e, f, g, h) ((const struct ds_log_arg[]) { DS_LOG_ARG(a), DS_LOG_ARG(b), DS_LOG_ARG(c), DS_LOG_ARG(d), DS_LOG_ARG(e), DS_LOG_ARG(f), DS_LOG_ARG(g), DS_LOG_ARG(h) })
+
+/** @endcond */
+
+/**
+ * @brief Records a log call of severity @p severity, see @ref DS_LOG_MIN_SEVERITY.
+ * @note `if (0) printf(...)` keeps format checking of the compiler without emitting code.
+ */
+#define DS_LOG(severity, status, fmt, ...)                                                      \
+    do {                                                                                        \
+        if ((severity) >= DS_LOG_MIN_SEVERITY) {                                                \
+            static const struct ds_log_site ds_log_site_ = { __FILE__, __func__, status, fmt, __LINE__ }; \
+            if (0)                                                                              \
+                printf(fmt, ##__VA_ARGS__);                                                     \
+            ds_log_write(&ds_log_site_, errno, DS_LOG_NARGS(__VA_ARGS__),                       \
+                         DS_LOG_CAT(DS_LOG_ARGV_, DS_LOG_NARGS(__VA_ARGS__))(__VA_ARGS__));     \
+            errno = 0;                                                                          \
+        }                                                                                       \
+    } while (0)
+
+/** @} */ // End of LOGGER group
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // UTILS_LOGGER_H
@@ -0,0 +1,121 @@
+#ifndef UTILS_MMAP_ALLOCATOR_H
+#define UTILS_MMAP_ALLOCATOR_H
+
+#include "allocator_concept.h"
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @file mmap_allocator.h
+ * @brief Defines the interface for mmap backed large buffer allocator.
+ */
+
+/**
+ * @defgroup MMAP_ALLOCATOR Mmap Allocator
+ * @ingroup UTILS
+ * @brief @ref sized_allocator_concept that maps big buffers directly from the kernel.
+ *
+ * @details
+ * Buffers at or above a threshold get their own anonymous mapping, optionally backed
+ * by transparent huge pages to cut TLB misses of random access over huge dynarrays
+ * and hash tables. Growing a mapping goes thru `mremap`, so the kernel moves page
+ * table entries instead of copying the data. Smaller buffers are served by malloc.
+ *
+ * @code
+ * struct mmap_allocator ma;
+ * mmap_allocator_init(&ma, 0, MMAP_ALLOCATOR_HUGEPAGES);
+ * struct sized_allocator_concept sac = mmap_allocator_concept(&ma);
+ * dynarray_init_with(&arr, capacity, sizeof(uint64_t), oc, &sac);
+ * @endcode
+ *
+ * ### Global Constraints
+ * - **NULL Pointers**: All `struct mmap_allocator *ma` must be non-NULL nor invalid.
+ * - **Thread Safety**: Mapping itself is thread safe, but @ref mmap_allocator::mapped_bytes
+ * is updated without synchronization.
+ * - **Platform Support**: Huge pages need `MADV_HUGEPAGE` and in place growth needs
+ * `mremap`, both are Linux specific. Elsewhere plain mappings are copied on growth.
+ * @{
+ */
+
+/** @brief Threshold used if zero is passed into @ref mmap_allocator_init. */
+#define MMAP_ALLOCATOR_DEFAULT_THRESHOLD (1024 * 1024)
+
+/** @brief Size of a transparent huge page, mappings asking for them are aligned to it. */
+#define MMAP_ALLOCATOR_HUGEPAGE_SIZE (2 * 1024 * 1024)
+
+/**
+ * @enum mmap_allocator_flags
+ * @brief Behaviour switches of the allocator.
+ */
+enum mmap_allocator_flags {
+    MMAP_ALLOCATOR_HUGEPAGES = 1 << 0,  ///< Ask for transparent huge pages with `madvise(MADV_HUGEPAGE)`.
+    MMAP_ALLOCATOR_POPULATE = 1 << 1,   ///< Prefault new mappings with `MAP_POPULATE`.
+};
+
+/**
+ * @struct mmap_allocator
+ * @brief Allocator state, stack allocatable.
+ */
+struct mmap_allocator {
+    size_t      threshold;      ///< Buffers smaller than this are served by malloc.
+    int         flags;          ///< Bitwise or of @ref mmap_allocator_flags.
+    size_t      mapped_bytes;   ///< Bytes currently mapped by this allocator.
+};
+
+/**
+ * @name Initialization
+ * @{
+ */
+
+/**
+ * @brief Initializes the allocator, nothing is mapped until the first request.
+ * @param[in, out] ma Pointer to the allocator instance.
+ * @param[in] threshold Minimum size of a buffer to be mapped. Pass 0 for
+ * @ref MMAP_ALLOCATOR_DEFAULT_THRESHOLD.
+ * @param[in] flags Bitwise or of @ref mmap_allocator_flags.
+ */
+void mmap_allocator_init(struct mmap_allocator *ma, size_t threshold, int flags);
+
+/** @} */ // End of Initialization
+
+/**
+ * @name Sized Allocator Concept
+ * Functions to pass into @ref sized_allocator_concept with `.allocator = &ma`.
+ * @{
+ */
+
+/**
+ * @brief Maps @p size bytes, or mallocs them below the threshold.
+ * @param[in] align Power of two alignment, at most @ref MMAP_ALLOCATOR_HUGEPAGE_SIZE.
+ * @return Pointer to the memory, NULL on failure.
+ */
+void *mmap_alloc_sized(void *allocator, size_t size, size_t align);
+
+/**
+ * @brief Resizes the buffer, mapped buffers are grown with `mremap` without copying.
+ * @return Pointer to the buffer, NULL on failure in which case @p ptr is untouched.
+ */
+void *mmap_realloc_sized(void *allocator, void *ptr, size_t old_size, size_t new_size, size_t align);
+
+/** @brief Unmaps or frees the buffer. */
+void mmap_free_sized(void *allocator, void *ptr, size_t size);
+
+/** @return sized_allocator_concept backed by @p ma. */
+static inline struct sized_allocator_concept mmap_allocator_concept(struct mmap_allocator *ma)
+{
+    struct sized_allocator_concept sac = { ma, mmap_alloc_sized, mmap_realloc_sized, mmap_free_sized };
+    return sac;
+}
+
+/** @} */ // End of Sized Allocator Concept
+
+/** @} */ // End of MMAP_ALLOCATOR group
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // UTILS_MMAP_ALLOCATOR_H
@@ -17,12 +17,16 @@ extern "C" {
  * containers. It bridges the gap between the container's raw memory management and 
  * the specific requirements of the user's data types.
  * * ### Lifecycle Logic
- * - **Initialization (`init`)**: Acts as a generalized copy constructor. For containers 
- * that own their data (e.g., @ref DYNARRAY), a valid `init` is mandatory. Arguments 
- * can be packed into the second `void *` parameter.
+ * - **Initialization (`init`)**: Acts as a generalized copy constructor. Arguments
+ * can be packed into the second `void *` parameter. NULL means the type is trivially
+ * copyable, containers that own their data (e.g., @ref DYNARRAY) then copy objects
+ * bitwise, bulk operations become a single memcpy/memmove.
  * - **Deinitialization (`deinit`)**: Invoked during destruction. For data structures 
  * holding references only (e.g., @ref GRAPHS), this is primarily used during final 
  * cleanup.
+ * - **Relocation (`move`)**: Transfers an object into uninitialized memory when containers
+ * shift, grow or swap their slots, so owned resources are handed over instead of duplicated.
+ * NULL means objects can be relocated bitwise, which holds unless they point into themselves.
  * * @{
  */
 
@@ -44,6 +48,14 @@ typedef int (*init_cb) (void *object, void *args);
  */
 typedef void (*deinit_cb) (void *object);
 
+/**
+ * @brief Relocator/Move constructor.
+ * @param dest Pointer to the uninitialized memory slot to relocate into.
+ * @param src Pointer to the object to relocate, treated as uninitialized memory afterwards.
+ * @note Must not fail, the source is never deinitialized after a move.
+ */
+typedef void (*move_cb) (void *dest, void *src);
+
 /**
  * @struct object_concept
  * @brief Stores function pointers for object initialization and destruction.
@@ -53,10 +65,46 @@ typedef void (*deinit_cb) (void *object);
  */
 struct object_concept
 {
-    init_cb init; 
-    deinit_cb deinit; 
+    init_cb init;       ///< Copy constructor, NULL for bitwise copy.
+    deinit_cb deinit;   ///< Destructor, NULL if there is nothing to release.
+    move_cb move;       ///< Relocator, NULL for bitwise relocation.
 };
 
+/** @return 1 if objects of @p oc can be copied bitwise, 0 otherwise. */
+static inline int object_concept_trivial(const struct object_concept *oc)
+{
+    return oc->init == NULL;
+}
+
+/**
+ * @brief Initializes @p object from @p args thru @p oc, or copies @p size bytes if it is trivial.
+ * @return Result of init, 0 for trivial copies.
+ */
+static inline int object_concept_init(const struct object_concept *oc, void *object, void *args, size_t size)
+{
+    if (oc->init == NULL) {
+        memcpy(object, args, size);
+        return 0;
+    }
+    return oc->init(object, args);
+}
+
+/** @brief Relocates the object of @p size bytes at @p src into @p dest thru @p oc, bitwise if it has no relocator. */
+static inline void object_concept_move(const struct object_concept *oc, void *dest, void *src, size_t size)
+{
+    if (oc->move == NULL)
+        memcpy(dest, src, size);
+    else
+        oc->move(dest, src);
+}
+
+/** @brief Deinitializes @p object thru @p oc, if it has a destructor. */
+static inline void object_concept_deinit(const struct object_concept *oc, void *object)
+{
+    if (oc->deinit != NULL)
+        oc->deinit(object);
+}
+
 /** @} */ // End of OBJ_CONCEPT group
 
 #ifdef __cplusplus
@@ -0,0 +1,95 @@
+#ifndef UTILS_SLAB_POOL_H
+#define UTILS_SLAB_POOL_H
+
+#include "allocator_concept.h"
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @file slab_pool.h
+ * @brief Defines the interface for fixed-size slab pool.
+ */
+
+/**
+ * @defgroup SLAB_POOL Slab Pool
+ * @ingroup UTILS
+ * @brief Fixed-size object pool that plugs into @ref allocator_concept.
+ *
+ * @details
+ * Objects are carved out of large page-aligned slabs. Freed objects are kept
+ * in an intrusive free list and reused before a new slab is requested, so node
+ * based containers (lqueue, lstack, Btree, trie) stop paying one malloc per node.
+ * Slabs are only returned to the system by @ref slab_pool_deinit.
+ *
+ * ### Global Constraints
+ * - **NULL Pointers**: All `struct slab_pool *sp` must be non-NULL nor invalid.
+ * - **Thread Safety**: None, a pool must be owned by one thread at a time.
+ * @{
+ */
+
+/** @brief Slab size used if zero is passed into @ref slab_pool_init. */
+#define SLAB_POOL_DEFAULT_SIZE (64 * 1024)
+
+/**
+ * @struct slab_pool
+ * @brief Pool state, stack allocatable.
+ */
+struct slab_pool {
+    size_t      obj_size;       ///< Size of the slots, rounded up to hold a free list link.
+    size_t      slab_size;      ///< Size of each slab in bytes, multiple of the page size.
+    size_t      slab_count;     ///< Count of slabs requested from the system.
+    void        *slabs;         ///< Singly linked list of slabs, newest first.
+    void        *free_list;     ///< Intrusive list of released slots.
+    char        *bump;          ///< Next never used slot in the newest slab.
+    char        *bump_end;      ///< End of the newest slab.
+};
+
+/**
+ * @name Initialization & Deinitialization
+ * @{
+ */
+
+/**
+ * @brief Initializes the pool, no slab is allocated until the first request.
+ * @param[in, out] sp Pointer to the pool instance.
+ * @param[in] obj_size Size of the objects to be allocated, cannot be zero.
+ * Use `<ds>_node_sizeof` of the container you will plug the pool into.
+ * @param[in] slab_size Size of each slab in bytes, rounded up to the page size.
+ * Pass 0 for @ref SLAB_POOL_DEFAULT_SIZE.
+ * @return 0 on success, non-zero if a slab cannot hold a single object.
+ */
+int slab_pool_init(struct slab_pool *sp, size_t obj_size, size_t slab_size);
+
+/**
+ * @brief Releases every slab at once.
+ * @warning Every object allocated from the pool is invalidated, containers
+ * using the pool must be destroyed before.
+ */
+void slab_pool_deinit(struct slab_pool *sp);
+
+/** @} */ // End of Initialization & Deinitialization
+
+/**
+ * @name Allocator Concept
+ * Functions to pass into @ref allocator_concept with `.allocator = &pool`.
+ * @{
+ */
+
+/** @brief Pops a slot from the free list, or carves a new one. */
+void *slab_alloc(void *allocator);
+
+/** @brief Pushes @p ptr back into the free list of the pool. */
+void slab_free(void *allocator, void *ptr);
+
+/** @} */ // End of Allocator Concept
+
+/** @} */ // End of SLAB_POOL group
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // UTILS_SLAB_POOL_H
@@ -0,0 +1,54 @@
+#ifndef UTILS_STATS_H
+#define UTILS_STATS_H
+
+#include <stddef.h>
+#include <string.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @file stats.h
+ * @brief Defines the compile-time switch for hot path event counters.
+ */
+
+/**
+ * @defgroup DS_STATS Event Counters
+ * @ingroup UTILS
+ * @brief Per-instance counters of what containers do internally.
+ *
+ * @details
+ * Build the library and your code with `-DDS_STATS` (`make STATS=1` after a
+ * `make clean`) to get a `stats` member in the instrumented containers:
+ * - @ref hash_table_stats: probe length histogram and resizes, thru @ref hash_table_get_stats.
+ * - @ref avl_stats: left and right rotations, `tree.stats`.
+ * - @ref Btree_stats: splits, merges and borrows, `tree.stats`.
+ * - @ref trie_stats: node allocations, `tr.stats`.
+ * - @ref dynarray_stats: buffer reallocations, `arr.stats`.
+ *
+ * Without the flag neither the members nor the increments exist, so they cost
+ * nothing. The flag changes struct layouts, the library and its users must agree on it.
+ * @{
+ */
+
+#ifdef DS_STATS
+    /** @brief Declares a stats member, only if DS_STATS is defined. */
+    #define DS_STATS_FIELD(type, name) type name;
+    /** @brief Increments a counter, only if DS_STATS is defined. */
+    #define DS_STATS_INC(counter) ((counter)++)
+    /** @brief Zeroes a stats member, only if DS_STATS is defined. */
+    #define DS_STATS_RESET(stats) memset(&(stats), 0, sizeof(stats))
+#else
+    #define DS_STATS_FIELD(type, name)
+    #define DS_STATS_INC(counter) ((void) 0)
+    #define DS_STATS_RESET(stats) ((void) 0)
+#endif // DS_STATS
+
+/** @} */ // End of DS_STATS group
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // UTILS_STATS_H
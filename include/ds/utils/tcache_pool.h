@@ -0,0 +1,102 @@
+#ifndef UTILS_TCACHE_POOL_H
+#define UTILS_TCACHE_POOL_H
+
+#include "allocator_concept.h"
+#include "slab_pool.h"
+#include <pthread.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @file tcache_pool.h
+ * @brief Defines the interface for thread-caching pool.
+ */
+
+/**
+ * @defgroup TCACHE_POOL Thread-Caching Pool
+ * @ingroup UTILS
+ * @brief Per-thread magazines in front of a shared @ref SLAB_POOL.
+ *
+ * @details
+ * Every thread touching the pool gets a small magazine of free slots. Allocations
+ * and frees only touch the magazine of the calling thread; an empty magazine is
+ * refilled and a full one is flushed in batches of @ref TCACHE_BATCH_SIZE slots
+ * from/to the shared depot, which is the only place a lock is taken. Slots might
+ * be freed by a different thread than the one that allocated them.
+ *
+ * Plug it into @ref allocator_concept with `.allocator = &pool`, `.alloc = tcache_alloc`
+ * and `.free = tcache_free`; lqueue, lstack, Btree and trie use it unchanged.
+ *
+ * ### Global Constraints
+ * - **NULL Pointers**: All `struct tcache_pool *tp` must be non-NULL nor invalid.
+ * - **Lifetime**: @ref tcache_pool_deinit must be called after every thread stopped
+ * using the pool.
+ * @{
+ */
+
+/** @brief Capacity of each per-thread magazine. */
+#define TCACHE_MAGAZINE_SIZE 64
+
+/** @brief Count of slots moved between a magazine and the depot at once. */
+#define TCACHE_BATCH_SIZE (TCACHE_MAGAZINE_SIZE / 2)
+
+struct tcache;
+
+/**
+ * @struct tcache_pool
+ * @brief Pool state, stack allocatable but must not be moved after init.
+ */
+struct tcache_pool {
+    struct slab_pool        depot;      ///< Shared slab pool, guarded by lock.
+    pthread_mutex_t         lock;       ///< Guards depot and caches.
+    pthread_key_t           key;        ///< Maps threads to their magazines.
+    struct tcache           *caches;    ///< Magazines of the threads alive, to release on deinit.
+};
+
+/**
+ * @name Initialization & Deinitialization
+ * @{
+ */
+
+/**
+ * @brief Initializes the pool.
+ * @param[in, out] tp Pointer to the pool instance.
+ * @param[in] obj_size Size of the objects to be allocated, cannot be zero.
+ * @param[in] slab_size Size of the slabs of the depot, 0 for the default.
+ * @return 0 on success, non-zero otherwise.
+ * @see slab_pool_init
+ */
+int tcache_pool_init(struct tcache_pool *tp, size_t obj_size, size_t slab_size);
+
+/**
+ * @brief Releases every magazine and slab.
+ * @warning Every object allocated from the pool is invalidated.
+ */
+void tcache_pool_deinit(struct tcache_pool *tp);
+
+/** @} */ // End of Initialization & Deinitialization
+
+/**
+ * @name Allocator Concept
+ * Functions to pass into @ref allocator_concept with `.allocator = &pool`.
+ * @{
+ */
+
+/** @brief Pops a slot from the magazine of the calling thread. */
+void *tcache_alloc(void *allocator);
+
+/** @brief Pushes @p ptr into the magazine of the calling thread. */
+void tcache_free(void *allocator, void *ptr);
+
+/** @} */ // End of Allocator Concept
+
+/** @} */ // End of TCACHE_POOL group
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // UTILS_TCACHE_POOL_H
@@ -0,0 +1,102 @@
+#ifndef UTILS_THREAD_POOL_H
+#define UTILS_THREAD_POOL_H
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @file thread_pool.h
+ * @brief Defines the interface for work-stealing thread pool.
+ */
+
+/**
+ * @defgroup THREAD_POOL Thread Pool
+ * @ingroup UTILS
+ * @brief Fork-join thread pool, each worker owning a deque of tasks.
+ *
+ * @details
+ * Tasks submitted by a worker go to the back of its own deque and are taken back LIFO,
+ * idle workers steal from the front of the other deques. Tasks submitted from outside
+ * the pool go to a shared queue. Tasks are tracked by a @ref thread_pool_group, and
+ * @ref thread_pool_wait runs pending tasks before blocking, so tasks may submit and
+ * wait for subtasks themselves. With nothing left to steal it yields for a few rounds,
+ * then sleeps until the group finishes or a new task is queued.
+ *
+ * ### Global Constraints
+ * - **NULL Pointers**: All `struct thread_pool *pool` and groups must be non-NULL nor invalid.
+ * - **Lifetime**: Every group must be waited before @ref thread_pool_destroy is called.
+ * @{
+ */
+
+struct thread_pool;
+
+/** @brief Task signature, @p arg is passed as given to @ref thread_pool_submit. */
+typedef void (*thread_pool_task) (void *arg);
+
+/**
+ * @struct thread_pool_group
+ * @brief Counts unfinished tasks of a fork-join scope, stack allocatable.
+ */
+struct thread_pool_group {
+    size_t                  pending;    ///< Tasks submitted but not finished yet, accessed atomically.
+};
+
+/**
+ * @name Create & Destroy
+ * @{
+ */
+
+/**
+ * @brief Creates a pool and starts its workers.
+ * @param[in] threads Count of workers, 0 for the count of online CPUs.
+ * @return Pointer to the pool, NULL on failure.
+ * @note Threads waiting on a group help the workers, so a pool of one worker
+ * still runs tasks on two threads while the submitter waits.
+ */
+struct thread_pool *thread_pool_create(size_t threads);
+
+/**
+ * @brief Stops the workers and frees the pool.
+ */
+void thread_pool_destroy(struct thread_pool *pool);
+
+/** @return Count of workers. */
+size_t thread_pool_size(const struct thread_pool *pool);
+
+/** @} */ // End of Create & Destroy
+
+/**
+ * @name Tasks
+ * @{
+ */
+
+/** @brief Initializes an empty group. */
+static inline void thread_pool_group_init(struct thread_pool_group *group)
+{
+    group->pending = 0;
+}
+
+/**
+ * @brief Schedules @p task to run with @p arg as a member of @p group.
+ * @return 0 on success, non-zero if the task could not be queued.
+ */
+int thread_pool_submit(struct thread_pool *pool, struct thread_pool_group *group, thread_pool_task task, void *arg);
+
+/**
+ * @brief Returns once every task of @p group finished, running queued tasks meanwhile.
+ * @note Blocks without spinning while the remaining tasks run on other threads.
+ */
+void thread_pool_wait(struct thread_pool *pool, struct thread_pool_group *group);
+
+/** @} */ // End of Tasks
+
+/** @} */ // End of THREAD_POOL group
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // UTILS_THREAD_POOL_H
@@ -0,0 +1,407 @@
+#include <ds/arrays/array_kernels.h>
+#include <ds/utils/debug.h>
+#include <stdatomic.h>
+#include <stdint.h>
+#include <string.h>
+#include <assert.h>
+
+/**
+ * Helper functions declarations and macro definitions
+ */
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define ARRAY_KERNELS_X86 1
+#endif
+
+// Kernels get raw buffers, array functions check types and emptiness before dispatching
+typedef size_t (*search_kernel) (const void *buffer, size_t size, const void *value);
+typedef void (*reduce_kernel) (const void *buffer, size_t size, void *result);
+
+struct kernel_table {
+    search_kernel   find[ARRAY_TYPE_COUNT];
+    search_kernel   count[ARRAY_TYPE_COUNT];
+    reduce_kernel   min[ARRAY_TYPE_COUNT];     // Size is non-zero
+    reduce_kernel   max[ARRAY_TYPE_COUNT];     // Size is non-zero
+    reduce_kernel   sum[ARRAY_TYPE_COUNT];
+};
+
+// Vector counters are flushed before 8-bit lanes can overflow
+#define COUNT_FLUSH_INTERVAL 127
+
+/*
+ * X(args, tag, element type, same width signed integer, sum accumulator)
+ * Integer sums are accumulated unsigned so they wrap instead of overflowing.
+ */
+#define FOR_EACH_TYPE(X, ...)                           \
+    X(__VA_ARGS__, i8,  int8_t,   int8_t,  uint64_t)    \
+    X(__VA_ARGS__, u8,  uint8_t,  int8_t,  uint64_t)    \
+    X(__VA_ARGS__, i16, int16_t,  int16_t, uint64_t)    \
+    X(__VA_ARGS__, u16, uint16_t, int16_t, uint64_t)    \
+    X(__VA_ARGS__, i32, int32_t,  int32_t, uint64_t)    \
+    X(__VA_ARGS__, u32, uint32_t, int32_t, uint64_t)    \
+    X(__VA_ARGS__, i64, int64_t,  int64_t, uint64_t)    \
+    X(__VA_ARGS__, u64, uint64_t, int64_t, uint64_t)    \
+    X(__VA_ARGS__, f32, float,    int32_t, double)      \
+    X(__VA_ARGS__, f64, double,   int64_t, double)
+
+#define KERNEL_ROW(isa, op)                                                 \
+    { isa##_##op##_i8, isa##_##op##_u8, isa##_##op##_i16, isa##_##op##_u16, \
+      isa##_##op##_i32, isa##_##op##_u32, isa##_##op##_i64, isa##_##op##_u64, \
+      isa##_##op##_f32, isa##_##op##_f64 }
+
+#define KERNEL_TABLE(isa)                                                   \
+    static const struct kernel_table isa##_table = {                        \
+        .find = KERNEL_ROW(isa, find),                                      \
+        .count = KERNEL_ROW(isa, count),                                    \
+        .min = KERNEL_ROW(isa, min),                                        \
+        .max = KERNEL_ROW(isa, max),                                        \
+        .sum = KERNEL_ROW(isa, sum),                                        \
+    };
+
+#define SCALAR_KERNELS(isa, tag, T, I, A)                                   \
+    static size_t isa##_find_##tag(const void *buffer, size_t size, const void *value) \
+    {                                                                       \
+        const T *p = (const T *) buffer;                                    \
+        T key;                                                              \
+        memcpy(&key, value, sizeof(key));                                   \
+        for (size_t i = 0; i < size; i++) {                                 \
+            if (p[i] == key)                                                \
+                return i;                                                   \
+        }                                                                   \
+        return size;                                                        \
+    }                                                                       \
+                                                                            \
+    static size_t isa##_count_##tag(const void *buffer, size_t size, const void *value) \
+    {                                                                       \
+        const T *p = (const T *) buffer;                                    \
+        T key;                                                              \
+        memcpy(&key, value, sizeof(key));                                   \
+        size_t total = 0;                                                   \
+        for (size_t i = 0; i < size; i++)                                   \
+            total += p[i] == key;                                           \
+        return total;                                                       \
+    }                                                                       \
+                                                                            \
+    static void isa##_min_##tag(const void *buffer, size_t size, void *result) \
+    {                                                                       \
+        const T *p = (const T *) buffer;                                    \
+        T best = p[0];                                                      \
+        for (size_t i = 1; i < size; i++) {                                 \
+            if (p[i] < best)                                                \
+                best = p[i];                                                \
+        }                                                                   \
+        memcpy(result, &best, sizeof(best));                                \
+    }                                                                       \
+                                                                            \
+    static void isa##_max_##tag(const void *buffer, size_t size, void *result) \
+    {                                                                       \
+        const T *p = (const T *) buffer;                                    \
+        T best = p[0];                                                      \
+        for (size_t i = 1; i < size; i++) {                                 \
+            if (p[i] > best)                                                \
+                best = p[i];                                                \
+        }                                                                   \
+        memcpy(result, &best, sizeof(best));                                \
+    }                                                                       \
+                                                                            \
+    static void isa##_sum_##tag(const void *buffer, size_t size, void *result) \
+    {                                                                       \
+        const T *p = (const T *) buffer;                                    \
+        A total = 0;                                                        \
+        for (size_t i = 0; i < size; i++)                                   \
+            total += (A) p[i];                                              \
+        memcpy(result, &total, sizeof(total));                              \
+    }
+
+/*
+ * Same kernels over GCC vector extensions of VB bytes, compiled for the instruction set
+ * in ATTR. Full vectors are handled in lanes, the tail falls back to the scalar loop.
+ * Vectors are loaded with memcpy since buffers are only aligned to their elements.
+ */
+#define VECTOR_KERNELS(isa, ATTR, VB, tag, T, I, A)                         \
+    typedef T isa##_##tag##_vec __attribute__((vector_size(VB)));           \
+    typedef I isa##_##tag##_mask __attribute__((vector_size(VB)));          \
+    typedef uint64_t isa##_##tag##_bits __attribute__((vector_size(VB)));   \
+    typedef A isa##_##tag##_acc __attribute__((vector_size(VB)));           \
+    typedef T isa##_##tag##_part __attribute__((vector_size(VB / sizeof(A) * sizeof(T)))); \
+                                                                            \
+    ATTR static size_t isa##_find_##tag(const void *buffer, size_t size, const void *value) \
+    {                                                                       \
+        const T *p = (const T *) buffer;                                    \
+        const size_t lanes = VB / sizeof(T);                                \
+        T key;                                                              \
+        memcpy(&key, value, sizeof(key));                                   \
+        isa##_##tag##_vec keys;                                             \
+        for (size_t j = 0; j < lanes; j++)                                  \
+            keys[j] = key;                                                  \
+        size_t i = 0;                                                       \
+        for (; i + lanes <= size; i += lanes) {                             \
+            isa##_##tag##_vec v;                                            \
+            memcpy(&v, p + i, VB);                                          \
+            isa##_##tag##_bits hits = (isa##_##tag##_bits) (v == keys);     \
+            uint64_t any = 0;                                               \
+            for (size_t j = 0; j < VB / sizeof(uint64_t); j++)              \
+                any |= hits[j];                                             \
+            if (any)                                                        \
+                break;                                                      \
+        }                                                                   \
+        for (; i < size; i++) {                                             \
+            if (p[i] == key)                                                \
+                return i;                                                   \
+        }                                                                   \
+        return size;                                                        \
+    }                                                                       \
+                                                                            \
+    ATTR static size_t isa##_count_##tag(const void *buffer, size_t size, const void *value) \
+    {                                                                       \
+        const T *p = (const T *) buffer;                                    \
+        const size_t lanes = VB / sizeof(T);                                \
+        T key;                                                              \
+        memcpy(&key, value, sizeof(key));                                   \
+        isa##_##tag##_vec keys;                                             \
+        for (size_t j = 0; j < lanes; j++)                                  \
+            keys[j] = key;                                                  \
+        isa##_##tag##_mask hits = { 0 };                                    \
+        size_t total = 0, pending = 0, i = 0;                               \
+        for (; i + lanes <= size; i += lanes) {                             \
+            isa##_##tag##_vec v;                                            \
+            memcpy(&v, p + i, VB);                                          \
+            /* Matching lanes are -1 */                                     \
+            hits += (isa##_##tag##_mask) (v == keys);                       \
+            if (++pending == COUNT_FLUSH_INTERVAL || i + 2 * lanes > size) { \
+                for (size_t j = 0; j < lanes; j++)                          \
+                    total += (size_t) -(int64_t) hits[j];                   \
+                hits = (isa##_##tag##_mask) { 0 };                          \
+                pending = 0;                                                \
+            }                                                               \
+        }                                                                   \
+        for (; i < size; i++)                                               \
+            total += p[i] == key;                                           \
+        return total;                                                       \
+    }                                                                       \
+                                                                            \
+    ATTR static void isa##_min_##tag(const void *buffer, size_t size, void *result) \
+    {                                                                       \
+        const T *p = (const T *) buffer;                                    \
+        const size_t lanes = VB / sizeof(T);                                \
+        if (size < lanes) {                                                 \
+            scalar_min_##tag(buffer, size, result);                         \
+            return;                                                         \
+        }                                                                   \
+        isa##_##tag##_vec best;                                             \
+        memcpy(&best, p, VB);                                               \
+        size_t i = lanes;                                                   \
+        for (; i + lanes <= size; i += lanes) {                             \
+            isa##_##tag##_vec v;                                            \
+            memcpy(&v, p + i, VB);                                          \
+            isa##_##tag##_mask take = (isa##_##tag##_mask) (v < best);      \
+            best = (isa##_##tag##_vec) (((isa##_##tag##_mask) v & take)     \
+                                        | ((isa##_##tag##_mask) best & ~take)); \
+        }                                                                   \
+        T lowest = best[0];                                                 \
+        for (size_t j = 1; j < lanes; j++) {                                \
+            if (best[j] < lowest)                                           \
+                lowest = best[j];                                           \
+        }                                                                   \
+        for (; i < size; i++) {                                             \
+            if (p[i] < lowest)                                              \
+                lowest = p[i];                                              \
+        }                                                                   \
+        memcpy(result, &lowest, sizeof(lowest));                            \
+    }                                                                       \
+                                                                            \
+    ATTR static void isa##_max_##tag(const void *buffer, size_t size, void *result) \
+    {                                                                       \
+        const T *p = (const T *) buffer;                                    \
+        const size_t lanes = VB / sizeof(T);                                \
+        if (size < lanes) {                                                 \
+            scalar_max_##tag(buffer, size, result);                         \
+            return;                                                         \
+        }                                                                   \
+        isa##_##tag##_vec best;                                             \
+        memcpy(&best, p, VB);                                               \
+        size_t i = lanes;                                                   \
+        for (; i + lanes <= size; i += lanes) {                             \
+            isa##_##tag##_vec v;                                            \
+            memcpy(&v, p + i, VB);                                          \
+            isa##_##tag##_mask take = (isa##_##tag##_mask) (v > best);      \
+            best = (isa##_##tag##_vec) (((isa##_##tag##_mask) v & take)     \
+                                        | ((isa##_##tag##_mask) best & ~take)); \
+        }                                                                   \
+        T highest = best[0];                                                \
+        for (size_t j = 1; j < lanes; j++) {                                \
+            if (best[j] > highest)                                          \
+                highest = best[j];                                          \
+        }                                                                   \
+        for (; i < size; i++) {                                             \
+            if (p[i] > highest)                                             \
+                highest = p[i];                                             \
+        }                                                                   \
+        memcpy(result, &highest, sizeof(highest));                          \
+    }                                                                       \
+                                                                            \
+    ATTR static void isa##_sum_##tag(const void *buffer, size_t size, void *result) \
+    {                                                                       \
+        const T *p = (const T *) buffer;                                    \
+        const size_t lanes = VB / sizeof(T);                                \
+        const size_t wide_lanes = VB / sizeof(A);                           \
+        isa##_##tag##_acc partial = { 0 };                                  \
+        size_t i = 0;                                                       \
+        for (; i + lanes <= size; i += lanes) {                             \
+            /* Widened part by part, so each conversion is a single instruction */ \
+            for (size_t k = 0; k < lanes; k += wide_lanes) {                \
+                isa##_##tag##_part v;                                       \
+                memcpy(&v, p + i + k, sizeof(v));                           \
+                partial += __builtin_convertvector(v, isa##_##tag##_acc);   \
+            }                                                               \
+        }                                                                   \
+        A total = 0;                                                        \
+        for (size_t j = 0; j < wide_lanes; j++)                             \
+            total += partial[j];                                            \
+        for (; i < size; i++)                                               \
+            total += (A) p[i];                                              \
+        memcpy(result, &total, sizeof(total));                              \
+    }
+
+static const char *isa_names[] = { "scalar", "sse2", "avx2", "avx512" };
+
+FOR_EACH_TYPE(SCALAR_KERNELS, scalar)
+KERNEL_TABLE(scalar)
+
+#ifdef ARRAY_KERNELS_X86
+FOR_EACH_TYPE(VECTOR_KERNELS, sse2, __attribute__((target("sse2"))), 16)
+KERNEL_TABLE(sse2)
+FOR_EACH_TYPE(VECTOR_KERNELS, avx2, __attribute__((target("avx2"))), 32)
+KERNEL_TABLE(avx2)
+FOR_EACH_TYPE(VECTOR_KERNELS, avx512, __attribute__((target("avx512f,avx512bw"))), 64)
+KERNEL_TABLE(avx512)
+#endif // ARRAY_KERNELS_X86
+
+// NULL until the first kernel call selects the widest supported instruction set
+static const struct kernel_table *_Atomic active_table;
+static _Atomic int active_isa;
+
+static const struct kernel_table *kernel_table_of(enum array_isa isa);
+static int isa_supported(enum array_isa isa);
+static const struct kernel_table *kernels(void);
+
+/* =========================================================================
+ * Search
+ * ========================================================================= */
+
+size_t array_find(const struct array *arr, enum array_type type, const void *value)
+{
+    assert(value != NULL && type < ARRAY_TYPE_COUNT);
+    assert(array_obj_size(arr) == array_type_size(type));
+    return kernels()->find[type](arr->buffer, array_size(arr), value);
+}
+
+size_t array_count(const struct array *arr, enum array_type type, const void *value)
+{
+    assert(value != NULL && type < ARRAY_TYPE_COUNT);
+    assert(array_obj_size(arr) == array_type_size(type));
+    return kernels()->count[type](arr->buffer, array_size(arr), value);
+}
+
+/* =========================================================================
+ * Reduction
+ * ========================================================================= */
+
+int array_min(const struct array *arr, enum array_type type, void *result)
+{
+    assert(result != NULL && type < ARRAY_TYPE_COUNT);
+    assert(array_obj_size(arr) == array_type_size(type));
+    if (array_size(arr) == 0)
+        return 1;
+    kernels()->min[type](arr->buffer, array_size(arr), result);
+    return 0;
+}
+
+int array_max(const struct array *arr, enum array_type type, void *result)
+{
+    assert(result != NULL && type < ARRAY_TYPE_COUNT);
+    assert(array_obj_size(arr) == array_type_size(type));
+    if (array_size(arr) == 0)
+        return 1;
+    kernels()->max[type](arr->buffer, array_size(arr), result);
+    return 0;
+}
+
+void array_sum(const struct array *arr, enum array_type type, void *result)
+{
+    assert(result != NULL && type < ARRAY_TYPE_COUNT);
+    assert(array_obj_size(arr) == array_type_size(type));
+    kernels()->sum[type](arr->buffer, array_size(arr), result);
+}
+
+/* =========================================================================
+ * Dispatch
+ * ========================================================================= */
+
+enum array_isa array_kernels_isa(void)
+{
+    kernels();
+    return (enum array_isa) atomic_load_explicit(&active_isa, memory_order_relaxed);
+}
+
+int array_kernels_set_isa(enum array_isa isa)
+{
+    if (!isa_supported(isa)) {
+        LOG(LIB_LVL, CWARNING, "Instruction set %s is not supported", array_isa_name(isa));
+        return 1;
+    }
+    atomic_store_explicit(&active_isa, isa, memory_order_relaxed);
+    atomic_store_explicit(&active_table, kernel_table_of(isa), memory_order_release);
+    return 0;
+}
+
+const char *array_isa_name(enum array_isa isa)
+{
+    return ((size_t) isa < sizeof(isa_names) / sizeof(isa_names[0])) ? isa_names[isa] : "unknown";
+}
+
+// *** Helper functions definitions *** //
+
+static const struct kernel_table *kernel_table_of(enum array_isa isa)
+{
+    switch (isa) {
+#ifdef ARRAY_KERNELS_X86
+        case ARRAY_ISA_SSE2: return &sse2_table;
+        case ARRAY_ISA_AVX2: return &avx2_table;
+        case ARRAY_ISA_AVX512: return &avx512_table;
+#endif // ARRAY_KERNELS_X86
+        default: return &scalar_table;
+    }
+}
+
+static int isa_supported(enum array_isa isa)
+{
+    if (isa == ARRAY_ISA_SCALAR)
+        return 1;
+#ifdef ARRAY_KERNELS_X86
+    __builtin_cpu_init();
+    switch (isa) {
+        case ARRAY_ISA_SSE2: return __builtin_cpu_supports("sse2");
+        case ARRAY_ISA_AVX2: return __builtin_cpu_supports("avx2");
+        case ARRAY_ISA_AVX512: return __builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw");
+        default: return 0;
+    }
+#else
+    return 0;
+#endif // ARRAY_KERNELS_X86
+}
+
+// Racing first calls select the same table, so a plain store is enough
+static const struct kernel_table *kernels(void)
+{
+    const struct kernel_table *table = atomic_load_explicit(&active_table, memory_order_acquire);
+    if (table)
+        return table;
+    enum array_isa isa = ARRAY_ISA_AVX512;
+    while (isa != ARRAY_ISA_SCALAR && !isa_supported(isa))
+        isa--;
+    table = kernel_table_of(isa);
+    atomic_store_explicit(&active_isa, isa, memory_order_relaxed);
+    atomic_store_explicit(&active_table, table, memory_order_release);
+    return table;
+}
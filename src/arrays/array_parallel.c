@@ -0,0 +1,275 @@
+#include <ds/arrays/array_parallel.h>
+#include <ds/arrays/array_sort.h>
+#include <ds/utils/debug.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+
+/**
+ * Helper functions declarations and macro definitions
+ */
+
+// Ranges per thread when no grain is given, extras let fast threads steal from slow ones
+#define RANGES_PER_THREAD 4
+// Parallel sort splits into runs no smaller than this
+#define SORT_MIN_RUN 4096
+
+struct for_job {
+    struct array    range;
+    size_t          first;
+    void            *context;
+    void            (*body) (struct array *range, size_t first, void *context);
+};
+
+struct reduce_job {
+    struct array    range;
+    void            *partial;
+    void            *context;
+    void            (*map) (const struct array *range, void *partial, void *context);
+};
+
+struct sort_job {
+    struct array    range;
+    int             (*cmp) (const void *a, const void *b);
+};
+
+// Merges [a, a_end) and [b, b_end) into out
+struct merge_job {
+    const char      *a, *a_end;
+    const char      *b, *b_end;
+    char            *out;
+    size_t          size;
+    int             (*cmp) (const void *a, const void *b);
+};
+
+static size_t thread_count(const struct thread_pool *pool);
+static size_t range_count(const struct thread_pool *pool, size_t count, size_t grain);
+static void spawn(struct thread_pool *pool, struct thread_pool_group *group, thread_pool_task task, void *arg);
+static void join(struct thread_pool *pool, struct thread_pool_group *group);
+static void for_task(void *arg);
+static void reduce_task(void *arg);
+static void sort_task(void *arg);
+static void merge_task(void *arg);
+static size_t lower_bound(const char *base, size_t begin, size_t end, const void *key, size_t size,
+                          int (*cmp) (const void *a, const void *b));
+
+/* =========================================================================
+ * Loops & Reductions
+ * ========================================================================= */
+
+void array_parallel_for(struct thread_pool *pool, struct array *arr, size_t grain, void *context,
+                        void (*body) (struct array *range, size_t first, void *context))
+{
+    assert(arr != NULL && body != NULL);
+    size_t count = array_size(arr), ranges = range_count(pool, count, grain);
+    struct for_job *jobs = (pool && ranges > 1) ? malloc(ranges * sizeof(struct for_job)) : NULL;
+    if (!jobs) {
+        if (count)
+            body(arr, 0, context);
+        return;
+    }
+    struct thread_pool_group group;
+    thread_pool_group_init(&group);
+    for (size_t i = 0; i < ranges; i++) {
+        size_t first = count * i / ranges, last = count * (i + 1) / ranges;
+        jobs[i] = (struct for_job) { { array_iterator_at(arr, first), last - first, array_obj_size(arr) },
+                                     first, context, body };
+        spawn(pool, &group, for_task, &jobs[i]);
+    }
+    join(pool, &group);
+    free(jobs);
+}
+
+int array_parallel_reduce(struct thread_pool *pool, const struct array *arr, size_t grain,
+                          void *result, size_t result_size, void *context,
+                          void (*map) (const struct array *range, void *partial, void *context),
+                          void (*combine) (void *result, const void *partial, void *context))
+{
+    assert(arr != NULL && result != NULL && map != NULL && combine != NULL);
+    size_t count = array_size(arr), ranges = range_count(pool, count, grain);
+    if (ranges == 0)
+        return 0;
+    struct reduce_job *jobs = malloc(ranges * sizeof(struct reduce_job));
+    char *partials = malloc(ranges * result_size);
+    if (!jobs || !partials) {
+        LOG(LIB_LVL, CERROR, "Could not allocate partial results");
+        free(jobs);
+        free(partials);
+        return 1;
+    }
+    struct thread_pool_group group;
+    thread_pool_group_init(&group);
+    for (size_t i = 0; i < ranges; i++) {
+        size_t first = count * i / ranges, last = count * (i + 1) / ranges;
+        char *partial = partials + i * result_size;
+        memcpy(partial, result, result_size);
+        jobs[i] = (struct reduce_job) { { (char *) arr->buffer + first * array_obj_size(arr), last - first,
+                                          array_obj_size(arr) }, partial, context, map };
+        spawn(pool, &group, reduce_task, &jobs[i]);
+    }
+    join(pool, &group);
+    for (size_t i = 0; i < ranges; i++)
+        combine(result, partials + i * result_size, context);
+    free(jobs);
+    free(partials);
+    return 0;
+}
+
+/* =========================================================================
+ * Sorting
+ * ========================================================================= */
+
+int array_parallel_sort(struct thread_pool *pool, struct array *arr, int (*cmp) (const void *a, const void *b))
+{
+    assert(arr != NULL && cmp != NULL);
+    size_t count = array_size(arr), size = array_obj_size(arr);
+    size_t target = thread_count(pool) * RANGES_PER_THREAD;
+    size_t runs = (target < count / SORT_MIN_RUN) ? target : count / SORT_MIN_RUN;
+    if (!pool || runs <= 1) {
+        array_sort(arr, cmp);
+        return 0;
+    }
+    char *scratch = malloc(count * size);
+    size_t *bounds = malloc((runs + 1) * sizeof(size_t));
+    struct sort_job *sorts = malloc(runs * sizeof(struct sort_job));
+    // Every pair contributes at most one piece on top of its share of target
+    struct merge_job *merges = malloc((runs + target + 1) * sizeof(struct merge_job));
+    if (!scratch || !bounds || !sorts || !merges) {
+        LOG(LIB_LVL, CERROR, "Could not allocate the scratch copy");
+        free(scratch);
+        free(bounds);
+        free(sorts);
+        free(merges);
+        return 1;
+    }
+    struct thread_pool_group group;
+    thread_pool_group_init(&group);
+    for (size_t i = 0; i <= runs; i++)
+        bounds[i] = count * i / runs;
+    for (size_t i = 0; i < runs; i++) {
+        sorts[i] = (struct sort_job) { { array_iterator_at(arr, bounds[i]), bounds[i + 1] - bounds[i], size }, cmp };
+        spawn(pool, &group, sort_task, &sorts[i]);
+    }
+    join(pool, &group);
+    char *src = arr->buffer, *dst = scratch;
+    while (runs > 1) {
+        size_t jobs = 0;
+        for (size_t p = 0; p < runs; p += 2) {
+            size_t a0 = bounds[p], a1 = bounds[p + 1], b1 = (p + 1 < runs) ? bounds[p + 2] : a1;
+            // Piece k takes [ak, ak+1) of the left run and every right object in between their values
+            size_t pieces = 1 + (b1 - a0) * target / count;
+            size_t ak = a0, bk = a1;
+            for (size_t k = 1; k <= pieces; k++) {
+                size_t an = (k == pieces) ? a1 : a0 + (a1 - a0) * k / pieces;
+                size_t bn = (k == pieces) ? b1 : lower_bound(src, a1, b1, src + an * size, size, cmp);
+                merges[jobs] = (struct merge_job) { src + ak * size, src + an * size, src + bk * size,
+                                                    src + bn * size, dst + (ak + bk - a1) * size, size, cmp };
+                spawn(pool, &group, merge_task, &merges[jobs++]);
+                ak = an;
+                bk = bn;
+            }
+        }
+        join(pool, &group);
+        size_t merged = (runs + 1) / 2;
+        for (size_t i = 0; i < merged; i++)
+            bounds[i] = bounds[2 * i];
+        bounds[merged] = count;
+        runs = merged;
+        char *t = src;
+        src = dst;
+        dst = t;
+    }
+    if (src != arr->buffer)
+        memcpy(arr->buffer, src, count * size);
+    free(scratch);
+    free(bounds);
+    free(sorts);
+    free(merges);
+    return 0;
+}
+
+// *** Helper functions definitions *** //
+
+// Workers plus the calling thread
+static size_t thread_count(const struct thread_pool *pool)
+{
+    return pool ? thread_pool_size(pool) + 1 : 1;
+}
+
+static size_t range_count(const struct thread_pool *pool, size_t count, size_t grain)
+{
+    if (count == 0)
+        return 0;
+    if (grain == 0) {
+        size_t ranges = thread_count(pool) * RANGES_PER_THREAD;
+        grain = (count + ranges - 1) / ranges;
+    }
+    return (count + grain - 1) / grain;
+}
+
+// Runs the task inline when there is no pool or it cannot be queued
+static void spawn(struct thread_pool *pool, struct thread_pool_group *group, thread_pool_task task, void *arg)
+{
+    if (!pool || thread_pool_submit(pool, group, task, arg) != 0)
+        task(arg);
+}
+
+static void join(struct thread_pool *pool, struct thread_pool_group *group)
+{
+    if (pool)
+        thread_pool_wait(pool, group);
+}
+
+static void for_task(void *arg)
+{
+    struct for_job *job = arg;
+    job->body(&job->range, job->first, job->context);
+}
+
+static void reduce_task(void *arg)
+{
+    struct reduce_job *job = arg;
+    if (job->range.size)
+        job->map(&job->range, job->partial, job->context);
+}
+
+static void sort_task(void *arg)
+{
+    struct sort_job *job = arg;
+    array_sort(&job->range, job->cmp);
+}
+
+static void merge_task(void *arg)
+{
+    struct merge_job *job = arg;
+    const char *a = job->a, *b = job->b;
+    char *out = job->out;
+    while (a < job->a_end && b < job->b_end) {
+        // Left run wins ties
+        if (job->cmp(b, a) < 0) {
+            memcpy(out, b, job->size);
+            b += job->size;
+        } else {
+            memcpy(out, a, job->size);
+            a += job->size;
+        }
+        out += job->size;
+    }
+    memcpy(out, a, (size_t) (job->a_end - a));
+    out += job->a_end - a;
+    memcpy(out, b, (size_t) (job->b_end - b));
+}
+
+// Index of the first object in [begin, end) not less than key
+static size_t lower_bound(const char *base, size_t begin, size_t end, const void *key, size_t size,
+                          int (*cmp) (const void *a, const void *b))
+{
+    while (begin < end) {
+        size_t mid = begin + (end - begin) / 2;
+        if (cmp(base + mid * size, key) < 0)
+            begin = mid + 1;
+        else
+            end = mid;
+    }
+    return begin;
+}
@@ -0,0 +1,491 @@
+#include <ds/arrays/array_sort.h>
+#include <ds/utils/debug.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <assert.h>
+
+/**
+ * Helper functions declarations and macro definitions
+ */
+
+// Ranges smaller than this are insertion sorted
+#define INSERTION_SORT_THRESHOLD 24
+// Ranges larger than this pick the pivot as median of three medians
+#define NINTHER_THRESHOLD 128
+// Moves partial insertion sort may do before giving up on a nearly sorted range
+#define PARTIAL_INSERTION_SORT_LIMIT 8
+// Buckets smaller than this end the MSD radix recursion
+#define RADIX_INSERTION_THRESHOLD 32
+
+#define RADIX_BUCKETS 256
+
+struct sorter {
+    size_t  size;                                       // Object size
+    int     (*cmp) (const void *a, const void *b);
+    char    *tmp;                                       // Scratch object for swaps and shifts
+    char    *pivot;                                     // Pivot while partitioning
+};
+
+struct radix {
+    size_t          size;                               // Object size
+    size_t          offset;                             // Key offset inside an object
+    enum array_type type;
+};
+
+#define at(s, p, i) ((p) + (ptrdiff_t) (i) * (ptrdiff_t) (s)->size)
+#define less(s, a, b) ((s)->cmp((a), (b)) < 0)
+
+static void pdqsort_loop(const struct sorter *s, char *begin, char *end, int bad_allowed, int leftmost);
+static void insertion_sort(const struct sorter *s, char *begin, char *end);
+static void unguarded_insertion_sort(const struct sorter *s, char *begin, char *end);
+static int partial_insertion_sort(const struct sorter *s, char *begin, char *end);
+static char *partition_right(const struct sorter *s, char *begin, char *end, int *already_partitioned);
+static char *partition_left(const struct sorter *s, char *begin, char *end);
+static void heap_sort(const struct sorter *s, char *begin, char *end);
+static void sift_down(const struct sorter *s, char *base, size_t root, size_t count);
+static void sort3(const struct sorter *s, char *a, char *b, char *c);
+static void swap_objects(const struct sorter *s, char *a, char *b);
+static int log2_floor(size_t n);
+
+static uint64_t radix_key(const struct radix *r, const char *object);
+static int radix_lsd(const struct radix *r, char *buffer, size_t count);
+static void radix_msd(const struct radix *r, char *begin, size_t count, int digit);
+static void radix_insertion_sort(const struct radix *r, char *begin, size_t count, char *tmp);
+
+static inline void copy_object(void *dest, const void *src, size_t size)
+{
+    // Common sizes become single moves
+    switch (size) {
+        case 4: memcpy(dest, src, 4); break;
+        case 8: memcpy(dest, src, 8); break;
+        case 16: memcpy(dest, src, 16); break;
+        default: memcpy(dest, src, size); break;
+    }
+}
+
+/* =========================================================================
+ * Comparison Sort
+ * ========================================================================= */
+
+void array_sort(struct array *arr, int (*cmp) (const void *a, const void *b))
+{
+    assert(arr != NULL && cmp != NULL);
+    size_t count = array_size(arr);
+    if (count < 2)
+        return;
+    _Alignas(max_align_t) char scratch[2 * array_obj_size(arr)];
+    struct sorter s = { array_obj_size(arr), cmp, scratch, scratch + array_obj_size(arr) };
+    char *begin = arr->buffer;
+    pdqsort_loop(&s, begin, at(&s, begin, count), log2_floor(count), 1);
+}
+
+int array_is_sorted(const struct array *arr, int (*cmp) (const void *a, const void *b))
+{
+    assert(arr != NULL && cmp != NULL);
+    for (size_t i = 1; i < array_size(arr); i++) {
+        if (cmp(array_at(arr, i), array_at(arr, i - 1)) < 0)
+            return 0;
+    }
+    return 1;
+}
+
+/* =========================================================================
+ * Radix Sort
+ * ========================================================================= */
+
+int array_radix_sort(struct array *arr, size_t key_offset, enum array_type key_type, int stable)
+{
+    assert(arr != NULL && key_type < ARRAY_TYPE_COUNT);
+    assert(key_offset + array_type_size(key_type) <= array_obj_size(arr));
+    struct radix r = { array_obj_size(arr), key_offset, key_type };
+    if (array_size(arr) < 2)
+        return 0;
+    if (stable)
+        return radix_lsd(&r, arr->buffer, array_size(arr));
+    radix_msd(&r, arr->buffer, array_size(arr), (int) array_type_size(key_type) - 1);
+    return 0;
+}
+
+// *** Helper functions definitions *** //
+
+/*
+ * Pattern-defeating quicksort, after Orson Peters' pdqsort. Each round partitions around
+ * a median pivot and loops on the right part. Highly unbalanced partitions shuffle some
+ * objects to break patterns and use up bad_allowed, heapsort takes over once it is zero.
+ */
+static void pdqsort_loop(const struct sorter *s, char *begin, char *end, int bad_allowed, int leftmost)
+{
+    while (1) {
+        size_t size = (size_t) (end - begin) / s->size;
+        if (size < INSERTION_SORT_THRESHOLD) {
+            if (leftmost)
+                insertion_sort(s, begin, end);
+            else
+                unguarded_insertion_sort(s, begin, end);
+            return;
+        }
+        size_t half = size / 2;
+        if (size > NINTHER_THRESHOLD) {
+            sort3(s, begin, at(s, begin, half), at(s, end, -1));
+            sort3(s, at(s, begin, 1), at(s, begin, half - 1), at(s, end, -2));
+            sort3(s, at(s, begin, 2), at(s, begin, half + 1), at(s, end, -3));
+            sort3(s, at(s, begin, half - 1), at(s, begin, half), at(s, begin, half + 1));
+            swap_objects(s, begin, at(s, begin, half));
+        } else {
+            sort3(s, at(s, begin, half), begin, at(s, end, -1));
+        }
+        // Object before the range is a previous pivot, if it equals this one all equals go left
+        if (!leftmost && !less(s, at(s, begin, -1), begin)) {
+            begin = at(s, partition_left(s, begin, end), 1);
+            continue;
+        }
+        int already_partitioned;
+        char *pivot = partition_right(s, begin, end, &already_partitioned);
+        size_t left = (size_t) (pivot - begin) / s->size;
+        size_t right = (size_t) (end - pivot) / s->size - 1;
+        if (left < size / 8 || right < size / 8) {
+            if (--bad_allowed == 0) {
+                heap_sort(s, begin, end);
+                return;
+            }
+            if (left >= INSERTION_SORT_THRESHOLD) {
+                swap_objects(s, begin, at(s, begin, left / 4));
+                swap_objects(s, at(s, pivot, -1), at(s, pivot, -(ptrdiff_t) (left / 4)));
+                if (left > NINTHER_THRESHOLD) {
+                    swap_objects(s, at(s, begin, 1), at(s, begin, left / 4 + 1));
+                    swap_objects(s, at(s, begin, 2), at(s, begin, left / 4 + 2));
+                    swap_objects(s, at(s, pivot, -2), at(s, pivot, -(ptrdiff_t) (left / 4 + 1)));
+                    swap_objects(s, at(s, pivot, -3), at(s, pivot, -(ptrdiff_t) (left / 4 + 2)));
+                }
+            }
+            if (right >= INSERTION_SORT_THRESHOLD) {
+                swap_objects(s, at(s, pivot, 1), at(s, pivot, 1 + right / 4));
+                swap_objects(s, at(s, end, -1), at(s, end, -(ptrdiff_t) (right / 4)));
+                if (right > NINTHER_THRESHOLD) {
+                    swap_objects(s, at(s, pivot, 2), at(s, pivot, 2 + right / 4));
+                    swap_objects(s, at(s, pivot, 3), at(s, pivot, 3 + right / 4));
+                    swap_objects(s, at(s, end, -2), at(s, end, -(ptrdiff_t) (1 + right / 4)));
+                    swap_objects(s, at(s, end, -3), at(s, end, -(ptrdiff_t) (2 + right / 4)));
+                }
+            }
+        } else if (already_partitioned && partial_insertion_sort(s, begin, pivot)
+                   && partial_insertion_sort(s, at(s, pivot, 1), end)) {
+            // Sorted or nearly sorted input
+            return;
+        }
+        pdqsort_loop(s, begin, pivot, bad_allowed, leftmost);
+        begin = at(s, pivot, 1);
+        leftmost = 0;
+    }
+}
+
+static void insertion_sort(const struct sorter *s, char *begin, char *end)
+{
+    if (begin == end)
+        return;
+    for (char *cur = at(s, begin, 1); cur != end; cur = at(s, cur, 1)) {
+        char *sift = cur;
+        if (!less(s, cur, at(s, cur, -1)))
+            continue;
+        copy_object(s->tmp, cur, s->size);
+        do {
+            copy_object(sift, at(s, sift, -1), s->size);
+            sift = at(s, sift, -1);
+        } while (sift != begin && less(s, s->tmp, at(s, sift, -1)));
+        copy_object(sift, s->tmp, s->size);
+    }
+}
+
+// Object before begin is not greater than any object in the range, so it stops the shifts
+static void unguarded_insertion_sort(const struct sorter *s, char *begin, char *end)
+{
+    if (begin == end)
+        return;
+    for (char *cur = at(s, begin, 1); cur != end; cur = at(s, cur, 1)) {
+        char *sift = cur;
+        if (!less(s, cur, at(s, cur, -1)))
+            continue;
+        copy_object(s->tmp, cur, s->size);
+        do {
+            copy_object(sift, at(s, sift, -1), s->size);
+            sift = at(s, sift, -1);
+        } while (less(s, s->tmp, at(s, sift, -1)));
+        copy_object(sift, s->tmp, s->size);
+    }
+}
+
+// Returns 0 if more than PARTIAL_INSERTION_SORT_LIMIT objects were moved, range is then unsorted
+static int partial_insertion_sort(const struct sorter *s, char *begin, char *end)
+{
+    if (begin == end)
+        return 1;
+    size_t moves = 0;
+    for (char *cur = at(s, begin, 1); cur != end; cur = at(s, cur, 1)) {
+        char *sift = cur;
+        if (!less(s, cur, at(s, cur, -1)))
+            continue;
+        copy_object(s->tmp, cur, s->size);
+        do {
+            copy_object(sift, at(s, sift, -1), s->size);
+            sift = at(s, sift, -1);
+        } while (sift != begin && less(s, s->tmp, at(s, sift, -1)));
+        copy_object(sift, s->tmp, s->size);
+        moves += (size_t) (cur - sift) / s->size;
+        if (moves > PARTIAL_INSERTION_SORT_LIMIT)
+            return 0;
+    }
+    return 1;
+}
+
+// Partitions around *begin, objects equal to the pivot go right. Returns the final pivot position.
+static char *partition_right(const struct sorter *s, char *begin, char *end, int *already_partitioned)
+{
+    copy_object(s->pivot, begin, s->size);
+    char *first = begin, *last = end;
+    // Median of three guarantees an object not less than the pivot, no bound checks needed
+    do {
+        first = at(s, first, 1);
+    } while (less(s, first, s->pivot));
+    if (at(s, first, -1) == begin) {
+        do {
+            last = at(s, last, -1);
+        } while (first < last && !less(s, last, s->pivot));
+    } else {
+        do {
+            last = at(s, last, -1);
+        } while (!less(s, last, s->pivot));
+    }
+    *already_partitioned = first >= last;
+    while (first < last) {
+        swap_objects(s, first, last);
+        do {
+            first = at(s, first, 1);
+        } while (less(s, first, s->pivot));
+        do {
+            last = at(s, last, -1);
+        } while (!less(s, last, s->pivot));
+    }
+    char *pivot = at(s, first, -1);
+    copy_object(begin, pivot, s->size);
+    copy_object(pivot, s->pivot, s->size);
+    return pivot;
+}
+
+// Partitions around *begin, objects equal to the pivot go left. Used when many equal objects exist.
+static char *partition_left(const struct sorter *s, char *begin, char *end)
+{
+    copy_object(s->pivot, begin, s->size);
+    char *first = begin, *last = end;
+    do {
+        last = at(s, last, -1);
+    } while (less(s, s->pivot, last));
+    if (at(s, last, 1) == end) {
+        do {
+            first = at(s, first, 1);
+        } while (first < last && !less(s, s->pivot, first));
+    } else {
+        do {
+            first = at(s, first, 1);
+        } while (!less(s, s->pivot, first));
+    }
+    while (first < last) {
+        swap_objects(s, first, last);
+        do {
+            last = at(s, last, -1);
+        } while (less(s, s->pivot, last));
+        do {
+            first = at(s, first, 1);
+        } while (!less(s, s->pivot, first));
+    }
+    copy_object(begin, last, s->size);
+    copy_object(last, s->pivot, s->size);
+    return last;
+}
+
+static void heap_sort(const struct sorter *s, char *begin, char *end)
+{
+    size_t count = (size_t) (end - begin) / s->size;
+    for (size_t i = count / 2; i-- > 0; )
+        sift_down(s, begin, i, count);
+    for (size_t i = count - 1; i > 0; i--) {
+        swap_objects(s, begin, at(s, begin, i));
+        sift_down(s, begin, 0, i);
+    }
+}
+
+static void sift_down(const struct sorter *s, char *base, size_t root, size_t count)
+{
+    while (2 * root + 1 < count) {
+        size_t child = 2 * root + 1;
+        if (child + 1 < count && less(s, at(s, base, child), at(s, base, child + 1)))
+            child++;
+        if (!less(s, at(s, base, root), at(s, base, child)))
+            return;
+        swap_objects(s, at(s, base, root), at(s, base, child));
+        root = child;
+    }
+}
+
+static void sort3(const struct sorter *s, char *a, char *b, char *c)
+{
+    if (less(s, b, a))
+        swap_objects(s, a, b);
+    if (less(s, c, b))
+        swap_objects(s, b, c);
+    if (less(s, b, a))
+        swap_objects(s, a, b);
+}
+
+static void swap_objects(const struct sorter *s, char *a, char *b)
+{
+    copy_object(s->tmp, a, s->size);
+    copy_object(a, b, s->size);
+    copy_object(b, s->tmp, s->size);
+}
+
+static int log2_floor(size_t n)
+{
+    int log = 0;
+    while (n >>= 1)
+        log++;
+    return log;
+}
+
+// Maps the key into an unsigned integer with the same order
+static uint64_t radix_key(const struct radix *r, const char *object)
+{
+    const char *key = object + r->offset;
+    switch (r->type) {
+        case ARRAY_I8: { uint8_t k; memcpy(&k, key, 1); return (uint8_t) (k ^ 0x80u); }
+        case ARRAY_U8: { uint8_t k; memcpy(&k, key, 1); return k; }
+        case ARRAY_I16: { uint16_t k; memcpy(&k, key, 2); return (uint16_t) (k ^ 0x8000u); }
+        case ARRAY_U16: { uint16_t k; memcpy(&k, key, 2); return k; }
+        case ARRAY_I32: { uint32_t k; memcpy(&k, key, 4); return k ^ 0x80000000u; }
+        case ARRAY_U32: { uint32_t k; memcpy(&k, key, 4); return k; }
+        case ARRAY_I64: { uint64_t k; memcpy(&k, key, 8); return k ^ 0x8000000000000000ull; }
+        case ARRAY_U64: { uint64_t k; memcpy(&k, key, 8); return k; }
+        // Negative floats order reversed by their bits, flip all of them
+        case ARRAY_F32: { uint32_t k; memcpy(&k, key, 4); return k ^ ((k >> 31) ? 0xFFFFFFFFu : 0x80000000u); }
+        case ARRAY_F64: {
+            uint64_t k;
+            memcpy(&k, key, 8);
+            return k ^ ((k >> 63) ? 0xFFFFFFFFFFFFFFFFull : 0x8000000000000000ull);
+        }
+        default: return 0;
+    }
+}
+
+/*
+ * One counting pass builds the histograms of every digit, then each digit scatters the
+ * objects between the buffer and a scratch copy. Digits where every key agrees are skipped.
+ */
+static int radix_lsd(const struct radix *r, char *buffer, size_t count)
+{
+    size_t digits = array_type_size(r->type);
+    size_t (*histograms)[RADIX_BUCKETS] = calloc(digits, sizeof(*histograms));
+    char *scratch = malloc(count * r->size);
+    if (!histograms || !scratch) {
+        LOG(LIB_LVL, CERROR, "Could not allocate radix sort buffers");
+        free(histograms);
+        free(scratch);
+        return 1;
+    }
+    for (size_t i = 0; i < count; i++) {
+        uint64_t key = radix_key(r, buffer + i * r->size);
+        for (size_t d = 0; d < digits; d++)
+            histograms[d][(key >> (8 * d)) & 0xFF]++;
+    }
+    char *src = buffer, *dst = scratch;
+    for (size_t d = 0; d < digits; d++) {
+        size_t *histogram = histograms[d];
+        if (histogram[(radix_key(r, src) >> (8 * d)) & 0xFF] == count)
+            continue;
+        size_t offsets[RADIX_BUCKETS], sum = 0;
+        for (size_t b = 0; b < RADIX_BUCKETS; b++) {
+            offsets[b] = sum;
+            sum += histogram[b];
+        }
+        for (size_t i = 0; i < count; i++) {
+            const char *object = src + i * r->size;
+            size_t bucket = (radix_key(r, object) >> (8 * d)) & 0xFF;
+            copy_object(dst + offsets[bucket]++ * r->size, object, r->size);
+        }
+        char *t = src;
+        src = dst;
+        dst = t;
+    }
+    if (src != buffer)
+        memcpy(buffer, src, count * r->size);
+    free(histograms);
+    free(scratch);
+    return 0;
+}
+
+/*
+ * American flag sort: objects are swapped into their bucket for the digit, then every
+ * bucket is sorted by the next digit. Recursion depth is at most the key width.
+ */
+static void radix_msd(const struct radix *r, char *begin, size_t count, int digit)
+{
+    _Alignas(max_align_t) char tmp[r->size];
+    while (1) {
+        if (count < RADIX_INSERTION_THRESHOLD) {
+            radix_insertion_sort(r, begin, count, tmp);
+            return;
+        }
+        int shift = 8 * digit;
+        size_t histogram[RADIX_BUCKETS] = { 0 };
+        for (size_t i = 0; i < count; i++)
+            histogram[(radix_key(r, begin + i * r->size) >> shift) & 0xFF]++;
+        size_t heads[RADIX_BUCKETS], tails[RADIX_BUCKETS], sum = 0;
+        for (size_t b = 0; b < RADIX_BUCKETS; b++) {
+            heads[b] = sum;
+            sum += histogram[b];
+            tails[b] = sum;
+        }
+        // Every key shares this digit, go on with the next one without recursing
+        if (histogram[(radix_key(r, begin) >> shift) & 0xFF] != count) {
+            for (size_t b = 0; b < RADIX_BUCKETS; b++) {
+                while (heads[b] < tails[b]) {
+                    char *object = begin + heads[b] * r->size;
+                    size_t bucket = (radix_key(r, object) >> shift) & 0xFF;
+                    if (bucket == b) {
+                        heads[b]++;
+                        continue;
+                    }
+                    char *home = begin + heads[bucket]++ * r->size;
+                    copy_object(tmp, object, r->size);
+                    copy_object(object, home, r->size);
+                    copy_object(home, tmp, r->size);
+                }
+            }
+            if (digit > 0) {
+                for (size_t b = 0, start = 0; b < RADIX_BUCKETS; start += histogram[b++]) {
+                    if (histogram[b] > 1)
+                        radix_msd(r, begin + start * r->size, histogram[b], digit - 1);
+                }
+            }
+            return;
+        }
+        if (digit-- == 0)
+            return;
+    }
+}
+
+static void radix_insertion_sort(const struct radix *r, char *begin, size_t count, char *tmp)
+{
+    for (size_t i = 1; i < count; i++) {
+        char *cur = begin + i * r->size;
+        uint64_t key = radix_key(r, cur);
+        if (radix_key(r, cur - r->size) <= key)
+            continue;
+        copy_object(tmp, cur, r->size);
+        size_t j = i;
+        do {
+            copy_object(begin + j * r->size, begin + (j - 1) * r->size, r->size);
+            j--;
+        } while (j > 0 && radix_key(r, begin + (j - 1) * r->size) > key);
+        copy_object(begin + j * r->size, tmp, r->size);
+    }
+}
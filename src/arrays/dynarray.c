@@ -10,17 +10,33 @@
 #define ptr_add(ptr, bytes) ((void*)((char*)(ptr) + (bytes)))
 #define ptr_sub(ptr1, ptr2) ((size_t)((char*)(ptr1) - (char*)(ptr2)))
 
+// Alignment requested for the buffer, enough for any object type
+#define DYNARRAY_ALIGN _Alignof(max_align_t)
+
 static int dynarray_realloc(struct dynarray *arr, size_t new_capacity);
 static int dynarray_grow(struct dynarray *arr, size_t new_size);
+static void dynarray_copy_trivial(void *gap_start, void *begin, size_t byte_diff, int is_self_insert);
+static void dynarray_fill_trivial(void *dest, const void *value, size_t obj_size, size_t count);
+static void dynarray_shift(struct dynarray *arr, void *dest, void *src, size_t bytes);
+static void *inline_alloc(void *allocator, size_t size, size_t align);
+static void *inline_realloc(void *allocator, void *ptr, size_t old_size, size_t new_size, size_t align);
+static void inline_free(void *allocator, void *ptr, size_t size);
 
 /* =========================================================================
  * Initialization & Deinitialization
  * ========================================================================= */
 
 int dynarray_init(struct dynarray *arr, size_t capacity, size_t obj_size, struct object_concept oc)
+{
+    return dynarray_init_with(arr, capacity, obj_size, oc, NULL);
+}
+
+int dynarray_init_with(struct dynarray *arr, size_t capacity, size_t obj_size, struct object_concept oc,
+                       const struct sized_allocator_concept *sac)
 {
     assert(arr != NULL && capacity != 0);
-    void *buffer = malloc(capacity * obj_size);
+    arr->sac = (sac) ? *sac : sysallocator_sized();
+    void *buffer = arr->sac.alloc(arr->sac.allocator, capacity * obj_size, DYNARRAY_ALIGN);
     if (!buffer) {
         LOG(LIB_LVL, CERROR, "Failed to allocate memory for dynarray buffer");
         return 1;
@@ -30,24 +46,91 @@ int dynarray_init(struct dynarray *arr, size_t capacity, size_t obj_size, struct
     arr->base.size = 0;
     arr->base.obj_size = obj_size;
     arr->oc = oc;
+    arr->growth = dynarray_growth_double;
+    arr->growth_param = 0;
+    DS_STATS_RESET(arr->stats);
     return 0;
 }
 
+int dynarray_init_inline(struct dynarray *arr, struct dynarray_inline_storage *st, void *buffer,
+                         size_t capacity, size_t obj_size, struct object_concept oc)
+{
+    assert(st != NULL && buffer != NULL);
+    st->buffer = buffer;
+    st->size = capacity * obj_size;
+    st->in_use = 0;
+    struct sized_allocator_concept sac = { st, inline_alloc, inline_realloc, inline_free };
+    return dynarray_init_with(arr, capacity, obj_size, oc, &sac);
+}
+
 void dynarray_deinit(struct dynarray *arr)
 {
     assert(arr != NULL && arr->base.buffer != NULL);
     if (arr->base.buffer) {
         // Deinit all inner objects
-        for (size_t i = 0; i < arr->base.size; i++) {
-            void *item_ptr = &((char *) arr->base.buffer)[i * arr->base.obj_size];
-            if (arr->oc.deinit != NULL)
+        if (arr->oc.deinit != NULL) {
+            for (size_t i = 0; i < arr->base.size; i++) {
+                void *item_ptr = &((char *) arr->base.buffer)[i * arr->base.obj_size];
                 arr->oc.deinit(item_ptr);
+            }
         }
-        free(arr->base.buffer);
+        if (arr->sac.free)
+            arr->sac.free(arr->sac.allocator, arr->base.buffer, arr->capacity * arr->base.obj_size);
         arr->base.buffer = NULL;
     }
 }
 
+/* =========================================================================
+ * Growth Policies
+ * ========================================================================= */
+
+size_t dynarray_growth_double(size_t capacity, size_t required, size_t obj_size, size_t param)
+{
+    (void) obj_size;
+    (void) param;
+    size_t new_cap = (capacity) ? capacity : 1;
+    while (new_cap < required)
+        new_cap *= 2;
+    return new_cap;
+}
+
+size_t dynarray_growth_golden(size_t capacity, size_t required, size_t obj_size, size_t param)
+{
+    (void) obj_size;
+    (void) param;
+    size_t new_cap = capacity + capacity / 2 + 1;
+    return (new_cap < required) ? required : new_cap;
+}
+
+size_t dynarray_growth_size_class(size_t capacity, size_t required, size_t obj_size, size_t param)
+{
+    size_t granule = (param) ? param : 4096;
+    size_t bytes = dynarray_growth_golden(capacity, required, obj_size, 0) * obj_size;
+    if (bytes <= granule) {
+        size_t size_class = 16;
+        while (size_class < bytes)
+            size_class *= 2;
+        bytes = size_class;
+    } else {
+        bytes = (bytes + granule - 1) / granule * granule;
+    }
+    return bytes / obj_size;
+}
+
+size_t dynarray_growth_chunk(size_t capacity, size_t required, size_t obj_size, size_t param)
+{
+    (void) obj_size;
+    size_t chunk = (param) ? param : 1;
+    return capacity + (required - capacity + chunk - 1) / chunk * chunk;
+}
+
+void dynarray_set_growth(struct dynarray *arr, dynarray_growth_cb growth, size_t param)
+{
+    assert(arr != NULL && growth != NULL);
+    arr->growth = growth;
+    arr->growth_param = param;
+}
+
 /* =========================================================================
  * Insertion & Removal
  * ========================================================================= */
@@ -77,7 +160,12 @@ int dynarray_insert(struct dynarray *arr, size_t index, void *begin, void *end)
     void *dest_begin = gap_start;
     void *dest_end = ptr_add(dest_begin, byte_diff);
     size_t bytes_to_move = (dynarray_size(arr) - index) * arr->base.obj_size;
-    memmove(dest_end, dest_begin, bytes_to_move);
+    dynarray_shift(arr, dest_end, dest_begin, bytes_to_move);
+    if (object_concept_trivial(&arr->oc)) {
+        dynarray_copy_trivial(gap_start, begin, byte_diff, is_self_insert);
+        arr->base.size += obj_count;
+        return 0;
+    }
     while (dest_begin != dest_end) {
         if (is_self_insert && begin >= gap_start)
             begin = ptr_add(begin, byte_diff);
@@ -89,7 +177,7 @@ int dynarray_insert(struct dynarray *arr, size_t index, void *begin, void *end)
                 if (arr->oc.deinit != NULL)
                     arr->oc.deinit(dest_begin);
             }
-            memmove(dest_begin, dest_end, bytes_to_move);
+            dynarray_shift(arr, dest_begin, dest_end, bytes_to_move);
             dynarray_shrink_to_fit(arr);
             return 1;
         }
@@ -102,15 +190,46 @@ int dynarray_insert(struct dynarray *arr, size_t index, void *begin, void *end)
 
 int dynarray_push_back(struct dynarray *arr, void *new_data)
 {
+    // Spare capacity means no self-insert fix up is needed
+    if (object_concept_trivial(&arr->oc) && dynarray_size(arr) < arr->capacity) {
+        memcpy(dynarray_iterator_end(arr), new_data, arr->base.obj_size);
+        arr->base.size++;
+        return 0;
+    }
     void *end_ptr = ptr_add(new_data, arr->base.obj_size);
     return dynarray_insert(arr, dynarray_size(arr), new_data, end_ptr);
 }
 
+void *dynarray_emplace_back(struct dynarray *arr)
+{
+    assert(arr != NULL && arr->base.buffer != NULL);
+    if (dynarray_grow(arr, dynarray_size(arr) + 1) != 0)
+        return NULL;
+    return ptr_add(arr->base.buffer, arr->base.size++ * arr->base.obj_size);
+}
+
+void *dynarray_emplace_at(struct dynarray *arr, size_t index)
+{
+    assert(arr != NULL && arr->base.buffer != NULL);
+    assert(index <= dynarray_size(arr));
+    if (dynarray_grow(arr, dynarray_size(arr) + 1) != 0)
+        return NULL;
+    void *slot = ptr_add(arr->base.buffer, index * arr->base.obj_size);
+    dynarray_shift(arr, ptr_add(slot, arr->base.obj_size), slot, (dynarray_size(arr) - index) * arr->base.obj_size);
+    arr->base.size++;
+    return slot;
+}
+
 int dynarray_set(struct dynarray *arr, size_t index, void *value)
 {
     assert(arr != NULL && arr->base.buffer != NULL);
     assert(index < dynarray_size(arr));
     void *target = dynarray_iterator_at(arr, index);
+    if (object_concept_trivial(&arr->oc)) {
+        object_concept_deinit(&arr->oc, target);
+        memmove(target, value, arr->base.obj_size);
+        return 0;
+    }
     if (arr->oc.deinit != NULL)
         arr->oc.deinit(target);
     if (arr->oc.init(target, value) != 0) {
@@ -130,12 +249,13 @@ void dynarray_delete(struct dynarray *arr, size_t begin, size_t end)
     void *target_begin = dest;
     void *target_end = dynarray_iterator_at(arr, end);
     size_t bytes_to_move = (dynarray_size(arr) - end) * arr->base.obj_size;
-    while (target_begin != target_end) {
-        if (arr->oc.deinit != NULL)
+    if (arr->oc.deinit != NULL) {
+        while (target_begin != target_end) {
             arr->oc.deinit(target_begin);
-        target_begin = dynarray_iterator_next(arr, target_begin);
+            target_begin = dynarray_iterator_next(arr, target_begin);
+        }
     }
-    memmove(dest, target_end, bytes_to_move);
+    dynarray_shift(arr, dest, target_end, bytes_to_move);
     arr->base.size -= obj_count;
 }
 
@@ -146,6 +266,16 @@ void dynarray_pop_back(struct dynarray *arr)
     dynarray_delete(arr, dynarray_size(arr) - 1, dynarray_size(arr));
 }
 
+int dynarray_extract_back(struct dynarray *arr, void *dest)
+{
+    assert(arr != NULL && arr->base.buffer != NULL && dest != NULL);
+    if (dynarray_size(arr) == 0)
+        return 1;
+    object_concept_move(&arr->oc, dest, dynarray_back(arr), arr->base.obj_size);
+    arr->base.size--;
+    return 0;
+}
+
 /* =========================================================================
  * Capacity & Size
  * ========================================================================= */
@@ -181,6 +311,11 @@ int dynarray_resize(struct dynarray *arr, size_t new_size, void *default_val)
             return 1;
         void *iter = dynarray_iterator_at(arr, current_size);
         size_t items_to_add = new_size - current_size;
+        if (object_concept_trivial(&arr->oc)) {
+            dynarray_fill_trivial(iter, default_val, arr->base.obj_size, items_to_add);
+            arr->base.size = new_size;
+            return 0;
+        }
         for (size_t i = 0; i < items_to_add; ++i) {
             // If this operation to fail, then it cant fail after a
             // successfull operation, since they all take same def val?
@@ -236,13 +371,33 @@ void *dynarray_back(struct dynarray *arr)
 static int dynarray_realloc(struct dynarray *arr, size_t new_capacity)
 {
     assert(arr != NULL && arr->base.buffer != NULL);
-    char* new_buffer = realloc(arr->base.buffer, new_capacity * arr->base.obj_size);
+    // Capacity cannot be zero, see dynarray_init
+    if (new_capacity == 0)
+        new_capacity = 1;
+    // Objects with a relocator cannot be moved bitwise by the allocator
+    if (arr->oc.move != NULL) {
+        char *new_buffer = arr->sac.alloc(arr->sac.allocator, new_capacity * arr->base.obj_size, DYNARRAY_ALIGN);
+        if (!new_buffer) {
+            LOG(LIB_LVL, CERROR, "Allocation failed, could not grow the buffer");
+            return 1;
+        }
+        dynarray_shift(arr, new_buffer, arr->base.buffer, dynarray_size(arr) * arr->base.obj_size);
+        if (arr->sac.free)
+            arr->sac.free(arr->sac.allocator, arr->base.buffer, arr->capacity * arr->base.obj_size);
+        arr->base.buffer = new_buffer;
+        arr->capacity = new_capacity;
+        DS_STATS_INC(arr->stats.reallocs);
+        return 0;
+    }
+    char* new_buffer = sized_realloc(&arr->sac, arr->base.buffer, arr->capacity * arr->base.obj_size,
+                                     new_capacity * arr->base.obj_size, DYNARRAY_ALIGN);
     if (!new_buffer) {
         LOG(LIB_LVL, CERROR, "Reallocation failed, could not grow the buffer");
         return 1;
     }
     arr->base.buffer = new_buffer;
     arr->capacity = new_capacity;
+    DS_STATS_INC(arr->stats.reallocs);
     return 0;
 }
 
@@ -250,10 +405,93 @@ static int dynarray_grow(struct dynarray *arr, size_t new_size)
 {
     assert(arr != NULL && arr->base.buffer != NULL);
     if (new_size > arr->capacity) {
-        size_t new_cap = dynarray_capacity(arr);
-        while (new_cap < new_size)
-            new_cap *= 2;
+        size_t new_cap = arr->growth(arr->capacity, new_size, arr->base.obj_size, arr->growth_param);
+        assert(new_cap >= new_size);
         return dynarray_realloc(arr, new_cap);
     }
     return 0;
-}
\ No newline at end of file
+}
+
+// Copies [begin, begin + byte_diff) into the gap, the part of a self-insert source
+// lying after the gap has already been shifted by byte_diff
+static void dynarray_copy_trivial(void *gap_start, void *begin, size_t byte_diff, int is_self_insert)
+{
+    size_t head = byte_diff;
+    if (is_self_insert) {
+        if (begin >= gap_start)
+            head = 0;
+        else if (ptr_sub(gap_start, begin) < byte_diff)
+            head = ptr_sub(gap_start, begin);
+    }
+    memcpy(gap_start, begin, head);
+    if (head < byte_diff)
+        memcpy(ptr_add(gap_start, head), ptr_add(begin, head + byte_diff), byte_diff - head);
+}
+
+// Fills count objects with value, doubling the copied prefix each step
+static void dynarray_fill_trivial(void *dest, const void *value, size_t obj_size, size_t count)
+{
+    if (count == 0)
+        return;
+    memcpy(dest, value, obj_size);
+    size_t filled = 1;
+    while (filled < count) {
+        size_t chunk = (filled < count - filled) ? filled : count - filled;
+        memcpy(ptr_add(dest, filled * obj_size), dest, chunk * obj_size);
+        filled += chunk;
+    }
+}
+
+// Relocates objects in [src, src + bytes) to dest, ranges might overlap
+static void dynarray_shift(struct dynarray *arr, void *dest, void *src, size_t bytes)
+{
+    if (arr->oc.move == NULL) {
+        memmove(dest, src, bytes);
+        return;
+    }
+    size_t obj_size = arr->base.obj_size;
+    if ((char *) dest < (char *) src) {
+        for (size_t offset = 0; offset < bytes; offset += obj_size)
+            arr->oc.move(ptr_add(dest, offset), ptr_add(src, offset));
+    } else if ((char *) dest > (char *) src) {
+        for (size_t offset = bytes; offset > 0; offset -= obj_size)
+            arr->oc.move(ptr_add(dest, offset - obj_size), ptr_add(src, offset - obj_size));
+    }
+}
+
+// Inline buffer is handed out while it is free and big enough, the heap otherwise.
+// Alignment is the one of the declared object type, enough for the dynarray.
+static void *inline_alloc(void *allocator, size_t size, size_t align)
+{
+    struct dynarray_inline_storage *st = allocator;
+    if (!st->in_use && size <= st->size) {
+        st->in_use = 1;
+        return st->buffer;
+    }
+    return sysalloc_sized(NULL, size, align);
+}
+
+static void *inline_realloc(void *allocator, void *ptr, size_t old_size, size_t new_size, size_t align)
+{
+    struct dynarray_inline_storage *st = allocator;
+    if (ptr == st->buffer && new_size <= st->size)
+        return ptr;
+    if (ptr != st->buffer && new_size > st->size)
+        return sysrealloc_sized(NULL, ptr, old_size, new_size, align);
+    // Spilling onto the heap or shrinking back inline
+    void *new_ptr = inline_alloc(st, new_size, align);
+    if (!new_ptr)
+        return NULL;
+    memcpy(new_ptr, ptr, (old_size < new_size) ? old_size : new_size);
+    inline_free(st, ptr, old_size);
+    return new_ptr;
+}
+
+static void inline_free(void *allocator, void *ptr, size_t size)
+{
+    struct dynarray_inline_storage *st = allocator;
+    if (ptr == st->buffer)
+        st->in_use = 0;
+    else
+        sysfree_sized(NULL, ptr, size);
+}
@@ -0,0 +1,242 @@
+#include <ds/arrays/flat_map.h>
+#include <ds/arrays/array_sort.h>
+#include <ds/utils/debug.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+
+/**
+ * Helper functions declarations and macro definitions
+ */
+
+// Searches prefetch the descendants this many levels below the current slot, 16 adjacent
+// slots for 4, every cache line they span (4 for 16 byte slots)
+#define EYTZINGER_PREFETCH_LEVELS 4
+#define CACHE_LINE 64
+
+#define entry_at(fm, i) ((char *) (fm)->entries.base.buffer + (i) * (fm)->entries.base.obj_size)
+#define slot_at(fm, k) ((fm)->index + (k) * (fm)->slot_size)
+// Entry index is stored after the key, aligned for size_t
+#define slot_rank_offset(fm) ((fm)->slot_size - sizeof(size_t))
+
+static size_t sorted_bound(const struct flat_map *fm, const void *key, int upper);
+static size_t eytzinger_bound(const struct flat_map *fm, const void *key, int upper);
+static size_t eytzinger_fill(struct flat_map *fm, size_t i, size_t k);
+static int flat_map_reindex(struct flat_map *fm);
+
+/* =========================================================================
+ * Initialization & Deinitialization
+ * ========================================================================= */
+
+int flat_map_init(struct flat_map *fm, size_t entry_size, size_t key_size, int (*cmp) (const void *a, const void *b))
+{
+    assert(fm != NULL && cmp != NULL);
+    assert(key_size != 0 && key_size <= entry_size);
+    struct object_concept oc = { NULL, NULL, NULL };
+    if (dynarray_init(&fm->entries, 1, entry_size, oc) != 0)
+        return 1;
+    fm->key_size = key_size;
+    fm->cmp = cmp;
+    fm->layout = FLAT_MAP_SORTED;
+    fm->index = NULL;
+    fm->slot_size = (key_size + sizeof(size_t) - 1) / sizeof(size_t) * sizeof(size_t) + sizeof(size_t);
+    return 0;
+}
+
+void flat_map_deinit(struct flat_map *fm)
+{
+    assert(fm != NULL);
+    dynarray_deinit(&fm->entries);
+    free(fm->index);
+    fm->index = NULL;
+}
+
+int flat_map_set_layout(struct flat_map *fm, enum flat_map_layout layout)
+{
+    assert(fm != NULL);
+    if (layout == FLAT_MAP_SORTED) {
+        free(fm->index);
+        fm->index = NULL;
+        fm->layout = layout;
+        return 0;
+    }
+    fm->layout = layout;
+    return flat_map_reindex(fm);
+}
+
+/* =========================================================================
+ * Insertion & Removal
+ * ========================================================================= */
+
+int flat_map_build(struct flat_map *fm, const void *entries, size_t count)
+{
+    assert(fm != NULL && (entries != NULL || count == 0));
+    size_t size = dynarray_obj_size(&fm->entries);
+    dynarray_clear(&fm->entries);
+    if (count == 0)
+        return flat_map_reindex(fm);
+    if (dynarray_insert(&fm->entries, 0, (void *) entries, (char *) entries + count * size) != 0)
+        return 1;
+    array_sort((struct array *) &fm->entries, fm->cmp);
+    // Keeps the first entry of every run of equal keys
+    size_t last = 0;
+    for (size_t i = 1; i < count; i++) {
+        if (fm->cmp(entry_at(fm, last), entry_at(fm, i)) != 0 && ++last != i)
+            memcpy(entry_at(fm, last), entry_at(fm, i), size);
+    }
+    dynarray_delete(&fm->entries, last + 1, count);
+    if (flat_map_reindex(fm) != 0) {
+        dynarray_clear(&fm->entries);
+        return 1;
+    }
+    return 0;
+}
+
+int flat_map_insert(struct flat_map *fm, const void *entry)
+{
+    assert(fm != NULL && entry != NULL);
+    size_t size = dynarray_obj_size(&fm->entries);
+    size_t i = sorted_bound(fm, entry, 0);
+    if (i < flat_map_size(fm) && fm->cmp(entry_at(fm, i), entry) == 0) {
+        // Equal keys keep the index valid
+        memcpy(entry_at(fm, i), entry, size);
+        return 0;
+    }
+    if (dynarray_insert(&fm->entries, i, (void *) entry, (char *) entry + size) != 0)
+        return 1;
+    // The entry is in, a failed reindex only loses the Eytzinger fast path
+    flat_map_reindex(fm);
+    return 0;
+}
+
+int flat_map_erase(struct flat_map *fm, const void *key)
+{
+    assert(fm != NULL && key != NULL);
+    size_t i = flat_map_lower_bound(fm, key);
+    if (i == flat_map_size(fm) || fm->cmp(entry_at(fm, i), key) != 0)
+        return 1;
+    dynarray_delete(&fm->entries, i, i + 1);
+    flat_map_reindex(fm);
+    return 0;
+}
+
+void flat_map_clear(struct flat_map *fm)
+{
+    assert(fm != NULL);
+    dynarray_clear(&fm->entries);
+    flat_map_reindex(fm);
+}
+
+/* =========================================================================
+ * Lookup
+ * ========================================================================= */
+
+void *flat_map_find(struct flat_map *fm, const void *key)
+{
+    assert(fm != NULL && key != NULL);
+    size_t i = flat_map_lower_bound(fm, key);
+    if (i < flat_map_size(fm) && fm->cmp(entry_at(fm, i), key) == 0)
+        return entry_at(fm, i);
+    return NULL;
+}
+
+size_t flat_map_lower_bound(const struct flat_map *fm, const void *key)
+{
+    assert(fm != NULL && key != NULL);
+    return (fm->layout == FLAT_MAP_EYTZINGER) ? eytzinger_bound(fm, key, 0) : sorted_bound(fm, key, 0);
+}
+
+size_t flat_map_upper_bound(const struct flat_map *fm, const void *key)
+{
+    assert(fm != NULL && key != NULL);
+    return (fm->layout == FLAT_MAP_EYTZINGER) ? eytzinger_bound(fm, key, 1) : sorted_bound(fm, key, 1);
+}
+
+struct array flat_map_range(struct flat_map *fm, const void *low, const void *high)
+{
+    assert(fm != NULL && low != NULL && high != NULL);
+    size_t first = flat_map_lower_bound(fm, low);
+    size_t last = flat_map_lower_bound(fm, high);
+    if (last < first)
+        last = first;
+    struct array view = { entry_at(fm, first), last - first, dynarray_obj_size(&fm->entries) };
+    return view;
+}
+
+// *** Helper functions definitions *** //
+
+/*
+ * Halves the range each step, the comparison result only scales the step, so there is
+ * no branch to mispredict. The loop runs log2(N) times whatever the key is.
+ */
+static size_t sorted_bound(const struct flat_map *fm, const void *key, int upper)
+{
+    size_t base = 0, len = flat_map_size(fm);
+    if (len == 0)
+        return 0;
+    while (len > 1) {
+        size_t half = len / 2;
+        int c = fm->cmp(entry_at(fm, base + half - 1), key);
+        base += (size_t) (upper ? c <= 0 : c < 0) * half;
+        len -= half;
+    }
+    int c = fm->cmp(entry_at(fm, base), key);
+    return base + (size_t) (upper ? c <= 0 : c < 0);
+}
+
+/*
+ * Walks down the implicit tree, children of slot k are 2k and 2k + 1. Going right sets
+ * the low bit, so the answer is the slot where the walk last went left: strip the
+ * trailing ones and that zero.
+ */
+static size_t eytzinger_bound(const struct flat_map *fm, const void *key, int upper)
+{
+    size_t count = flat_map_size(fm), k = 1;
+    while (k <= count) {
+        size_t ahead = k << EYTZINGER_PREFETCH_LEVELS;
+        if (ahead <= count) {
+            // Slots are a multiple of 8 bytes and the index is cache line aligned, so the block starts a line
+            size_t end = ahead + ((size_t) 1 << EYTZINGER_PREFETCH_LEVELS);
+            size_t bytes = ((end <= count + 1) ? end - ahead : count + 1 - ahead) * fm->slot_size;
+            for (size_t offset = 0; offset < bytes; offset += CACHE_LINE)
+                __builtin_prefetch(slot_at(fm, ahead) + offset);
+        }
+        int c = fm->cmp(slot_at(fm, k), key);
+        k = 2 * k + (size_t) (upper ? c <= 0 : c < 0);
+    }
+    k >>= __builtin_ffsll((long long) ~k);
+    if (k == 0)
+        return count;
+    size_t rank;
+    memcpy(&rank, slot_at(fm, k) + slot_rank_offset(fm), sizeof(rank));
+    return rank;
+}
+
+// In order walk of the implicit tree hands out the sorted entries
+static size_t eytzinger_fill(struct flat_map *fm, size_t i, size_t k)
+{
+    if (k > flat_map_size(fm))
+        return i;
+    i = eytzinger_fill(fm, i, 2 * k);
+    memcpy(slot_at(fm, k), entry_at(fm, i), fm->key_size);
+    memcpy(slot_at(fm, k) + slot_rank_offset(fm), &i, sizeof(i));
+    return eytzinger_fill(fm, i + 1, 2 * k + 1);
+}
+
+// Falls back to FLAT_MAP_SORTED if the index cannot grow, lookups stay correct
+static int flat_map_reindex(struct flat_map *fm)
+{
+    if (fm->layout != FLAT_MAP_EYTZINGER)
+        return 0;
+    // Every slot is rewritten below, so nothing is copied over
+    free(fm->index);
+    size_t bytes = (flat_map_size(fm) + 1) * fm->slot_size;
+    fm->index = aligned_alloc(CACHE_LINE, (bytes + CACHE_LINE - 1) / CACHE_LINE * CACHE_LINE);
+    if (!fm->index) {
+        LOG(LIB_LVL, CWARNING, "Could not grow the Eytzinger index, switching to sorted layout");
+        fm->layout = FLAT_MAP_SORTED;
+        return 1;
+    }
+    eytzinger_fill(fm, 0, 1);
+    return 0;
+}
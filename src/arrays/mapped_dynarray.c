@@ -0,0 +1,190 @@
+#define _GNU_SOURCE
+#include <ds/arrays/mapped_dynarray.h>
+#include <ds/utils/debug.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <assert.h>
+
+/**
+ * Helper functions declarations and macro definitions
+ */
+
+#define HEADER_SIZE sizeof(struct mapped_dynarray_header)
+
+_Static_assert(sizeof(struct mapped_dynarray_header) == 64, "Objects must stay 64 byte aligned");
+
+// Sized allocator concept the dynarray grows thru, md is the allocator
+static void *file_alloc(void *allocator, size_t size, size_t align);
+static void *file_realloc(void *allocator, void *ptr, size_t old_size, size_t new_size, size_t align);
+static void file_free(void *allocator, void *ptr, size_t size);
+static int read_header(int fd, size_t file_size, size_t obj_size, size_t *size, size_t *capacity);
+static void *map_file(struct mapped_dynarray *md, size_t length);
+
+/* =========================================================================
+ * Open & Close
+ * ========================================================================= */
+
+int mapped_dynarray_open(struct mapped_dynarray *md, const char *path, size_t obj_size, size_t capacity, int flags)
+{
+    assert(md != NULL && path != NULL && obj_size != 0 && capacity != 0);
+    md->fd = open(path, O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+    if (md->fd < 0) {
+        LOG(LIB_LVL, CERROR, "Could not open %s", path);
+        return 1;
+    }
+    md->flags = flags;
+    md->mapping = NULL;
+    md->length = 0;
+    struct stat st;
+    size_t size = 0;
+    if (fstat(md->fd, &st) != 0) {
+        LOG(LIB_LVL, CERROR, "Could not stat %s", path);
+        close(md->fd);
+        return 1;
+    }
+    // Empty files are new ones, nothing to validate
+    if (!(flags & MAPPED_DYNARRAY_TRUNCATE) && st.st_size > 0
+        && read_header(md->fd, (size_t) st.st_size, obj_size, &size, &capacity) != 0) {
+        LOG(LIB_LVL, CERROR, "%s is not a mapped dynarray of %zu byte objects", path, obj_size);
+        close(md->fd);
+        return 1;
+    }
+    struct object_concept oc = { NULL, NULL, NULL };
+    struct sized_allocator_concept sac = { md, file_alloc, file_realloc, file_free };
+    if (dynarray_init_with(&md->arr, capacity, obj_size, oc, &sac) != 0) {
+        close(md->fd);
+        return 1;
+    }
+    md->arr.base.size = size;
+    struct mapped_dynarray_header *header = (struct mapped_dynarray_header *) md->mapping;
+    *header = (struct mapped_dynarray_header) { MAPPED_DYNARRAY_MAGIC, MAPPED_DYNARRAY_VERSION, 0, obj_size, size, { 0 } };
+    return 0;
+}
+
+int mapped_dynarray_close(struct mapped_dynarray *md)
+{
+    assert(md != NULL && md->mapping != NULL);
+    int status = mapped_dynarray_sync(md);
+    dynarray_deinit(&md->arr);
+    close(md->fd);
+    md->fd = -1;
+    return status;
+}
+
+int mapped_dynarray_sync(struct mapped_dynarray *md)
+{
+    assert(md != NULL && md->mapping != NULL);
+    ((struct mapped_dynarray_header *) md->mapping)->size = dynarray_size(&md->arr);
+    if (msync(md->mapping, md->length, MS_SYNC) != 0) {
+        LOG(LIB_LVL, CERROR, "Could not sync the mapping");
+        return 1;
+    }
+    return 0;
+}
+
+// *** Helper functions definitions *** //
+
+// Mapping starts at the header, so objects are mapped at the page offset of HEADER_SIZE
+static void *file_alloc(void *allocator, size_t size, size_t align)
+{
+    struct mapped_dynarray *md = allocator;
+    assert(align <= HEADER_SIZE);
+    (void) align;
+    if (md->mapping) {
+        LOG(LIB_LVL, CERROR, "File is already mapped, objects must be relocated bitwise");
+        return NULL;
+    }
+    if (ftruncate(md->fd, (off_t) (HEADER_SIZE + size)) != 0) {
+        LOG(LIB_LVL, CERROR, "Could not resize the file");
+        return NULL;
+    }
+    char *mapping = map_file(md, HEADER_SIZE + size);
+    return (mapping) ? mapping + HEADER_SIZE : NULL;
+}
+
+static void *file_realloc(void *allocator, void *ptr, size_t old_size, size_t new_size, size_t align)
+{
+    struct mapped_dynarray *md = allocator;
+    assert(ptr == md->mapping + HEADER_SIZE && HEADER_SIZE + old_size == md->length);
+    (void) ptr;
+    (void) align;
+    size_t old_length = md->length, new_length = HEADER_SIZE + new_size;
+    // Pages past the end of the file cannot be touched, so the file grows first and shrinks last
+    if (new_size > old_size && ftruncate(md->fd, (off_t) new_length) != 0) {
+        LOG(LIB_LVL, CERROR, "Could not grow the file");
+        return NULL;
+    }
+#ifdef MREMAP_MAYMOVE
+    char *mapping = mremap(md->mapping, old_length, new_length, MREMAP_MAYMOVE);
+    if (mapping == MAP_FAILED)
+        mapping = NULL;
+    else
+        md->length = new_length;
+#else
+    // Objects live in the file, remapping it needs no copy
+    munmap(md->mapping, old_length);
+    md->mapping = NULL;
+    char *mapping = map_file(md, new_length);
+    if (!mapping)
+        mapping = map_file(md, old_length);
+#endif
+    if (!mapping || md->length != new_length) {
+        LOG(LIB_LVL, CERROR, "Could not remap the file");
+        if (new_size > old_size && ftruncate(md->fd, (off_t) old_length) != 0) {
+            LOG(LIB_LVL, CWARNING, "Could not shrink the file back, it is longer than its mapping");
+        }
+        return NULL;
+    }
+    md->mapping = mapping;
+    if (new_size < old_size && ftruncate(md->fd, (off_t) new_length) != 0) {
+        LOG(LIB_LVL, CWARNING, "Could not shrink the file");
+    }
+    return mapping + HEADER_SIZE;
+}
+
+static void file_free(void *allocator, void *ptr, size_t size)
+{
+    struct mapped_dynarray *md = allocator;
+    (void) ptr;
+    (void) size;
+    munmap(md->mapping, md->length);
+    md->mapping = NULL;
+    md->length = 0;
+}
+
+// Stored size and capacity of a valid file, capacity is raised to the stored one
+static int read_header(int fd, size_t file_size, size_t obj_size, size_t *size, size_t *capacity)
+{
+    struct mapped_dynarray_header header;
+    if (file_size < HEADER_SIZE || pread(fd, &header, HEADER_SIZE, 0) != (ssize_t) HEADER_SIZE)
+        return 1;
+    if (header.magic != MAPPED_DYNARRAY_MAGIC || header.version != MAPPED_DYNARRAY_VERSION
+        || header.obj_size != obj_size)
+        return 1;
+    size_t stored = (file_size - HEADER_SIZE) / obj_size;
+    if (header.size > stored)
+        return 1;
+    *size = header.size;
+    if (stored > *capacity)
+        *capacity = stored;
+    return 0;
+}
+
+static void *map_file(struct mapped_dynarray *md, size_t length)
+{
+    int flags = MAP_SHARED;
+#ifdef MAP_POPULATE
+    if (md->flags & MAPPED_DYNARRAY_POPULATE)
+        flags |= MAP_POPULATE;
+#endif
+    char *mapping = mmap(NULL, length, PROT_READ | PROT_WRITE, flags, md->fd, 0);
+    if (mapping == MAP_FAILED) {
+        LOG(LIB_LVL, CERROR, "Could not map the file");
+        return NULL;
+    }
+    md->mapping = mapping;
+    md->length = length;
+    return mapping;
+}
@@ -0,0 +1,230 @@
+#include <ds/arrays/segarray.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+
+/**
+ * Helper functions declarations and macro definitions
+ */
+
+#define chunk_mask(sa) (segarray_chunk_capacity(sa) - 1)
+#define chunk_of(sa, pos) ((pos) >> (sa)->chunk_shift)
+#define slot_of(sa, pos) ((void *) ((char *) (sa)->chunks[chunk_of(sa, pos)] + ((pos) & chunk_mask(sa)) * (sa)->obj_size))
+
+// Initial count of directory entries
+#define SEGARRAY_MIN_DIRECTORY 4
+
+static int segarray_reserve_directory(struct segarray *sa);
+static int segarray_acquire_chunk(struct segarray *sa, size_t chunk);
+static void segarray_release_chunk(struct segarray *sa, size_t chunk);
+
+/* =========================================================================
+ * Initialization & Deinitialization
+ * ========================================================================= */
+
+int segarray_init(struct segarray *sa, size_t obj_size, size_t chunk_capacity, struct object_concept oc,
+                  struct allocator_concept *ac)
+{
+    assert(sa != NULL && ac != NULL && obj_size != 0);
+    if (chunk_capacity == 0 || (chunk_capacity & (chunk_capacity - 1)) != 0) {
+        LOG(LIB_LVL, CERROR, "Chunk capacity must be a power of two");
+        return 1;
+    }
+    sa->chunks = NULL;
+    sa->dir_capacity = 0;
+    sa->begin = 0;
+    sa->size = 0;
+    sa->chunk_shift = 0;
+    while (((size_t) 1 << sa->chunk_shift) < chunk_capacity)
+        sa->chunk_shift++;
+    sa->obj_size = obj_size;
+    sa->oc = oc;
+    sa->ac = *ac;
+    sa->chunk_count = 0;
+    return 0;
+}
+
+void segarray_deinit(struct segarray *sa)
+{
+    assert(sa != NULL);
+    segarray_clear(sa);
+    free(sa->chunks);
+    sa->chunks = NULL;
+    sa->dir_capacity = 0;
+}
+
+/* =========================================================================
+ * Insertion & Removal
+ * ========================================================================= */
+
+int segarray_push_back(struct segarray *sa, void *value)
+{
+    assert(sa != NULL && value != NULL);
+    if (chunk_of(sa, sa->begin + sa->size) >= sa->dir_capacity && segarray_reserve_directory(sa) != 0)
+        return 1;
+    size_t pos = sa->begin + sa->size;
+    int fresh = sa->chunks[chunk_of(sa, pos)] == NULL;
+    if (fresh && segarray_acquire_chunk(sa, chunk_of(sa, pos)) != 0)
+        return 1;
+    if (object_concept_init(&sa->oc, slot_of(sa, pos), value, sa->obj_size) != 0) {
+        if (fresh)
+            segarray_release_chunk(sa, chunk_of(sa, pos));
+        return 1;
+    }
+    sa->size++;
+    return 0;
+}
+
+int segarray_push_front(struct segarray *sa, void *value)
+{
+    assert(sa != NULL && value != NULL);
+    if ((sa->begin == 0 || sa->dir_capacity == 0) && segarray_reserve_directory(sa) != 0)
+        return 1;
+    size_t pos = sa->begin - 1;
+    int fresh = sa->chunks[chunk_of(sa, pos)] == NULL;
+    if (fresh && segarray_acquire_chunk(sa, chunk_of(sa, pos)) != 0)
+        return 1;
+    if (object_concept_init(&sa->oc, slot_of(sa, pos), value, sa->obj_size) != 0) {
+        if (fresh)
+            segarray_release_chunk(sa, chunk_of(sa, pos));
+        return 1;
+    }
+    sa->begin = pos;
+    sa->size++;
+    return 0;
+}
+
+int segarray_pop_back(struct segarray *sa, void *dest)
+{
+    assert(sa != NULL);
+    if (sa->size == 0)
+        return 1;
+    size_t pos = sa->begin + sa->size - 1;
+    if (dest)
+        object_concept_move(&sa->oc, dest, slot_of(sa, pos), sa->obj_size);
+    else
+        object_concept_deinit(&sa->oc, slot_of(sa, pos));
+    sa->size--;
+    // Chunk is empty once its first slot or the first object is gone
+    if ((pos & chunk_mask(sa)) == 0 || sa->size == 0)
+        segarray_release_chunk(sa, chunk_of(sa, pos));
+    return 0;
+}
+
+int segarray_pop_front(struct segarray *sa, void *dest)
+{
+    assert(sa != NULL);
+    if (sa->size == 0)
+        return 1;
+    size_t pos = sa->begin;
+    if (dest)
+        object_concept_move(&sa->oc, dest, slot_of(sa, pos), sa->obj_size);
+    else
+        object_concept_deinit(&sa->oc, slot_of(sa, pos));
+    sa->begin++;
+    sa->size--;
+    // Chunk is empty once its last slot or the last object is gone
+    if ((pos & chunk_mask(sa)) == chunk_mask(sa) || sa->size == 0)
+        segarray_release_chunk(sa, chunk_of(sa, pos));
+    return 0;
+}
+
+void segarray_clear(struct segarray *sa)
+{
+    assert(sa != NULL);
+    if (sa->oc.deinit != NULL) {
+        for (size_t i = 0; i < sa->size; i++)
+            sa->oc.deinit(segarray_at(sa, i));
+    }
+    for (size_t i = 0; i < sa->dir_capacity; i++) {
+        if (sa->chunks[i])
+            segarray_release_chunk(sa, i);
+    }
+    sa->size = 0;
+    sa->begin = 0;
+}
+
+/* =========================================================================
+ * Iteration
+ * ========================================================================= */
+
+struct array segarray_span(const struct segarray *sa, size_t index)
+{
+    assert(sa != NULL && index < sa->size);
+    size_t pos = sa->begin + index;
+    size_t in_chunk = segarray_chunk_capacity(sa) - (pos & chunk_mask(sa));
+    size_t remaining = sa->size - index;
+    struct array span = { slot_of(sa, pos), (in_chunk < remaining) ? in_chunk : remaining, sa->obj_size };
+    return span;
+}
+
+void segarray_walk(struct segarray *sa, void *context, void (*handler) (void *data, void *context))
+{
+    assert(sa != NULL && handler != NULL);
+    for (size_t i = 0; i < sa->size; ) {
+        struct array span = segarray_span(sa, i);
+        char *obj = span.buffer;
+        for (size_t j = 0; j < span.size; j++, obj += sa->obj_size)
+            handler(obj, context);
+        i += span.size;
+    }
+}
+
+// *** Helper functions definitions *** //
+
+// Makes room for a chunk at both ends of the used range. Only chunk pointers are
+// moved, the used range is centered in a directory of at least 2 * used + 2 entries.
+static int segarray_reserve_directory(struct segarray *sa)
+{
+    size_t first = (sa->size) ? chunk_of(sa, sa->begin) : 0;
+    size_t used = (sa->size) ? chunk_of(sa, sa->begin + sa->size - 1) - first + 1 : 0;
+    size_t new_capacity = sa->dir_capacity;
+    if (new_capacity < 2 * used + 2) {
+        new_capacity = 2 * sa->dir_capacity;
+        if (new_capacity < 2 * used + 2)
+            new_capacity = 2 * used + 2;
+    }
+    if (new_capacity < SEGARRAY_MIN_DIRECTORY)
+        new_capacity = SEGARRAY_MIN_DIRECTORY;
+    size_t new_first = (new_capacity - used) / 2;
+    if (new_capacity != sa->dir_capacity) {
+        void **chunks = calloc(new_capacity, sizeof(void *));
+        if (!chunks) {
+            LOG(LIB_LVL, CERROR, "Could not allocate the directory");
+            return 1;
+        }
+        if (used)
+            memcpy(&chunks[new_first], &sa->chunks[first], used * sizeof(void *));
+        free(sa->chunks);
+        sa->chunks = chunks;
+        sa->dir_capacity = new_capacity;
+    } else {
+        memmove(&sa->chunks[new_first], &sa->chunks[first], used * sizeof(void *));
+        memset(sa->chunks, 0, new_first * sizeof(void *));
+        memset(&sa->chunks[new_first + used], 0, (new_capacity - new_first - used) * sizeof(void *));
+    }
+    // Objects keep their slot inside the chunk, empty segarrays restart at a chunk boundary
+    size_t offset = (sa->size) ? (sa->begin & chunk_mask(sa)) : 0;
+    sa->begin = (new_first << sa->chunk_shift) + offset;
+    return 0;
+}
+
+static int segarray_acquire_chunk(struct segarray *sa, size_t chunk)
+{
+    void *mem = sa->ac.alloc(sa->ac.allocator);
+    if (!mem) {
+        LOG(LIB_LVL, CERROR, "Could not allocate a chunk");
+        return 1;
+    }
+    sa->chunks[chunk] = mem;
+    sa->chunk_count++;
+    return 0;
+}
+
+static void segarray_release_chunk(struct segarray *sa, size_t chunk)
+{
+    if (sa->ac.free)
+        sa->ac.free(sa->ac.allocator, sa->chunks[chunk]);
+    sa->chunks[chunk] = NULL;
+    sa->chunk_count--;
+}
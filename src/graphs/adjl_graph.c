@@ -1,7 +1,8 @@
 #include <ds/graphs/adjl_graph.h>
 #include <ds/linkedlists/clist.h>
 #include <ds/stack/lstack.h>
-#include <ds/queue/lqueue.h>
+#include <ds/queue/rqueue.h>
+#include <ds/utils/slab_pool.h>
 #include <stdlib.h>
 
 struct adjl_vertex {
@@ -261,30 +262,30 @@ void adjl_graph_bfs(struct adjl_graph *gr, void *start_key, void *context, void
     assert(handler != NULL);
     if (adjl_graph_empty(gr))
         return;
-    // TODO: Use a real pool after updating allocators repository.
-    struct syspool item_pool = { lqueue_node_sizeof() };
-    struct allocator_concept ac = { .allocator = &item_pool, .alloc = sysalloc, .free = sysfree };
-    struct lqueue *lq = lqueue_create(&ac);
-    set_processeds(gr);
     struct adjl_vertex *v = adjl_graph_search(gr, start_key);
     if (!v)
         return;
-    lenqueue(lq, v); 
+    // Frontier of vertex pointers in one ring buffer, no allocation per vertex
+    struct object_concept oc = { NULL, NULL, NULL };
+    struct rqueue *rq = rqueue_create(sizeof(struct adjl_vertex *), &oc);
+    if (!rq)
+        return;
+    set_processeds(gr);
+    renqueue(rq, &v);
     v->processed = 1;
-    while (!lqueue_empty(lq)) {
-        v = ldequeue(lq);
+    while (rdequeue(rq, &v) == 0) {
         handler(v->data, context);
         struct adjl_arc *arc = v->adj_list;
         while (arc) {
             if (arc->dest->processed == 0) {
                 arc->dest->processed = 1;
-                lenqueue(lq, arc->dest);
+                renqueue(rq, &arc->dest);
             }
             arc = arc->next_arc;
         }
         v->processed = 2;
     }
-    lqueue_destroy(lq, NULL);
+    rqueue_destroy(rq);
 }
 
 void adjl_graph_dfs(struct adjl_graph *gr, void *start_key, void *context, void (*handler) (void *item, void *context))
@@ -293,14 +294,19 @@ void adjl_graph_dfs(struct adjl_graph *gr, void *start_key, void *context, void
     assert(handler != NULL);
     if (adjl_graph_empty(gr))
         return;
-    // TODO: Use a real pool after updating allocators repository.
-    struct syspool item_pool = { lstack_node_sizeof() };
-    struct allocator_concept ac = { .allocator = &item_pool, .alloc = sysalloc, .free = sysfree };
-    struct lstack *ls = lstack_create(&ac);
-    set_processeds(gr);
     struct adjl_vertex *v = adjl_graph_search(gr, start_key);
     if (!v)
         return;
+    struct slab_pool item_pool;
+    if (slab_pool_init(&item_pool, lstack_node_sizeof(), 0) != 0)
+        return;
+    struct allocator_concept ac = { .allocator = &item_pool, .alloc = slab_alloc, .free = slab_free };
+    struct lstack *ls = lstack_create(&ac);
+    if (!ls) {
+        slab_pool_deinit(&item_pool);
+        return;
+    }
+    set_processeds(gr);
     lpush(ls, v); 
     v->processed = 1;
     while (!lstack_empty(ls)) {
@@ -317,6 +323,7 @@ void adjl_graph_dfs(struct adjl_graph *gr, void *start_key, void *context, void
         v->processed = 2;
     }
     lstack_destroy(ls, NULL);
+    slab_pool_deinit(&item_pool);
 }
 
 /* =========================================================================
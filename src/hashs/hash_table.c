@@ -1,14 +1,21 @@
 #include <ds/hashs/hash_table.h>
+#include <ds/hashs/swiss_table.h>
 #include <stdlib.h>
+#include <stdint.h>
 #include <string.h>
 #include <stdio.h>
 #include <assert.h>
 
 #define BASE_PRIME 53
+#define BASE_POW2 64
 #define UP_LOAD_RATIO 0.7
 #define DOWN_LOAD_RATIO 0.1
 #define FACTOR_UP 2
 #define FACTOR_DOWN 0.5
+// Old slots moved per call during an incremental resize, the move ends long before the new array fills
+#define MIGRATE_SLOTS 8
+// New slots zeroed per call before an incremental resize moves pairs, the old array fills by 1/32 at most meanwhile
+#define ZERO_SLOTS 64
 
 struct ht_item {
    void*        key;
@@ -17,9 +24,41 @@ struct ht_item {
 
 struct hash_table {
    struct ht_item*          items;
+   uint64_t*                hashes;         // hash_table_config::store_hash only, hash64 of the key per slot
+   uint32_t*                psl;            // HASH_TABLE_PROBE_ROBIN_HOOD only, probe distance + 1 per slot, 0 if empty
    size_t                   capacity;
    size_t                   size;
+   enum hash_table_probing  probing;
+   int                      store_hash;
+   int                      incremental;
+   // Array being drained by an incremental resize, NULL if there is none. Moved slots become tombstones
+   struct ht_item*          old_items;
+   uint64_t*                old_hashes;
+   size_t                   old_capacity;
+   size_t                   migrated;       // Slots of old_items below this are moved
+   // Array allocated by an incremental resize, zeroed a chunk per call before pairs move in, NULL if there is none
+   struct ht_item*          fresh_items;
+   size_t                   fresh_capacity;
+   size_t                   zeroed;         // Bytes of fresh_items zeroed so far
+   struct swiss_table*      swiss;          // Every call is forwarded here if non-NULL, items is unused then
    struct hash_concept      hc;
+   struct sized_allocator_concept sac;
+   DS_STATS_FIELD(struct hash_table_stats, stats)
+};
+
+#ifdef DS_STATS
+    #define RECORD_PROBE(ht, attempts) DS_STATS_INC((ht)->stats.probes[((attempts) < HASH_TABLE_PROBE_BUCKETS) ? (attempts) : HASH_TABLE_PROBE_BUCKETS - 1])
+#else
+    #define RECORD_PROBE(ht, attempts) ((void) 0)
+#endif // DS_STATS
+
+// Position of a key in its probe sequence
+struct probe {
+    const void*   key;
+    uint64_t      hash;         // hc.hash64 of key, unused by HASH_TABLE_PROBE_CONCEPT
+    size_t        capacity;     // Of the array probed
+    size_t        attempts;
+    size_t        index;
 };
 
 // ht_item helpers
@@ -37,12 +76,54 @@ static void mark_item(struct ht_item* item);
 static int is_null(struct ht_item* item);
 // Returns 1 if the item was deleted before, 0 otherwise
 static int is_deleted(struct ht_item* item);
+// Returns 1 if slot i holds a key value pair, 0 otherwise
+static int is_live(const struct hash_table* ht, size_t i);
+// Returns 1 if live slot i holds key, stored hashes are compared before calling cmp_key
+static int key_matches(const struct hash_table* ht, size_t i, const void* key, uint64_t hash);
 
 // hash_table helpers
 
+// hc.hash64 of key, 0 for HASH_TABLE_PROBE_CONCEPT
+static uint64_t key_hash(const struct hash_table* ht, const void* key);
+// Starts the probe sequence of key in items
+static void probe_begin(const struct hash_table* ht, struct probe* p, const void* key);
+// Starts the probe sequence of key in an array of capacity slots with an already known hash
+static void probe_begin_hash(const struct hash_table* ht, struct probe* p, const void* key, uint64_t hash, size_t capacity);
+// Moves to the next slot of the sequence
+static void probe_next(const struct hash_table* ht, struct probe* p);
+
+// Robin Hood helpers, keys are kept in increasing probe distance along each run
+
+// Returns 1 and the slot of key if it exists, otherwise 0 and the slot and distance it would be placed at
+static int rh_lookup(const struct hash_table* ht, const void* key, uint64_t hash, size_t* index, size_t* dist);
+// Places a pair known to be absent at index, displacing entries closer to their home slot
+static void rh_place(struct hash_table* ht, size_t index, size_t dist, void* key, void* value, uint64_t hash);
+// Empties index by shifting the rest of its run one slot back, no tombstone is left
+static void rh_erase(struct hash_table* ht, size_t index);
+
+// Incremental resize helpers
+
+// Places a pair known to be absent in items, at the first free slot of its probe sequence
+static void place_item(struct hash_table* ht, void* key, void* value, uint64_t hash);
+// Returns the live old_items slot holding key, NULL if there is none
+static struct ht_item* old_lookup(struct hash_table* ht, const void* key, uint64_t hash);
+// Zeroes ZERO_SLOTS of fresh_items, or moves up to MIGRATE_SLOTS old slots into items and
+// releases old_items after the last one
+static void migrate_step(struct hash_table* ht);
+// Zeroes the next chunk of fresh_items, makes it items and the current ones old_items once done
+static void zero_step(struct hash_table* ht);
+
 // hash_table_init helper. Inits size and memory realted attributes.
 // Leaves object's state the same as before the function call in case of failure
 static int init_size_ht(struct hash_table* ht, size_t capacity);
+// Allocates a bucket array thru the allocator of hash_table without zeroing it, NULL on failure
+static struct ht_item* alloc_items(struct hash_table* ht, size_t capacity);
+// Makes a zeroed bucket array of capacity slots the items, optional arrays included
+static void use_items(struct hash_table* ht, struct ht_item* items, size_t capacity);
+// Bytes of a bucket array, Robin Hood distances follow the items in the same block
+static size_t items_bytes(const struct hash_table* ht, size_t capacity);
+// Releases a bucket array thru the allocator of hash_table
+static void free_items(struct hash_table* ht, struct ht_item* items, size_t capacity);
 // Resize hash_table, returns 0 if it succeeds, 1 otherwise
 // Leaves object's state the same as before the function call in case of failure, provided by init_size_ht
 static int resize(struct hash_table* ht, float factor);
@@ -52,9 +133,8 @@ static int resize_up(struct hash_table* ht, float load);
 // Decrease hash_table size, returns 0 if it succeeds, 1 otherwise
 // Leaves object's state the same as before the function call in case of failure, provided by init_size_ht
 static int resize_down(struct hash_table* ht, float load);
-// Mock my prime lib, https://github.com/jamesroutley/write-a-hash-table/tree/master/06-resizing
-static int is_prime(const int x);
-static int next_prime(int x);
+// Capacity after growing (factor > 1) or shrinking, 0 if there is none
+static size_t next_capacity(const struct hash_table* ht, float factor);
 
 static void* deleted;
 
@@ -63,34 +143,97 @@ static void* deleted;
  * ========================================================================= */
 
 struct hash_table* hash_table_create(struct hash_concept *hc)
+{
+    return hash_table_create_with(hc, NULL);
+}
+
+struct hash_table* hash_table_create_with(struct hash_concept *hc, const struct sized_allocator_concept *sac)
+{
+    return hash_table_create_config(hc, sac, NULL);
+}
+
+struct hash_table* hash_table_create_config(struct hash_concept *hc, const struct sized_allocator_concept *sac,
+    const struct hash_table_config *config)
 {
     assert(hc != NULL);
+    enum hash_table_probing probing = (config) ? config->probing : HASH_TABLE_PROBE_CONCEPT;
+    if (probing != HASH_TABLE_PROBE_CONCEPT && hc->hash64 == NULL) {
+        LOG(LIB_LVL, CERROR, "Probing needs hash64");
+        return NULL;
+    }
+    // hash_concept::hash depends on capacity, there is nothing to store
+    if (config && config->store_hash && probing == HASH_TABLE_PROBE_CONCEPT && config->engine == HASH_TABLE_ENGINE_OPEN) {
+        LOG(LIB_LVL, CERROR, "store_hash needs hash64 probing");
+        return NULL;
+    }
+    // Robin Hood runs can not stay ordered while half of them is drained
+    if (config && config->incremental && probing == HASH_TABLE_PROBE_ROBIN_HOOD && config->engine == HASH_TABLE_ENGINE_OPEN) {
+        LOG(LIB_LVL, CERROR, "incremental resize does not support Robin Hood probing");
+        return NULL;
+    }
     struct hash_table* ht = malloc(sizeof(*ht));
     if (ht == NULL) {
         LOG(LIB_LVL, CERROR, "malloc failed");
         return NULL;
     }
-    if (init_size_ht(ht, BASE_PRIME) != 0) {
+    ht->sac = (sac) ? *sac : sysallocator_sized();
+    ht->probing = probing;
+    ht->store_hash = (config) ? config->store_hash : 0;
+    ht->incremental = (config) ? config->incremental : 0;
+    ht->old_items = NULL;
+    ht->old_hashes = NULL;
+    ht->old_capacity = ht->migrated = 0;
+    ht->fresh_items = NULL;
+    ht->fresh_capacity = ht->zeroed = 0;
+    ht->swiss = NULL;
+    if (config && config->engine == HASH_TABLE_ENGINE_SWISS) {
+        ht->swiss = swiss_table_create(hc, sac);
+        if (ht->swiss == NULL) {
+            LOG(LIB_LVL, CERROR, "swiss_table_create failed");
+            free(ht);
+            return NULL;
+        }
+        ht->items = NULL;
+        ht->hashes = NULL;
+        ht->psl = NULL;
+        ht->capacity = ht->size = 0;
+    } else if (init_size_ht(ht, (probing == HASH_TABLE_PROBE_CONCEPT) ? BASE_PRIME : BASE_POW2) != 0) {
         LOG(LIB_LVL, CERROR, "init_size_ht failed");
         free(ht);
         return NULL;
     }
     ht->hc = *hc;
+    DS_STATS_RESET(ht->stats);
     return ht;
 }
 
 void hash_table_destroy(struct hash_table* ht, struct object_concept *oc)
 {
     assert(ht != NULL);
+    if (ht->swiss) {
+        swiss_table_destroy(ht->swiss, oc);
+        free(ht);
+        return;
+    }
     if (oc != NULL && oc->deinit != NULL) {
         for (size_t i = 0; i < ht->capacity; i++) {
-            if (!is_null(&ht->items[i]) && !is_deleted(&ht->items[i])) {
+            if (is_live(ht, i)) {
                 oc->deinit(ht->items[i].key);
                 oc->deinit(ht->items[i].value);
             }
         }
+        for (size_t i = ht->migrated; ht->old_items && i < ht->old_capacity; i++) {
+            if (!is_null(&ht->old_items[i]) && !is_deleted(&ht->old_items[i])) {
+                oc->deinit(ht->old_items[i].key);
+                oc->deinit(ht->old_items[i].value);
+            }
+        }
     }
-    free(ht->items);
+    if (ht->old_items)
+        free_items(ht, ht->old_items, ht->old_capacity);
+    if (ht->fresh_items)
+        free_items(ht, ht->fresh_items, ht->fresh_capacity);
+    free_items(ht, ht->items, ht->capacity);
     free(ht);
 }
 
@@ -101,39 +244,90 @@ void hash_table_destroy(struct hash_table* ht, struct object_concept *oc)
 int hash_table_insert(struct hash_table* ht, void* key, void* value)
 {
     assert(ht != NULL && key != NULL && value != NULL);
+    if (ht->swiss)
+        return swiss_table_insert(ht->swiss, key, value);
+    migrate_step(ht);
     if (resize_up(ht, (float) ht->size / ht->capacity) != 0) {
         LOG(LIB_LVL, CERROR, "Could not resize the hash_table up");
         return 1;
     }
-    int attempts = 0;
-    int index = ht->hc.hash(key, ht->capacity, attempts);
-    struct ht_item* curr_item = &ht->items[index];
+    if (ht->psl) {
+        size_t index, dist;
+        uint64_t hash = ht->hc.hash64(key);
+        if (rh_lookup(ht, key, hash, &index, &dist))
+            set_value(&ht->items[index], value);
+        else {
+            rh_place(ht, index, dist, key, value, hash);
+            ht->size++;
+        }
+        RECORD_PROBE(ht, dist);
+        return 0;
+    }
+    uint64_t hash = key_hash(ht, key);
+    struct ht_item* old_item = (ht->old_items) ? old_lookup(ht, key, hash) : NULL;
+    if (old_item) {
+        set_value(old_item, value);
+        return 0;
+    }
+    struct probe p;
+    probe_begin_hash(ht, &p, key, hash, ht->capacity);
+    struct ht_item* curr_item = &ht->items[p.index];
     struct ht_item* first_deleted = NULL;
     while (!is_null(curr_item)) {
         if (is_deleted(curr_item)) {
             if (!first_deleted)
                 first_deleted = curr_item;
-        } else if (ht->hc.cmp_key(get_key(curr_item), key) == 0) {
+        } else if (key_matches(ht, p.index, key, p.hash)) {
             set_value(curr_item, value);
+            RECORD_PROBE(ht, p.attempts);
             return 0;
         }
-        attempts++;
-        index = ht->hc.hash(key, ht->capacity, attempts);
-        curr_item = &ht->items[index];
+        probe_next(ht, &p);
+        curr_item = &ht->items[p.index];
     }
-    init_item((first_deleted) ? first_deleted : curr_item, key, value);
+    struct ht_item* slot = (first_deleted) ? first_deleted : curr_item;
+    init_item(slot, key, value);
+    if (ht->hashes)
+        ht->hashes[slot - ht->items] = p.hash;
     ht->size++;
+    RECORD_PROBE(ht, p.attempts);
     return 0;
 }
 
 int hash_table_remove(struct hash_table* ht, const void* key)
 {
     assert(ht != NULL && key != NULL);
-    int attempts = 0;
-    int index = ht->hc.hash(key, ht->capacity, attempts);
-    struct ht_item* curr_item = &ht->items[index];
+    if (ht->swiss)
+        return swiss_table_remove(ht->swiss, key);
+    migrate_step(ht);
+    if (ht->psl) {
+        size_t index, dist;
+        uint64_t hash = ht->hc.hash64(key);
+        int found = rh_lookup(ht, key, hash, &index, &dist);
+        RECORD_PROBE(ht, dist);
+        if (!found) {
+            LOG(LIB_LVL, CINFO, "The key to be deleted couldnt be found");
+            return 1;
+        }
+        struct ht_item copy_curr = ht->items[index];
+        rh_erase(ht, index);
+        ht->size--;
+        if (resize_down(ht, (float) ht->size / ht->capacity) != 0) {
+            LOG(LIB_LVL, CERROR, "Could not resize the hash_table down");
+            // The slot it left is free again, so placing it back needs no resize
+            rh_lookup(ht, copy_curr.key, hash, &index, &dist);
+            rh_place(ht, index, dist, copy_curr.key, copy_curr.value, hash);
+            ht->size++;
+            return 1;
+        }
+        return 0;
+    }
+    struct probe p;
+    probe_begin(ht, &p, key);
+    struct ht_item* curr_item = &ht->items[p.index];
     while (!is_null(curr_item)) {
-        if (!is_deleted(curr_item) && ht->hc.cmp_key(get_key(curr_item), key) == 0) {
+        if (!is_deleted(curr_item) && key_matches(ht, p.index, key, p.hash)) {
+            RECORD_PROBE(ht, p.attempts);
             // save current because possible resize will invalidate curr_item
             struct ht_item copy_curr = *curr_item;
             mark_item(curr_item);
@@ -145,11 +339,18 @@ int hash_table_remove(struct hash_table* ht, const void* key)
             }
             return 0;
         }
-        attempts++;
-        index = ht->hc.hash(key, ht->capacity, attempts);
-        curr_item = &ht->items[index];
+        probe_next(ht, &p);
+        curr_item = &ht->items[p.index];
     }
-    LOG(LIB_LVL, CERROR, "The key to be deleted couldnt be found");
+    RECORD_PROBE(ht, p.attempts);
+    // Not moved yet, shrinking waits for the resize in progress
+    struct ht_item* old_item = (ht->old_items) ? old_lookup(ht, key, p.hash) : NULL;
+    if (old_item) {
+        mark_item(old_item);
+        ht->size--;
+        return 0;
+    }
+    LOG(LIB_LVL, CINFO, "The key to be deleted couldnt be found");
     return 1;
 }
 
@@ -159,14 +360,69 @@ int hash_table_remove(struct hash_table* ht, const void* key)
 
 size_t hash_table_size(const struct hash_table* ht)
 {
-    return ht->size;
+    return (ht->swiss) ? swiss_table_size(ht->swiss) : ht->size;
 }
 
 size_t hash_table_capacity(const struct hash_table* ht)
 {
-    return ht->capacity;
+    return (ht->swiss) ? swiss_table_capacity(ht->swiss) : ht->capacity;
+}
+
+void hash_table_get_probe_stats(const struct hash_table* ht, struct hash_table_probe_stats* out)
+{
+    assert(ht != NULL && out != NULL);
+    if (ht->swiss) {
+        swiss_table_get_probe_stats(ht->swiss, out);
+        return;
+    }
+    size_t max = 0, total = 0;
+    for (size_t i = 0; i < ht->capacity; i++) {
+        if (!is_live(ht, i))
+            continue;
+        size_t attempts;
+        if (ht->psl)
+            attempts = ht->psl[i] - 1;
+        else {
+            // Replay the probe sequence of the key up to its slot
+            struct probe p;
+            const void* key = get_key(&ht->items[i]);
+            probe_begin_hash(ht, &p, key, (ht->hashes) ? ht->hashes[i] : key_hash(ht, key), ht->capacity);
+            while (p.index != i)
+                probe_next(ht, &p);
+            attempts = p.attempts;
+        }
+        max = (attempts > max) ? attempts : max;
+        total += attempts;
+    }
+    for (size_t i = ht->migrated; ht->old_items && i < ht->old_capacity; i++) {
+        if (is_null(&ht->old_items[i]) || is_deleted(&ht->old_items[i]))
+            continue;
+        struct probe p;
+        const void* key = get_key(&ht->old_items[i]);
+        probe_begin_hash(ht, &p, key, (ht->old_hashes) ? ht->old_hashes[i] : key_hash(ht, key), ht->old_capacity);
+        while (p.index != i)
+            probe_next(ht, &p);
+        max = (p.attempts > max) ? p.attempts : max;
+        total += p.attempts;
+    }
+    out->max = max;
+    out->mean = (ht->size) ? (double) total / ht->size : 0.0;
+}
+
+#ifdef DS_STATS
+const struct hash_table_stats *hash_table_get_stats(const struct hash_table* ht)
+{
+    return (ht->swiss) ? swiss_table_get_stats(ht->swiss) : &ht->stats;
 }
 
+void hash_table_reset_stats(struct hash_table* ht)
+{
+    if (ht->swiss)
+        swiss_table_reset_stats(ht->swiss);
+    DS_STATS_RESET(ht->stats);
+}
+#endif // DS_STATS
+
 /* =========================================================================
  * Search
  * ========================================================================= */
@@ -174,15 +430,31 @@ size_t hash_table_capacity(const struct hash_table* ht)
 void* hash_table_search(struct hash_table* ht, const void* key)
 {
     assert(ht != NULL && key != NULL);
-    int attempts = 0;
-    int index = ht->hc.hash(key, ht->capacity, attempts);
-    struct ht_item* curr_item = &ht->items[index];
+    if (ht->swiss)
+        return swiss_table_search(ht->swiss, key);
+    migrate_step(ht);
+    if (ht->psl) {
+        size_t index, dist;
+        int found = rh_lookup(ht, key, ht->hc.hash64(key), &index, &dist);
+        RECORD_PROBE(ht, dist);
+        return (found) ? ht->items[index].value : NULL;
+    }
+    struct probe p;
+    probe_begin(ht, &p, key);
+    struct ht_item* curr_item = &ht->items[p.index];
     while (!is_null(curr_item)) {
-        if (!is_deleted(curr_item) && ht->hc.cmp_key(get_key(curr_item), key) == 0)
+        if (!is_deleted(curr_item) && key_matches(ht, p.index, key, p.hash)) {
+            RECORD_PROBE(ht, p.attempts);
             return curr_item->value;
-        attempts++;
-        index = ht->hc.hash(key, ht->capacity, attempts);
-        curr_item = &ht->items[index];
+        }
+        probe_next(ht, &p);
+        curr_item = &ht->items[p.index];
+    }
+    RECORD_PROBE(ht, p.attempts);
+    if (ht->old_items) {
+        struct ht_item* old_item = old_lookup(ht, key, p.hash);
+        if (old_item)
+            return old_item->value;
     }
     return NULL; // Key not found
 }
@@ -194,25 +466,91 @@ void* hash_table_search(struct hash_table* ht, const void* key)
 void hash_table_walk(struct hash_table* ht, void* context, void (*exec) (void* key, void* value, void* context))
 {
     assert(ht != NULL && exec != NULL);
+    if (ht->swiss) {
+        swiss_table_walk(ht->swiss, context, exec);
+        return;
+    }
     for (size_t i = 0; i < ht->capacity; i++) {
-        if (!is_null(&ht->items[i]) && !is_deleted(&ht->items[i]))
+        if (is_live(ht, i))
             exec(ht->items[i].key, ht->items[i].value, context);
     }
+    for (size_t i = ht->migrated; ht->old_items && i < ht->old_capacity; i++) {
+        if (!is_null(&ht->old_items[i]) && !is_deleted(&ht->old_items[i]))
+            exec(ht->old_items[i].key, ht->old_items[i].value, context);
+    }
 }
 
 // *** Helper functions *** //
 
 static int init_size_ht(struct hash_table* ht, size_t capacity)
 {
-    struct ht_item* _items = calloc(capacity, sizeof(struct ht_item));
+    struct ht_item* _items = alloc_items(ht, capacity);
+    if (!_items)
+        return 1;
+    memset(_items, 0, items_bytes(ht, capacity));
+    use_items(ht, _items, capacity);
+    ht->size = 0;
+    return 0;
+}
+
+static struct ht_item* alloc_items(struct hash_table* ht, size_t capacity)
+{
+    struct ht_item* _items = ht->sac.alloc(ht->sac.allocator, items_bytes(ht, capacity), _Alignof(struct ht_item));
     if (!_items) {
         LOG(LIB_LVL, CERROR, "Allocation failure");
-        return 1;
     }
-    ht->items = _items;
+    return _items;
+}
+
+static void use_items(struct hash_table* ht, struct ht_item* items, size_t capacity)
+{
+    ht->items = items;
+    // Optional arrays follow the items, widest first so each stays aligned
+    ht->hashes = (ht->store_hash) ? (uint64_t*) (items + capacity) : NULL;
+    ht->psl = NULL;
+    if (ht->probing == HASH_TABLE_PROBE_ROBIN_HOOD)
+        ht->psl = (ht->hashes) ? (uint32_t*) (ht->hashes + capacity) : (uint32_t*) (items + capacity);
     ht->capacity = capacity;
-    ht->size = 0;
-    return 0;
+}
+
+static inline uint64_t key_hash(const struct hash_table* ht, const void* key)
+{
+    return (ht->probing == HASH_TABLE_PROBE_CONCEPT) ? 0 : ht->hc.hash64(key);
+}
+
+static void probe_begin(const struct hash_table* ht, struct probe* p, const void* key)
+{
+    probe_begin_hash(ht, p, key, key_hash(ht, key), ht->capacity);
+}
+
+static void probe_begin_hash(const struct hash_table* ht, struct probe* p, const void* key, uint64_t hash, size_t capacity)
+{
+    p->key = key;
+    p->hash = hash;
+    p->capacity = capacity;
+    p->attempts = 0;
+    if (ht->probing == HASH_TABLE_PROBE_CONCEPT)
+        p->index = ht->hc.hash(key, capacity, 0);
+    else
+        p->index = (size_t) hash & (capacity - 1);
+}
+
+static void probe_next(const struct hash_table* ht, struct probe* p)
+{
+    p->attempts++;
+    switch (ht->probing) {
+        case HASH_TABLE_PROBE_CONCEPT:
+            p->index = ht->hc.hash(p->key, p->capacity, p->attempts);
+            break;
+        case HASH_TABLE_PROBE_LINEAR:
+        case HASH_TABLE_PROBE_ROBIN_HOOD:
+            p->index = (p->index + 1) & (p->capacity - 1);
+            break;
+        case HASH_TABLE_PROBE_QUADRATIC:
+            // Triangular numbers visit every slot of a power of two table
+            p->index = (p->index + p->attempts) & (p->capacity - 1);
+            break;
+    }
 }
 
 static void init_item(struct ht_item* item, void* key, void* value)
@@ -258,87 +596,255 @@ static inline int is_deleted(struct ht_item* item)
     return (get_key(item) == &deleted && get_value(item) == &deleted);
 }
 
+static inline int is_live(const struct hash_table* ht, size_t i)
+{
+    if (ht->psl)
+        return ht->psl[i] != 0;
+    return !is_null(&ht->items[i]) && !is_deleted(&ht->items[i]);
+}
+
+static inline int key_matches(const struct hash_table* ht, size_t i, const void* key, uint64_t hash)
+{
+    if (ht->hashes && ht->hashes[i] != hash)
+        return 0;
+    return ht->hc.cmp_key(get_key(&ht->items[i]), key) == 0;
+}
+
+static int rh_lookup(const struct hash_table* ht, const void* key, uint64_t hash, size_t* index, size_t* dist)
+{
+    size_t mask = ht->capacity - 1;
+    size_t i = (size_t) hash & mask;
+    size_t d = 0;
+    // A run is sorted by distance, an entry closer to its home than d means key is not here
+    for (; ht->psl[i] > d; i = (i + 1) & mask, d++) {
+        // Only an entry at the same distance shares the home slot of key
+        if (ht->psl[i] == d + 1 && key_matches(ht, i, key, hash)) {
+            *index = i;
+            *dist = d;
+            return 1;
+        }
+    }
+    *index = i;
+    *dist = d;
+    return 0;
+}
+
+static void rh_place(struct hash_table* ht, size_t index, size_t dist, void* key, void* value, uint64_t hash)
+{
+    size_t mask = ht->capacity - 1;
+    struct ht_item carry = { key, value };
+    uint32_t carry_psl = (uint32_t) dist + 1;
+    for (; ht->psl[index] != 0; index = (index + 1) & mask, carry_psl++) {
+        // Take the slot from a richer entry, it continues the walk instead
+        if (ht->psl[index] < carry_psl) {
+            struct ht_item item = ht->items[index];
+            uint32_t psl = ht->psl[index];
+            ht->items[index] = carry;
+            ht->psl[index] = carry_psl;
+            carry = item;
+            carry_psl = psl;
+            if (ht->hashes) {
+                uint64_t h = ht->hashes[index];
+                ht->hashes[index] = hash;
+                hash = h;
+            }
+        }
+    }
+    ht->items[index] = carry;
+    ht->psl[index] = carry_psl;
+    if (ht->hashes)
+        ht->hashes[index] = hash;
+}
+
+static void rh_erase(struct hash_table* ht, size_t index)
+{
+    size_t mask = ht->capacity - 1;
+    size_t next = (index + 1) & mask;
+    // Entries at their home slot (distance 0) end the shift
+    for (; ht->psl[next] > 1; index = next, next = (next + 1) & mask) {
+        ht->items[index] = ht->items[next];
+        ht->psl[index] = ht->psl[next] - 1;
+        if (ht->hashes)
+            ht->hashes[index] = ht->hashes[next];
+    }
+    init_item(&ht->items[index], NULL, NULL);
+    ht->psl[index] = 0;
+}
+
 static int resize(struct hash_table* ht, float factor)
 {
-    size_t target_size = (size_t)((float)ht->capacity * factor);
-    // Ensure we don't go below the minimum base prime
-    if (target_size < BASE_PRIME) {
-        target_size = BASE_PRIME;
+    size_t new_capacity = next_capacity(ht, factor);
+    if (new_capacity == 0) {
+        LOG(LIB_LVL, CERROR, "No larger capacity");
+        return 1;
     }
-    size_t new_capacity = next_prime((int)target_size);
     if (new_capacity == ht->capacity) {
         LOG(LIB_LVL, CINFO, "Resize resulted in same capacity, skipping.");
         return 0;
     }
+    if (ht->incremental) {
+        // Later calls zero the array and then move the pairs, see migrate_step
+        struct ht_item* fresh_items = alloc_items(ht, new_capacity);
+        if (!fresh_items)
+            return 1;
+        ht->fresh_items = fresh_items;
+        ht->fresh_capacity = new_capacity;
+        ht->zeroed = 0;
+        DS_STATS_INC(ht->stats.resizes);
+        return 0;
+    }
     struct ht_item* old_items = ht->items;
+    uint64_t* old_hashes = ht->hashes;
+    uint32_t* old_psl = ht->psl;
     size_t old_capacity = ht->capacity;
     if (init_size_ht(ht, new_capacity) != 0) {
         LOG(LIB_LVL, CERROR, "init_size_ht failed");
         return 1;
     }
+    DS_STATS_INC(ht->stats.resizes);
     // Could not reuse hash_table_insert code because objects pointed to by key value pairs are already owned by this hash_table
     // So it is okay to copy, nothing redundant dynamic allocation and copy here
+    // Stored hashes spare calling hash64 on every key
     for (size_t i = 0; i < old_capacity; i++) {
         struct ht_item* curr_item = &old_items[i];
-        if (!is_null(curr_item) && !is_deleted(curr_item)) {
-            int attempts = 0;
-            int index = ht->hc.hash(get_key(curr_item), ht->capacity, attempts);
-            struct ht_item* curr_slot = &ht->items[index];
-            while (!is_null(curr_slot)) {
-                attempts++;
-                index = ht->hc.hash(get_key(curr_item), ht->capacity, attempts);
-                curr_slot = &ht->items[index];
+        if (old_psl) {
+            if (old_psl[i] != 0) {
+                uint64_t hash = (old_hashes) ? old_hashes[i] : ht->hc.hash64(get_key(curr_item));
+                rh_place(ht, (size_t) hash & (ht->capacity - 1), 0, curr_item->key, curr_item->value, hash);
+                ht->size++;
             }
-            *curr_slot = *curr_item;
-            ht->size++; 
+        } else if (!is_null(curr_item) && !is_deleted(curr_item)) {
+            uint64_t hash = (old_hashes) ? old_hashes[i] : key_hash(ht, get_key(curr_item));
+            place_item(ht, curr_item->key, curr_item->value, hash);
+            ht->size++;
         }
     }
-    free(old_items);
+    free_items(ht, old_items, old_capacity);
     return 0;
 }
 
+static void place_item(struct hash_table* ht, void* key, void* value, uint64_t hash)
+{
+    struct probe p;
+    probe_begin_hash(ht, &p, key, hash, ht->capacity);
+    while (!is_null(&ht->items[p.index]) && !is_deleted(&ht->items[p.index]))
+        probe_next(ht, &p);
+    init_item(&ht->items[p.index], key, value);
+    if (ht->hashes)
+        ht->hashes[p.index] = hash;
+}
+
+static struct ht_item* old_lookup(struct hash_table* ht, const void* key, uint64_t hash)
+{
+    struct probe p;
+    probe_begin_hash(ht, &p, key, hash, ht->old_capacity);
+    for (struct ht_item* item = &ht->old_items[p.index]; !is_null(item); item = &ht->old_items[p.index]) {
+        if (!is_deleted(item) && (!ht->old_hashes || ht->old_hashes[p.index] == hash)
+            && ht->hc.cmp_key(get_key(item), key) == 0)
+            return item;
+        probe_next(ht, &p);
+    }
+    return NULL;
+}
+
+static void migrate_step(struct hash_table* ht)
+{
+    if (ht->fresh_items) {
+        zero_step(ht);
+        return;
+    }
+    if (!ht->old_items)
+        return;
+    size_t end = (ht->migrated + MIGRATE_SLOTS < ht->old_capacity) ? ht->migrated + MIGRATE_SLOTS : ht->old_capacity;
+    for (; ht->migrated < end; ht->migrated++) {
+        struct ht_item* item = &ht->old_items[ht->migrated];
+        if (is_null(item) || is_deleted(item))
+            continue;
+        uint64_t hash = (ht->old_hashes) ? ht->old_hashes[ht->migrated] : key_hash(ht, get_key(item));
+        place_item(ht, item->key, item->value, hash);
+        // Keeps old probe sequences going past the moved pair
+        mark_item(item);
+    }
+    if (ht->migrated == ht->old_capacity) {
+        free_items(ht, ht->old_items, ht->old_capacity);
+        ht->old_items = NULL;
+        ht->old_hashes = NULL;
+    }
+}
+
+static void zero_step(struct hash_table* ht)
+{
+    size_t bytes = items_bytes(ht, ht->fresh_capacity);
+    size_t chunk = items_bytes(ht, ZERO_SLOTS);
+    if (chunk > bytes - ht->zeroed)
+        chunk = bytes - ht->zeroed;
+    memset((char*) ht->fresh_items + ht->zeroed, 0, chunk);
+    ht->zeroed += chunk;
+    if (ht->zeroed < bytes)
+        return;
+    // Pairs move from the next call on, lookups check both arrays meanwhile
+    ht->old_items = ht->items;
+    ht->old_hashes = ht->hashes;
+    ht->old_capacity = ht->capacity;
+    ht->migrated = 0;
+    use_items(ht, ht->fresh_items, ht->fresh_capacity);
+    ht->fresh_items = NULL;
+}
+
+static size_t items_bytes(const struct hash_table* ht, size_t capacity)
+{
+    size_t bytes = capacity * sizeof(struct ht_item);
+    if (ht->store_hash)
+        bytes += capacity * sizeof(uint64_t);
+    if (ht->probing == HASH_TABLE_PROBE_ROBIN_HOOD)
+        bytes += capacity * sizeof(uint32_t);
+    return bytes;
+}
+
+static void free_items(struct hash_table* ht, struct ht_item* items, size_t capacity)
+{
+    if (ht->sac.free)
+        ht->sac.free(ht->sac.allocator, items, items_bytes(ht, capacity));
+}
+
 static int resize_up(struct hash_table* ht, float load)
 {
     if (load < UP_LOAD_RATIO)
         return 0;
+    // The old array keeps taking pairs while the new one is zeroed, ZERO_SLOTS keeps it from filling
+    if (ht->fresh_items)
+        return 0;
+    // MIGRATE_SLOTS keeps this from happening, a second array is never started before the first is drained
+    while (ht->old_items)
+        migrate_step(ht);
     return resize(ht, FACTOR_UP);
 }
 
 static int resize_down(struct hash_table* ht, float load)
 {
-    if (load >= DOWN_LOAD_RATIO)
+    if (load >= DOWN_LOAD_RATIO || ht->old_items || ht->fresh_items)
         return 0;
     return resize(ht, FACTOR_DOWN);
 }
 
-// https://github.com/jamesroutley/write-a-hash-table/tree/master/06-resizing
-
-/*
- * Return whether x is prime or not
- *
- * Returns:
- *   1  - prime
- *   0  - not prime
- *   -1 - undefined (i.e. x < 2)
- */
-static int is_prime(const int x) {
-    if (x < 2) { return -1; }
-    if (x < 4) { return 1; }
-    if ((x % 2) == 0) { return 0; }
-    for (int i = 3; i * i <= x; i += 2) {
-        if ((x % i) == 0)
-            return 0;
-    }
-    return 1;
-}
-
+// Next prime after doubling, the sequence trial division used to give, so HASH_TABLE_PROBE_CONCEPT tables resize without trial division
+static const size_t primes[] = {
+    53, 107, 223, 449, 907, 1823, 3659, 7321, 14653, 29311, 58631, 117269, 234539, 469099,
+    938207, 1876417, 3752839, 7505681, 15011389, 30022781, 60045577, 120091177, 240182359,
+    480364727, 960729461, 1921458943, 3842917907u
+};
 
-/*
- * Return the next prime after x, or x if x is prime
- */
-static int next_prime(int x) {
-    while (is_prime(x) != 1) {
-        x++;
+static size_t next_capacity(const struct hash_table* ht, float factor)
+{
+    if (ht->probing != HASH_TABLE_PROBE_CONCEPT) {
+        size_t target = (size_t)((float)ht->capacity * factor);
+        return (target < BASE_POW2) ? BASE_POW2 : target;
     }
-    return x;
-}
\ No newline at end of file
+    size_t count = sizeof(primes) / sizeof(primes[0]);
+    size_t i = 0;
+    while (i < count && primes[i] < ht->capacity)
+        i++;
+    if (factor > 1)
+        return (i + 1 < count) ? primes[i + 1] : 0;
+    return (i > 0) ? primes[i - 1] : BASE_PRIME;
+}
@@ -0,0 +1,376 @@
+#include <ds/hashs/swiss_table.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <assert.h>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+#define BASE_CAPACITY 64
+#define DOWN_LOAD_RATIO 0.1
+
+// Control bytes, full slots hold the low 7 bits of the hash so the top bit tells them apart
+#define CTRL_EMPTY   ((int8_t) -128)
+#define CTRL_DELETED ((int8_t) -2)
+
+struct st_slot {
+    void*        key;
+    void*        value;
+};
+
+struct swiss_table {
+    int8_t*                         ctrl;           // capacity control bytes, after slots in the same block
+    struct st_slot*                 slots;
+    size_t                          capacity;
+    size_t                          size;
+    size_t                          growth_left;    // Empty slots that may still be filled before a rehash
+    struct hash_concept             hc;
+    struct sized_allocator_concept  sac;
+    DS_STATS_FIELD(struct hash_table_stats, stats)
+};
+
+#ifdef DS_STATS
+    #define RECORD_PROBE(st, attempts) DS_STATS_INC((st)->stats.probes[((attempts) < HASH_TABLE_PROBE_BUCKETS) ? (attempts) : HASH_TABLE_PROBE_BUCKETS - 1])
+#else
+    #define RECORD_PROBE(st, attempts) ((void) 0)
+#endif // DS_STATS
+
+// Bit i set if control byte i of the group satisfies the test
+typedef uint32_t group_mask;
+
+// Group level helpers
+
+// Slots of the group whose control byte equals h2
+static group_mask match_byte(const int8_t* group, int8_t h2);
+// Empty slots of the group
+static group_mask match_empty(const int8_t* group);
+// Empty or deleted slots of the group
+static group_mask match_free(const int8_t* group);
+
+// swiss_table helpers
+
+// Splits hash64 into the group selector (h1) and the control byte (h2)
+static inline size_t h1(uint64_t hash) { return (size_t) (hash >> 7); }
+static inline int8_t h2(uint64_t hash) { return (int8_t) (hash & 0x7f); }
+// Allocates an all empty table of capacity slots into st, leaves st untouched on failure
+static int init_slots(struct swiss_table* st, size_t capacity);
+// Releases the block holding slots and their control bytes
+static void free_slots(struct swiss_table* st, struct st_slot* slots, size_t capacity);
+// At most 7/8 of the slots are filled, the rest keeps probe sequences short
+static inline size_t max_load(size_t capacity) { return capacity - capacity / 8; }
+// Index of the first free slot on the probe sequence of hash, there is always one
+static size_t find_free(const struct swiss_table* st, uint64_t hash);
+// Rebuilds the table with capacity slots, dropping tombstones, returns 0 if it succeeds, 1 otherwise
+// Leaves object's state the same as before the function call in case of failure
+static int rehash(struct swiss_table* st, size_t capacity);
+
+/* =========================================================================
+ * Create & Destroy
+ * ========================================================================= */
+
+struct swiss_table* swiss_table_create(struct hash_concept *hc, const struct sized_allocator_concept *sac)
+{
+    assert(hc != NULL);
+    if (hc->hash64 == NULL) {
+        LOG(LIB_LVL, CERROR, "swiss_table needs hash64");
+        return NULL;
+    }
+    struct swiss_table* st = malloc(sizeof(*st));
+    if (st == NULL) {
+        LOG(LIB_LVL, CERROR, "malloc failed");
+        return NULL;
+    }
+    st->sac = (sac) ? *sac : sysallocator_sized();
+    if (init_slots(st, BASE_CAPACITY) != 0) {
+        LOG(LIB_LVL, CERROR, "init_slots failed");
+        free(st);
+        return NULL;
+    }
+    st->size = 0;
+    st->hc = *hc;
+    DS_STATS_RESET(st->stats);
+    return st;
+}
+
+void swiss_table_destroy(struct swiss_table* st, struct object_concept *oc)
+{
+    assert(st != NULL);
+    if (oc != NULL && oc->deinit != NULL) {
+        for (size_t i = 0; i < st->capacity; i++) {
+            if (st->ctrl[i] >= 0) {
+                oc->deinit(st->slots[i].key);
+                oc->deinit(st->slots[i].value);
+            }
+        }
+    }
+    free_slots(st, st->slots, st->capacity);
+    free(st);
+}
+
+/* =========================================================================
+ * Insertion & Removal
+ * ========================================================================= */
+
+int swiss_table_insert(struct swiss_table* st, void* key, void* value)
+{
+    assert(st != NULL && key != NULL && value != NULL);
+    uint64_t hash = st->hc.hash64(key);
+    size_t mask = st->capacity / SWISS_TABLE_GROUP - 1;
+    size_t group = h1(hash) & mask;
+    size_t first_free = st->capacity;
+    for (size_t attempts = 0; ; group = (group + ++attempts) & mask) {
+        const int8_t* ctrl = &st->ctrl[group * SWISS_TABLE_GROUP];
+        for (group_mask m = match_byte(ctrl, h2(hash)); m != 0; m &= m - 1) {
+            struct st_slot* slot = &st->slots[group * SWISS_TABLE_GROUP + __builtin_ctz(m)];
+            if (st->hc.cmp_key(slot->key, key) == 0) {
+                slot->value = value;
+                RECORD_PROBE(st, attempts);
+                return 0;
+            }
+        }
+        group_mask free_mask = match_free(ctrl);
+        if (first_free == st->capacity && free_mask != 0)
+            first_free = group * SWISS_TABLE_GROUP + __builtin_ctz(free_mask);
+        if (match_empty(ctrl) != 0) {
+            RECORD_PROBE(st, attempts);
+            break;
+        }
+    }
+    // Reusing a tombstone costs no growth, filling an empty slot does
+    if (st->ctrl[first_free] == CTRL_EMPTY && st->growth_left == 0) {
+        // Tombstones alone can fill the table, purge them in place if the live pairs fit in half
+        size_t capacity = (st->size + 1 > max_load(st->capacity) / 2) ? st->capacity * 2 : st->capacity;
+        if (rehash(st, capacity) != 0) {
+            LOG(LIB_LVL, CERROR, "Could not grow the swiss_table");
+            return 1;
+        }
+        first_free = find_free(st, hash);
+    }
+    if (st->ctrl[first_free] == CTRL_EMPTY)
+        st->growth_left--;
+    st->ctrl[first_free] = h2(hash);
+    st->slots[first_free].key = key;
+    st->slots[first_free].value = value;
+    st->size++;
+    return 0;
+}
+
+int swiss_table_remove(struct swiss_table* st, const void* key)
+{
+    assert(st != NULL && key != NULL);
+    uint64_t hash = st->hc.hash64(key);
+    size_t mask = st->capacity / SWISS_TABLE_GROUP - 1;
+    size_t group = h1(hash) & mask;
+    for (size_t attempts = 0; ; group = (group + ++attempts) & mask) {
+        int8_t* ctrl = &st->ctrl[group * SWISS_TABLE_GROUP];
+        for (group_mask m = match_byte(ctrl, h2(hash)); m != 0; m &= m - 1) {
+            int i = __builtin_ctz(m);
+            if (st->hc.cmp_key(st->slots[group * SWISS_TABLE_GROUP + i].key, key) != 0)
+                continue;
+            RECORD_PROBE(st, attempts);
+            // No probe went past a group that still has an empty slot, so the slot can be empty
+            // again instead of a tombstone
+            int was_full = (match_empty(ctrl) == 0);
+            ctrl[i] = (was_full) ? CTRL_DELETED : CTRL_EMPTY;
+            st->growth_left += !was_full;
+            st->size--;
+            if ((float) st->size / st->capacity < DOWN_LOAD_RATIO && st->capacity > BASE_CAPACITY
+                && rehash(st, st->capacity / 2) != 0) {
+                LOG(LIB_LVL, CERROR, "Could not shrink the swiss_table");
+                ctrl[i] = h2(hash);
+                st->growth_left -= !was_full;
+                st->size++;
+                return 1;
+            }
+            return 0;
+        }
+        if (match_empty(ctrl) != 0) {
+            RECORD_PROBE(st, attempts);
+            LOG(LIB_LVL, CINFO, "The key to be deleted couldnt be found");
+            return 1;
+        }
+    }
+}
+
+/* =========================================================================
+ * Properties
+ * ========================================================================= */
+
+size_t swiss_table_size(const struct swiss_table* st)
+{
+    return st->size;
+}
+
+size_t swiss_table_capacity(const struct swiss_table* st)
+{
+    return st->capacity;
+}
+
+void swiss_table_get_probe_stats(const struct swiss_table* st, struct hash_table_probe_stats* out)
+{
+    assert(st != NULL && out != NULL);
+    size_t mask = st->capacity / SWISS_TABLE_GROUP - 1;
+    size_t max = 0, total = 0;
+    for (size_t i = 0; i < st->capacity; i++) {
+        if (st->ctrl[i] < 0)
+            continue;
+        // Replay the group sequence of the key up to the group of its slot
+        size_t group = h1(st->hc.hash64(st->slots[i].key)) & mask;
+        size_t attempts = 0;
+        while (group != i / SWISS_TABLE_GROUP)
+            group = (group + ++attempts) & mask;
+        max = (attempts > max) ? attempts : max;
+        total += attempts;
+    }
+    out->max = max;
+    out->mean = (st->size) ? (double) total / st->size : 0.0;
+}
+
+#ifdef DS_STATS
+const struct hash_table_stats *swiss_table_get_stats(const struct swiss_table* st)
+{
+    return &st->stats;
+}
+
+void swiss_table_reset_stats(struct swiss_table* st)
+{
+    DS_STATS_RESET(st->stats);
+}
+#endif // DS_STATS
+
+/* =========================================================================
+ * Search & Iteration
+ * ========================================================================= */
+
+void* swiss_table_search(struct swiss_table* st, const void* key)
+{
+    assert(st != NULL && key != NULL);
+    uint64_t hash = st->hc.hash64(key);
+    size_t mask = st->capacity / SWISS_TABLE_GROUP - 1;
+    size_t group = h1(hash) & mask;
+    for (size_t attempts = 0; ; group = (group + ++attempts) & mask) {
+        const int8_t* ctrl = &st->ctrl[group * SWISS_TABLE_GROUP];
+        for (group_mask m = match_byte(ctrl, h2(hash)); m != 0; m &= m - 1) {
+            struct st_slot* slot = &st->slots[group * SWISS_TABLE_GROUP + __builtin_ctz(m)];
+            if (st->hc.cmp_key(slot->key, key) == 0) {
+                RECORD_PROBE(st, attempts);
+                return slot->value;
+            }
+        }
+        if (match_empty(ctrl) != 0) {
+            RECORD_PROBE(st, attempts);
+            return NULL; // Key not found
+        }
+    }
+}
+
+void swiss_table_walk(struct swiss_table* st, void* context, void (*exec) (void* key, void* value, void* context))
+{
+    assert(st != NULL && exec != NULL);
+    for (size_t i = 0; i < st->capacity; i++) {
+        if (st->ctrl[i] >= 0)
+            exec(st->slots[i].key, st->slots[i].value, context);
+    }
+}
+
+// *** Helper functions *** //
+
+#ifdef __SSE2__
+static inline group_mask match_byte(const int8_t* group, int8_t h2)
+{
+    __m128i ctrl = _mm_load_si128((const __m128i*) group);
+    return (group_mask) _mm_movemask_epi8(_mm_cmpeq_epi8(ctrl, _mm_set1_epi8(h2)));
+}
+
+static inline group_mask match_empty(const int8_t* group)
+{
+    return match_byte(group, CTRL_EMPTY);
+}
+
+static inline group_mask match_free(const int8_t* group)
+{
+    // Only empty and deleted bytes have the top bit set
+    return (group_mask) _mm_movemask_epi8(_mm_load_si128((const __m128i*) group));
+}
+#else
+static inline group_mask match_byte(const int8_t* group, int8_t h2)
+{
+    group_mask m = 0;
+    for (int i = 0; i < SWISS_TABLE_GROUP; i++)
+        m |= (group_mask) (group[i] == h2) << i;
+    return m;
+}
+
+static inline group_mask match_empty(const int8_t* group)
+{
+    return match_byte(group, CTRL_EMPTY);
+}
+
+static inline group_mask match_free(const int8_t* group)
+{
+    group_mask m = 0;
+    for (int i = 0; i < SWISS_TABLE_GROUP; i++)
+        m |= (group_mask) (group[i] < 0) << i;
+    return m;
+}
+#endif // __SSE2__
+
+static int init_slots(struct swiss_table* st, size_t capacity)
+{
+    // Slots first, capacity is a multiple of 16 so the control bytes stay 16 byte aligned
+    size_t bytes = capacity * sizeof(struct st_slot) + capacity;
+    struct st_slot* slots = st->sac.alloc(st->sac.allocator, bytes, SWISS_TABLE_GROUP);
+    if (!slots) {
+        LOG(LIB_LVL, CERROR, "Allocation failure");
+        return 1;
+    }
+    st->slots = slots;
+    st->ctrl = (int8_t*) (slots + capacity);
+    memset(st->ctrl, CTRL_EMPTY, capacity);
+    st->capacity = capacity;
+    st->growth_left = max_load(capacity);
+    return 0;
+}
+
+static void free_slots(struct swiss_table* st, struct st_slot* slots, size_t capacity)
+{
+    if (st->sac.free)
+        st->sac.free(st->sac.allocator, slots, capacity * sizeof(struct st_slot) + capacity);
+}
+
+static size_t find_free(const struct swiss_table* st, uint64_t hash)
+{
+    size_t mask = st->capacity / SWISS_TABLE_GROUP - 1;
+    size_t group = h1(hash) & mask;
+    for (size_t attempts = 0; ; group = (group + ++attempts) & mask) {
+        group_mask m = match_free(&st->ctrl[group * SWISS_TABLE_GROUP]);
+        if (m != 0)
+            return group * SWISS_TABLE_GROUP + __builtin_ctz(m);
+    }
+}
+
+static int rehash(struct swiss_table* st, size_t capacity)
+{
+    int8_t* old_ctrl = st->ctrl;
+    struct st_slot* old_slots = st->slots;
+    size_t old_capacity = st->capacity;
+    if (init_slots(st, capacity) != 0) {
+        LOG(LIB_LVL, CERROR, "init_slots failed");
+        return 1;
+    }
+    // Keys are known to be distinct, so pairs go straight to the first free slot
+    for (size_t i = 0; i < old_capacity; i++) {
+        if (old_ctrl[i] < 0)
+            continue;
+        uint64_t hash = st->hc.hash64(old_slots[i].key);
+        size_t index = find_free(st, hash);
+        st->ctrl[index] = h2(hash);
+        st->slots[index] = old_slots[i];
+    }
+    st->growth_left -= st->size;
+    free_slots(st, old_slots, old_capacity);
+    DS_STATS_INC(st->stats.resizes);
+    return 0;
+}
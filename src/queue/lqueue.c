@@ -78,7 +78,8 @@ void *ldequeue(struct lqueue *lq)
         lq->rear = slist_head(&lq->contents);
     struct queue_item *qui = slist_entry(to_remove, struct queue_item, hook);
     void *data = qui->data;
-    lq->ac.free(lq->ac.allocator, qui);
+    if (lq->ac.free)
+        lq->ac.free(lq->ac.allocator, qui);
     return data;
 }
 
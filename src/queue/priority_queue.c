@@ -13,13 +13,19 @@ struct priority_queue
  *───────────────────────────────────────────────*/
 
 struct priority_queue *priority_queue_create(size_t obj_size, struct object_concept *oc, int (*cmp) (const void *a, const void *b))
+{
+    return priority_queue_create_with(obj_size, oc, cmp, NULL);
+}
+
+struct priority_queue *priority_queue_create_with(size_t obj_size, struct object_concept *oc, int (*cmp) (const void *a, const void *b),
+                                                  const struct sized_allocator_concept *sac)
 {
     struct priority_queue *pq = malloc(sizeof(struct priority_queue));
     if (!pq) {
         LOG(LIB_LVL, CERROR, "Allocation failure");
         return NULL;
     }
-    if (array_heap_init(&pq->heap, obj_size, oc, cmp) != 0) {
+    if (array_heap_init_with(&pq->heap, obj_size, oc, cmp, sac) != 0) {
         LOG(LIB_LVL, CERROR, "Failed to create heap for priority queue");
         free(pq);
         return NULL;
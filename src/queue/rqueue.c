@@ -0,0 +1,279 @@
+#include <ds/queue/rqueue.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define INITIAL_CAPACITY 8
+#define RQUEUE_ALIGN _Alignof(max_align_t)
+
+struct rqueue {
+    char                            *buffer;
+    size_t                          head;       // Slot of the front item
+    size_t                          size;
+    size_t                          capacity;   // Power of two
+    size_t                          obj_size;
+    struct object_concept           oc;
+    struct sized_allocator_concept  sac;
+};
+
+#define slot_at(rq, i) ((rq)->buffer + (((rq)->head + (i)) & ((rq)->capacity - 1)) * (rq)->obj_size)
+
+static int rqueue_grow(struct rqueue *rq, size_t new_capacity);
+static void relocate(struct rqueue *rq, char *dest, char *src, size_t count);
+static inline void copy_slot(void *dest, const void *src, size_t size);
+
+/* =========================================================================
+ * Create & Destroy
+ * ========================================================================= */
+
+struct rqueue *rqueue_create(size_t obj_size, struct object_concept *oc)
+{
+    return rqueue_create_with(obj_size, oc, NULL);
+}
+
+struct rqueue *rqueue_create_with(size_t obj_size, struct object_concept *oc, const struct sized_allocator_concept *sac)
+{
+    assert(obj_size != 0);
+    assert(oc != NULL);
+    struct rqueue *rq = malloc(sizeof(struct rqueue));
+    if (!rq) {
+        LOG(LIB_LVL, CERROR, "Allocation failure");
+        return NULL;
+    }
+    rq->sac = (sac) ? *sac : sysallocator_sized();
+    rq->buffer = rq->sac.alloc(rq->sac.allocator, INITIAL_CAPACITY * obj_size, RQUEUE_ALIGN);
+    if (!rq->buffer) {
+        LOG(LIB_LVL, CERROR, "Could not allocate the buffer");
+        free(rq);
+        return NULL;
+    }
+    rq->head = 0;
+    rq->size = 0;
+    rq->capacity = INITIAL_CAPACITY;
+    rq->obj_size = obj_size;
+    rq->oc = *oc;
+    return rq;
+}
+
+void rqueue_destroy(struct rqueue *rq)
+{
+    assert(rq != NULL);
+    if (rq->oc.deinit) {
+        for (size_t i = 0; i < rq->size; i++)
+            rq->oc.deinit(slot_at(rq, i));
+    }
+    if (rq->sac.free)
+        rq->sac.free(rq->sac.allocator, rq->buffer, rq->capacity * rq->obj_size);
+    free(rq);
+}
+
+int rqueue_reserve(struct rqueue *rq, size_t capacity)
+{
+    assert(rq != NULL);
+    size_t new_capacity = rq->capacity;
+    while (new_capacity < capacity)
+        new_capacity *= 2;
+    return (new_capacity != rq->capacity) ? rqueue_grow(rq, new_capacity) : 0;
+}
+
+/* =========================================================================
+ * Enqueue & Dequeue
+ * ========================================================================= */
+
+int renqueue(struct rqueue *rq, void *new_item)
+{
+    assert(rq != NULL);
+    if (rq->size == rq->capacity && rqueue_grow(rq, 2 * rq->capacity) != 0)
+        return 1;
+    if (object_concept_trivial(&rq->oc))
+        copy_slot(slot_at(rq, rq->size), new_item, rq->obj_size);
+    else if (rq->oc.init(slot_at(rq, rq->size), new_item) != 0)
+        return 1;
+    rq->size++;
+    return 0;
+}
+
+int rdequeue(struct rqueue *rq, void *dequeued_item)
+{
+    assert(rq != NULL);
+    if (rq->size == 0)
+        return -1;
+    char *front = rq->buffer + rq->head * rq->obj_size;
+    if (dequeued_item && rq->oc.move == NULL)
+        copy_slot(dequeued_item, front, rq->obj_size);
+    else if (dequeued_item)
+        rq->oc.move(dequeued_item, front);
+    else
+        object_concept_deinit(&rq->oc, front);
+    rq->head = (rq->head + 1) & (rq->capacity - 1);
+    rq->size--;
+    return 0;
+}
+
+int renqueue_n(struct rqueue *rq, void *items, size_t count)
+{
+    assert(rq != NULL && (items != NULL || count == 0));
+    if (count == 0)
+        return 0;
+    if (rq->size + count > rq->capacity && rqueue_reserve(rq, rq->size + count) != 0)
+        return 1;
+    char *src = items;
+    if (object_concept_trivial(&rq->oc)) {
+        // Free slots run from the rear to the end of the buffer, then wrap
+        size_t rear = (rq->head + rq->size) & (rq->capacity - 1);
+        size_t first = (count < rq->capacity - rear) ? count : rq->capacity - rear;
+        memcpy(rq->buffer + rear * rq->obj_size, src, first * rq->obj_size);
+        memcpy(rq->buffer, src + first * rq->obj_size, (count - first) * rq->obj_size);
+        rq->size += count;
+        return 0;
+    }
+    for (size_t i = 0; i < count; i++) {
+        if (rq->oc.init(slot_at(rq, rq->size + i), src + i * rq->obj_size) != 0) {
+            // Rolls back the ones already enqueued
+            while (i--)
+                object_concept_deinit(&rq->oc, slot_at(rq, rq->size + i));
+            return 1;
+        }
+    }
+    rq->size += count;
+    return 0;
+}
+
+size_t rdequeue_n(struct rqueue *rq, void *items, size_t count)
+{
+    assert(rq != NULL);
+    if (count > rq->size)
+        count = rq->size;
+    char *dest = items;
+    for (size_t done = 0; done < count;) {
+        // Items run from the head to the end of the buffer, then wrap
+        size_t run = rq->capacity - rq->head;
+        if (run > count - done)
+            run = count - done;
+        char *src = rq->buffer + rq->head * rq->obj_size;
+        if (dest) {
+            relocate(rq, dest + done * rq->obj_size, src, run);
+        } else if (rq->oc.deinit) {
+            for (size_t i = 0; i < run; i++)
+                rq->oc.deinit(src + i * rq->obj_size);
+        }
+        rq->head = (rq->head + run) & (rq->capacity - 1);
+        rq->size -= run;
+        done += run;
+    }
+    return count;
+}
+
+/* =========================================================================
+ * Inspection
+ * ========================================================================= */
+
+int rqueue_front(struct rqueue *rq, void *front_item)
+{
+    assert(rq != NULL);
+    if (rq->size == 0)
+        return -1;
+    return object_concept_init(&rq->oc, front_item, slot_at(rq, 0), rq->obj_size);
+}
+
+void *rqueue_at(struct rqueue *rq, size_t index)
+{
+    assert(rq != NULL);
+    return (index < rq->size) ? slot_at(rq, index) : NULL;
+}
+
+void rqueue_spans(struct rqueue *rq, struct array *first, struct array *second)
+{
+    assert(rq != NULL && first != NULL && second != NULL);
+    size_t run = rq->capacity - rq->head;
+    if (run > rq->size)
+        run = rq->size;
+    *first = (struct array) { rq->buffer + rq->head * rq->obj_size, run, rq->obj_size };
+    *second = (struct array) { rq->buffer, rq->size - run, rq->obj_size };
+}
+
+int rqueue_empty(const struct rqueue *rq)
+{
+    assert(rq != NULL);
+    return rq->size == 0;
+}
+
+size_t rqueue_size(const struct rqueue *rq)
+{
+    assert(rq != NULL);
+    return rq->size;
+}
+
+size_t rqueue_capacity(const struct rqueue *rq)
+{
+    assert(rq != NULL);
+    return rq->capacity;
+}
+
+/*───────────────────────────────────────────────
+ * Iterations
+ *───────────────────────────────────────────────*/
+
+void rqueue_walk(struct rqueue *rq, void *context, void (*handler) (void *item, void *context))
+{
+    assert(rq);
+    for (size_t i = 0; i < rq->size; i++)
+        handler(slot_at(rq, i), context);
+}
+
+// *** Helper functions definitions *** //
+
+/*
+ * Leaves the items contiguous from the head. Bitwise relocatable items are grown in place
+ * thru the allocator and only the wrapped part is moved, past the old end of the buffer.
+ */
+static int rqueue_grow(struct rqueue *rq, size_t new_capacity)
+{
+    size_t old_capacity = rq->capacity, size = rq->obj_size;
+    size_t wrapped = (rq->head + rq->size > old_capacity) ? rq->head + rq->size - old_capacity : 0;
+    if (rq->oc.move == NULL) {
+        char *buffer = sized_realloc(&rq->sac, rq->buffer, old_capacity * size, new_capacity * size, RQUEUE_ALIGN);
+        if (!buffer) {
+            LOG(LIB_LVL, CERROR, "Could not grow the buffer");
+            return 1;
+        }
+        memcpy(buffer + old_capacity * size, buffer, wrapped * size);
+        rq->buffer = buffer;
+        rq->capacity = new_capacity;
+        return 0;
+    }
+    char *buffer = rq->sac.alloc(rq->sac.allocator, new_capacity * size, RQUEUE_ALIGN);
+    if (!buffer) {
+        LOG(LIB_LVL, CERROR, "Could not grow the buffer");
+        return 1;
+    }
+    size_t run = rq->size - wrapped;
+    relocate(rq, buffer, rq->buffer + rq->head * size, run);
+    relocate(rq, buffer + run * size, rq->buffer, wrapped);
+    if (rq->sac.free)
+        rq->sac.free(rq->sac.allocator, rq->buffer, old_capacity * size);
+    rq->buffer = buffer;
+    rq->head = 0;
+    rq->capacity = new_capacity;
+    return 0;
+}
+
+static void relocate(struct rqueue *rq, char *dest, char *src, size_t count)
+{
+    if (rq->oc.move == NULL) {
+        memcpy(dest, src, count * rq->obj_size);
+        return;
+    }
+    for (size_t i = 0; i < count; i++)
+        rq->oc.move(dest + i * rq->obj_size, src + i * rq->obj_size);
+}
+
+// Constant sized copies of pointers and words compile into plain moves
+static inline void copy_slot(void *dest, const void *src, size_t size)
+{
+    if (size == sizeof(void *))
+        memcpy(dest, src, sizeof(void *));
+    else if (size == sizeof(int))
+        memcpy(dest, src, sizeof(int));
+    else
+        memcpy(dest, src, size);
+}
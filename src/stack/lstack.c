@@ -72,7 +72,8 @@ void *lpop(struct lstack *ls)
     slist_remove(&ls->contents, head);
     struct stack_item *sti = slist_entry(to_remove, struct stack_item, hook);
     void *data = sti->data;
-    ls->ac.free(ls->ac.allocator, sti);
+    if (ls->ac.free)
+        ls->ac.free(ls->ac.allocator, sti);
     return data;
 }
 
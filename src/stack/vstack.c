@@ -15,6 +15,11 @@ struct vstack {
  * ========================================================================= */
 
 struct vstack *vstack_create(size_t obj_size, struct object_concept *oc)
+{
+    return vstack_create_with(obj_size, oc, NULL);
+}
+
+struct vstack *vstack_create_with(size_t obj_size, struct object_concept *oc, const struct sized_allocator_concept *sac)
 {
     assert(obj_size != 0);
     assert(oc != NULL);
@@ -23,7 +28,7 @@ struct vstack *vstack_create(size_t obj_size, struct object_concept *oc)
         LOG(LIB_LVL, CERROR, "Allocation failure");
         return NULL;
     }
-    if (dynarray_init(&vs->contents, INITAL_CAPACITY, obj_size, *oc) != 0) {
+    if (dynarray_init_with(&vs->contents, INITAL_CAPACITY, obj_size, *oc, sac) != 0) {
         LOG(LIB_LVL, CERROR, "Could not initialize underlying dynarray");
         free(vs);
         return NULL;
@@ -53,11 +58,8 @@ int vpop(struct vstack *vs, void *popped_item)
     assert(vs != NULL);
     if (dynarray_empty(&vs->contents))
         return -1;
-    if (popped_item) {
-        int result = vs->contents.oc.init(popped_item, dynarray_back(&vs->contents));
-        if (result != 0)
-            return result;
-    }
+    if (popped_item)
+        return dynarray_extract_back(&vs->contents, popped_item);
     dynarray_pop_back(&vs->contents);
     return 0;
 }
@@ -72,7 +74,7 @@ int vtop(struct vstack *vs, void *top_item)
     void *data = dynarray_back(&vs->contents);
     if (data == NULL)
         return -1;
-    return vs->contents.oc.init(top_item, dynarray_back(&vs->contents));
+    return object_concept_init(&vs->contents.oc, top_item, data, dynarray_obj_size(&vs->contents));
 }
 
 int vstack_empty(const struct vstack *vs)
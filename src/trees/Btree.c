@@ -191,13 +191,18 @@ int Btree_init(struct Btree *tree, size_t order, int (*cmp) (const void *key, co
     tree->ac = *ac;
     tree->cmp = cmp;
     tree->size = 0;
+    tree->node_count = 1;
+    DS_STATS_RESET(tree->stats);
     return 0;
 }
 
 void Btree_deinit(struct Btree *tree, struct object_concept *oc)
 {
-    destroy_helper(tree->root, oc, &tree->ac);
+    // Nodes of region allocators are released in bulk, so there is nothing to visit
+    if (tree->ac.free || (oc && oc->deinit))
+        destroy_helper(tree->root, oc, &tree->ac);
     tree->root = NULL;
+    tree->node_count = 0;
 }
 
 /* =========================================================================
@@ -240,6 +245,8 @@ enum trees_status Btree_add(struct Btree *tree, void *new_data)
         // split_node failed and returned NULL entry
         if (curr_entry.data == NULL && curr_entry.child == NULL)
             goto fail_split;
+        tree->node_count++;
+        DS_STATS_INC(tree->stats.splits);
     }
     // new root needs to be created
     if (curr_entry.data != NULL || curr_entry.child != NULL) {
@@ -248,6 +255,7 @@ enum trees_status Btree_add(struct Btree *tree, void *new_data)
             LOG(LIB_LVL, CERROR, "Could not allocate new B-tree root");
             goto fail_root;
         }
+        tree->node_count++;
         struct mway_header *tmp = tree->root;
         tree->root = new_root;
         // Set first child to previous root, which was remained in the left after the last split
@@ -324,6 +332,7 @@ void *Btree_remove(struct Btree *tree, void *data)
             // Secondly and finally, left_donors size should be greater than ceil(m/2) - 1
             if (get_node_size(left_donor) > ((Btree_order(tree) + 1) / 2) - 1) {
                 borrow_from_left(left_donor, mway_get_entry_addr(parent.node, parent.index));
+                DS_STATS_INC(tree->stats.borrows_left);
                 // No node has been underflowed, exiting
                 break;
             }
@@ -337,12 +346,15 @@ void *Btree_remove(struct Btree *tree, void *data)
                 // If parent.index is -1, we borrow using entry[0] as pivot
                 size_t entry_idx = (parent.index == (size_t)-1) ? 0 : parent.index + 1;
                 borrow_from_right(left_starving, mway_get_entry_addr(parent.node, entry_idx));
+                DS_STATS_INC(tree->stats.borrows_right);
                 break;
             }
         }
         // Else, merge the nodes
         size_t merge_idx = (parent.index == (size_t) -1) ? 0 : parent.index;
         merge_starvings(parent.node, merge_idx, &tree->ac);
+        tree->node_count--;
+        DS_STATS_INC(tree->stats.merges);
         curr = parent.node;
     }
     // Handle Root Underflow
@@ -351,7 +363,9 @@ void *Btree_remove(struct Btree *tree, void *data)
         // If root is empty but has a child (result of merge), make child the new root
         if (get_node_first_child(old_root) != NULL) {
             tree->root = get_node_first_child(old_root);
-            tree->ac.free(tree->ac.allocator, old_root);
+            if (tree->ac.free)
+                tree->ac.free(tree->ac.allocator, old_root);
+            tree->node_count--;
         }
     }
     tree->size--;
@@ -528,7 +542,8 @@ static void merge_starvings(struct mway_header *parent_node, size_t index, struc
     // Update merged nodes (left_starving) size
     *get_node_size_ptr(left_starving) = left_starving_size + right_starving_size + 1;
     // Safely delete parent entries child, right_starving. One previous child ptr will be pointing to the new merged node.
-    ac->free(ac->allocator, right_starving);
+    if (ac->free)
+        ac->free(ac->allocator, right_starving);
     // Now remove parent entry from the parent node
     remove_entry(parent_node, index);
 }
@@ -623,5 +638,6 @@ static void destroy_helper(struct mway_header* header, struct object_concept *oc
                 oc->deinit(data);
         }
     }
-    ac->free(ac->allocator, header);
+    if (ac->free)
+        ac->free(ac->allocator, header);
 }
\ No newline at end of file
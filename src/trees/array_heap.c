@@ -18,7 +18,13 @@ static void swap(void* a, void* b, struct dynarray *arr);
 
 int array_heap_init(struct array_heap* tree, size_t obj_size, struct object_concept *oc, int (*cmp) (const void* a, const void* b))
 {
-    if (dynarray_init(&tree->contents, INITIAL_CAPACITY, obj_size, *oc) != 0) {
+    return array_heap_init_with(tree, obj_size, oc, cmp, NULL);
+}
+
+int array_heap_init_with(struct array_heap* tree, size_t obj_size, struct object_concept *oc, int (*cmp) (const void* a, const void* b),
+                         const struct sized_allocator_concept *sac)
+{
+    if (dynarray_init_with(&tree->contents, INITIAL_CAPACITY, obj_size, *oc, sac) != 0) {
         LOG(LIB_LVL, CERROR, "Failed to create dynarray for array_heap");
         return 1;
     }
@@ -53,15 +59,11 @@ int array_heap_remove(struct array_heap* tree, void *removed)
     if (array_heap_empty(tree))
         return 0;
     void* root_data = dynarray_front(&tree->contents);
-    if (tree->contents.oc.init(removed, root_data) != 0) {
-        LOG(LIB_LVL, CERROR, "Could not initialized the destination");
-        return 1;
-    }
-    if (dynarray_set(&tree->contents, 0, dynarray_back(&tree->contents)) != 0) {
-        LOG(LIB_LVL, CERROR, "Could not copy last item into the root");
-        return 1;
-    }
-    dynarray_pop_back(&tree->contents);
+    if (array_heap_size(tree) == 1)
+        return dynarray_extract_back(&tree->contents, removed);
+    // Root is handed over, the last object is relocated into the vacated root slot
+    object_concept_move(&tree->contents.oc, removed, root_data, dynarray_obj_size(&tree->contents));
+    dynarray_extract_back(&tree->contents, root_data);
     reheap_down(tree, 0);
     return 0;
 }
@@ -152,8 +154,8 @@ static size_t right_child_index(size_t index)
 
 static void swap(void* a, void* b, struct dynarray *arr)
 {
-    uint8_t tmp[arr->base.obj_size];
-    arr->oc.init(tmp, a);
-    arr->oc.init(a, b);
-    arr->oc.init(b, tmp);
+    _Alignas(max_align_t) uint8_t tmp[arr->base.obj_size];
+    object_concept_move(&arr->oc, tmp, a, arr->base.obj_size);
+    object_concept_move(&arr->oc, a, b, arr->base.obj_size);
+    object_concept_move(&arr->oc, b, tmp, arr->base.obj_size);
 }
\ No newline at end of file
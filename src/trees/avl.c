@@ -41,6 +41,7 @@ void avl_init(struct avl *tree, bst_cmp_cb cmp)
     bintree_init((struct bintree*) &tree->root, NULL, NULL, NULL);
     tree->size = 0;
     tree->cmp = cmp;
+    DS_STATS_RESET(tree->stats);
 }
 
 
@@ -330,6 +331,7 @@ static void avl_rotate_left(struct avl *tree, struct avl_node *root)
     struct bintree *new_root_bt = root_bt->right;
     struct bintree *grandparent_bt = bintree_get_parent(root_bt);
     struct bintree *transfer_bt = new_root_bt->left;
+    DS_STATS_INC(tree->stats.rotations_left);
     // 1. Move Transfer Node (MUST PRESERVE TAGS - it's an innocent bystander)
     root_bt->right = transfer_bt;
     if (transfer_bt)
@@ -357,6 +359,7 @@ static void avl_rotate_right(struct avl *tree, struct avl_node *root)
     struct bintree *new_root_bt = root_bt->left;
     struct bintree *grandparent_bt = bintree_get_parent(root_bt);
     struct bintree *transfer_bt = new_root_bt->right;
+    DS_STATS_INC(tree->stats.rotations_right);
     // 1. Move Transfer Node (MUST PRESERVE TAGS)
     root_bt->left = transfer_bt;
     if (transfer_bt)
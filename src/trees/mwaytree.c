@@ -34,7 +34,8 @@ void mway_destroy(struct mway_header* header, struct object_concept *oc, struct
                 oc->deinit(data);
         }
     }
-    ac->free(ac->allocator, header);
+    if (ac->free)
+        ac->free(ac->allocator, header);
 }
 
 /* =========================================================================
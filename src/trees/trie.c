@@ -19,15 +19,20 @@ void trie_init(struct trie *tr, struct allocator_concept *ac, size_t alphabet_si
     tr->ac = *ac;
     tr->alphabet_size = alphabet_size;
     tr->count = 0;
+    tr->node_count = 0;
     tr->mapper = mapper;
     tr->unmapper = unmapper;
+    DS_STATS_RESET(tr->stats);
 }
 
 void trie_deinit(struct trie *tr, struct object_concept *oc)
 {
     assert(tr != NULL);
-    trie_deinit_helper(tr->root.child, oc, &tr->ac);
+    // Nodes of region allocators are released in bulk, so there is nothing to visit
+    if (tr->ac.free || (oc && oc->deinit))
+        trie_deinit_helper(tr->root.child, oc, &tr->ac);
     tr->root.child = NULL;
+    tr->node_count = 0;
     if (oc && oc->deinit)
         oc->deinit(tr->root.data);
     tr->root.data = NULL;
@@ -49,6 +54,8 @@ void *trie_put(struct trie *tr, const char *key, void *value)
                 return NULL;
             }
             curr->child = new_node;
+            tr->node_count++;
+            DS_STATS_INC(tr->stats.node_allocs);
         }
         size_t index = tr->mapper(*key);
         if (index >= tr->alphabet_size) {
@@ -188,7 +195,8 @@ static void trie_deinit_helper(struct mway_header *header, struct object_concept
                 oc->deinit(data);
         }
     }
-    ac->free(ac->allocator, header);
+    if (ac->free)
+        ac->free(ac->allocator, header);
 }
 
 static int trie_traverse_helper(struct mway_header *header, char *buffer, size_t depth, void *context, trie_visit_cb cb, trie_unmap_cb unmap)
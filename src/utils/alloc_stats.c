@@ -0,0 +1,128 @@
+#include <ds/utils/alloc_stats.h>
+#include <string.h>
+#include <assert.h>
+
+static void count_alloc(struct alloc_stats *st, size_t size);
+static void count_free(struct alloc_stats *st, size_t size);
+
+/* =========================================================================
+ * Initialization
+ * ========================================================================= */
+
+void alloc_stats_init(struct alloc_stats *st, const struct allocator_concept *inner, size_t obj_size)
+{
+    assert(st != NULL && inner != NULL);
+    memset(st, 0, sizeof(*st));
+    st->inner = *inner;
+    st->obj_size = obj_size;
+}
+
+void alloc_stats_init_sized(struct alloc_stats *st, const struct sized_allocator_concept *inner)
+{
+    assert(st != NULL);
+    memset(st, 0, sizeof(*st));
+    st->inner_sized = (inner) ? *inner : sysallocator_sized();
+}
+
+void alloc_stats_reset(struct alloc_stats *st)
+{
+    assert(st != NULL);
+    memset(&st->counters, 0, sizeof(st->counters));
+}
+
+/* =========================================================================
+ * Allocator Concepts
+ * ========================================================================= */
+
+void *alloc_stats_alloc(void *allocator)
+{
+    struct alloc_stats *st = allocator;
+    assert(st != NULL && st->inner.alloc != NULL);
+    void *ptr = st->inner.alloc(st->inner.allocator);
+    if (!ptr) {
+        st->counters.failed_count++;
+        return NULL;
+    }
+    count_alloc(st, st->obj_size);
+    return ptr;
+}
+
+void alloc_stats_free(void *allocator, void *ptr)
+{
+    struct alloc_stats *st = allocator;
+    assert(st != NULL && st->inner.free != NULL);
+    if (!ptr)
+        return;
+    st->inner.free(st->inner.allocator, ptr);
+    count_free(st, st->obj_size);
+}
+
+void *alloc_stats_alloc_sized(void *allocator, size_t size, size_t align)
+{
+    struct alloc_stats *st = allocator;
+    assert(st != NULL && st->inner_sized.alloc != NULL);
+    void *ptr = st->inner_sized.alloc(st->inner_sized.allocator, size, align);
+    if (!ptr) {
+        st->counters.failed_count++;
+        return NULL;
+    }
+    count_alloc(st, size);
+    return ptr;
+}
+
+void *alloc_stats_realloc_sized(void *allocator, void *ptr, size_t old_size, size_t new_size, size_t align)
+{
+    struct alloc_stats *st = allocator;
+    assert(st != NULL && st->inner_sized.alloc != NULL);
+    void *new_ptr = sized_realloc(&st->inner_sized, ptr, old_size, new_size, align);
+    if (!new_ptr) {
+        st->counters.failed_count++;
+        return NULL;
+    }
+    // Same block as far as object counts go, only bytes change
+    st->counters.live_bytes = st->counters.live_bytes - old_size + new_size;
+    if (st->counters.live_bytes > st->counters.peak_bytes)
+        st->counters.peak_bytes = st->counters.live_bytes;
+    return new_ptr;
+}
+
+void alloc_stats_free_sized(void *allocator, void *ptr, size_t size)
+{
+    struct alloc_stats *st = allocator;
+    assert(st != NULL && st->inner_sized.free != NULL);
+    if (!ptr)
+        return;
+    st->inner_sized.free(st->inner_sized.allocator, ptr, size);
+    count_free(st, size);
+}
+
+/* =========================================================================
+ * Inspection
+ * ========================================================================= */
+
+void alloc_stats_dump(const struct alloc_stats *st, FILE *out, const char *name)
+{
+    assert(st != NULL && out != NULL);
+    const struct alloc_counters *c = &st->counters;
+    fprintf(out, "%s: allocs=%zu frees=%zu failed=%zu live=%zu bytes=%zu peak=%zu\n",
+            (name) ? name : "allocator", c->alloc_count, c->free_count, c->failed_count,
+            c->live_objects, c->live_bytes, c->peak_bytes);
+}
+
+// *** Helper functions *** //
+
+static void count_alloc(struct alloc_stats *st, size_t size)
+{
+    st->counters.alloc_count++;
+    st->counters.live_objects++;
+    st->counters.live_bytes += size;
+    if (st->counters.live_bytes > st->counters.peak_bytes)
+        st->counters.peak_bytes = st->counters.live_bytes;
+}
+
+static void count_free(struct alloc_stats *st, size_t size)
+{
+    st->counters.free_count++;
+    st->counters.live_objects--;
+    st->counters.live_bytes -= size;
+}
@@ -1,5 +1,8 @@
 #include <ds/utils/allocator_concept.h>
 #include <stdlib.h>
+#include <string.h>
+
+#define SYS_ALIGN _Alignof(max_align_t)
 
 void *sysalloc(void *allocator)
 {
@@ -11,4 +14,48 @@ void sysfree(void *allocator, void *ptr)
 {
     (void) allocator;
     free(ptr);
-}
\ No newline at end of file
+}
+
+void *sysalloc_sized(void *allocator, size_t size, size_t align)
+{
+    (void) allocator;
+    if (align <= SYS_ALIGN)
+        return malloc(size);
+    void *ptr = NULL;
+    if (posix_memalign(&ptr, align, size) != 0)
+        return NULL;
+    return ptr;
+}
+
+void *sysrealloc_sized(void *allocator, void *ptr, size_t old_size, size_t new_size, size_t align)
+{
+    if (align <= SYS_ALIGN)
+        return realloc(ptr, new_size);
+    // realloc does not preserve over-alignment
+    void *new_ptr = sysalloc_sized(allocator, new_size, align);
+    if (!new_ptr)
+        return NULL;
+    memcpy(new_ptr, ptr, (old_size < new_size) ? old_size : new_size);
+    free(ptr);
+    return new_ptr;
+}
+
+void sysfree_sized(void *allocator, void *ptr, size_t size)
+{
+    (void) allocator;
+    (void) size;
+    free(ptr);
+}
+
+void *sized_realloc(const struct sized_allocator_concept *sac, void *ptr, size_t old_size, size_t new_size, size_t align)
+{
+    if (sac->realloc)
+        return sac->realloc(sac->allocator, ptr, old_size, new_size, align);
+    void *new_ptr = sac->alloc(sac->allocator, new_size, align);
+    if (!new_ptr)
+        return NULL;
+    memcpy(new_ptr, ptr, (old_size < new_size) ? old_size : new_size);
+    if (sac->free)
+        sac->free(sac->allocator, ptr, old_size);
+    return new_ptr;
+}
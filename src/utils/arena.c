@@ -0,0 +1,175 @@
+#include <ds/utils/arena.h>
+#include <ds/utils/debug.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <assert.h>
+
+#define CHUNK_ALIGN _Alignof(max_align_t)
+#define ALIGN_UP(size, align) (((size) + (align) - 1) & ~((align) - 1))
+
+/*
+    Every chunk starts with a header, usable bytes follow it:
+
+    struct arena_chunk;
+    char bytes[size];
+*/
+
+struct arena_chunk {
+    struct arena_chunk      *next;
+    size_t                  size;
+};
+
+#define CHUNK_HEADER_SIZE ALIGN_UP(sizeof(struct arena_chunk), CHUNK_ALIGN)
+
+static struct arena_chunk *chunk_create(size_t size);
+static char *chunk_begin(struct arena_chunk *chunk);
+
+/* =========================================================================
+ * Initialization & Destruction
+ * ========================================================================= */
+
+void arena_init(struct arena *ar, size_t obj_size, size_t chunk_size)
+{
+    assert(ar != NULL);
+    ar->obj_size = obj_size;
+    ar->chunk_size = (chunk_size != 0) ? chunk_size : ARENA_DEFAULT_CHUNK_SIZE;
+    ar->chunk_count = 0;
+    ar->chunks = NULL;
+    ar->cursor = NULL;
+    ar->end = NULL;
+}
+
+void arena_reset(struct arena *ar)
+{
+    assert(ar != NULL);
+    struct arena_chunk *kept = NULL;
+    struct arena_chunk *chunk = ar->chunks;
+    while (chunk) {
+        struct arena_chunk *next = chunk->next;
+        // Keep one regular chunk, dedicated ones are unlikely to fit the next batch
+        if (!kept && chunk->size == ar->chunk_size)
+            kept = chunk;
+        else
+            free(chunk);
+        chunk = next;
+    }
+    ar->chunks = kept;
+    if (kept) {
+        kept->next = NULL;
+        ar->chunk_count = 1;
+        ar->cursor = chunk_begin(kept);
+        ar->end = ar->cursor + kept->size;
+    } else {
+        ar->chunk_count = 0;
+        ar->cursor = NULL;
+        ar->end = NULL;
+    }
+}
+
+void arena_destroy(struct arena *ar)
+{
+    assert(ar != NULL);
+    struct arena_chunk *chunk = ar->chunks;
+    while (chunk) {
+        struct arena_chunk *next = chunk->next;
+        free(chunk);
+        chunk = next;
+    }
+    ar->chunk_count = 0;
+    ar->chunks = NULL;
+    ar->cursor = NULL;
+    ar->end = NULL;
+}
+
+/* =========================================================================
+ * Allocation
+ * ========================================================================= */
+
+void *arena_alloc_aligned(struct arena *ar, size_t size, size_t align)
+{
+    assert(ar != NULL);
+    assert(align != 0 && (align & (align - 1)) == 0);
+    if (ar->cursor) {
+        uintptr_t aligned = ALIGN_UP((uintptr_t) ar->cursor, (uintptr_t) align);
+        if (aligned <= (uintptr_t) ar->end && size <= (size_t) ((uintptr_t) ar->end - aligned)) {
+            ar->cursor = (char *) (aligned + size);
+            return (void *) aligned;
+        }
+    }
+    // Worst case padding, chunk bytes are already aligned to CHUNK_ALIGN
+    size_t needed = size + ((align > CHUNK_ALIGN) ? align : 0);
+    if (needed > ar->chunk_size) {
+        // Dedicated chunk, linked behind the newest one so its free bytes are not lost
+        struct arena_chunk *chunk = chunk_create(needed);
+        if (!chunk)
+            return NULL;
+        if (ar->chunks) {
+            chunk->next = ((struct arena_chunk *) ar->chunks)->next;
+            ((struct arena_chunk *) ar->chunks)->next = chunk;
+        } else {
+            chunk->next = NULL;
+            ar->chunks = chunk;
+        }
+        ar->chunk_count++;
+        return (void *) ALIGN_UP((uintptr_t) chunk_begin(chunk), (uintptr_t) align);
+    }
+    struct arena_chunk *chunk = chunk_create(ar->chunk_size);
+    if (!chunk)
+        return NULL;
+    chunk->next = ar->chunks;
+    ar->chunks = chunk;
+    ar->chunk_count++;
+    uintptr_t aligned = ALIGN_UP((uintptr_t) chunk_begin(chunk), (uintptr_t) align);
+    ar->cursor = (char *) (aligned + size);
+    ar->end = chunk_begin(chunk) + chunk->size;
+    return (void *) aligned;
+}
+
+void *arena_alloc(void *allocator)
+{
+    struct arena *ar = allocator;
+    assert(ar != NULL && ar->obj_size != 0);
+    return arena_alloc_aligned(ar, ar->obj_size, CHUNK_ALIGN);
+}
+
+void *arena_alloc_sized(void *allocator, size_t size, size_t align)
+{
+    return arena_alloc_aligned(allocator, size, align);
+}
+
+void *arena_realloc_sized(void *allocator, void *ptr, size_t old_size, size_t new_size, size_t align)
+{
+    struct arena *ar = allocator;
+    assert(ar != NULL);
+    int is_last = ((char *) ptr + old_size == ar->cursor);
+    if (is_last && (new_size <= old_size || new_size - old_size <= (size_t) (ar->end - ar->cursor))) {
+        ar->cursor = (char *) ptr + new_size;
+        return ptr;
+    }
+    if (new_size <= old_size)
+        return ptr;
+    void *new_ptr = arena_alloc_aligned(ar, new_size, align);
+    if (!new_ptr)
+        return NULL;
+    memcpy(new_ptr, ptr, old_size);
+    return new_ptr;
+}
+
+// *** Helper functions *** //
+
+static struct arena_chunk *chunk_create(size_t size)
+{
+    struct arena_chunk *chunk = malloc(CHUNK_HEADER_SIZE + size);
+    if (!chunk) {
+        LOG(LIB_LVL, CERROR, "Could not allocate a new arena chunk");
+        return NULL;
+    }
+    chunk->size = size;
+    return chunk;
+}
+
+static char *chunk_begin(struct arena_chunk *chunk)
+{
+    return (char *) chunk + CHUNK_HEADER_SIZE;
+}
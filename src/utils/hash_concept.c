@@ -0,0 +1,46 @@
+#include <ds/utils/hash_concept.h>
+#include <string.h>
+
+// Odd constants with well spread bits, from wyhash and splitmix64
+#define HASH64_K1 0x9e3779b97f4a7c15ull
+#define HASH64_K2 0xbf58476d1ce4e5b9ull
+
+// Multiplies into 128 bits and folds the halves, every input bit reaches the whole word
+static inline uint64_t fold(uint64_t a, uint64_t b)
+{
+    __uint128_t r = (__uint128_t) a * b;
+    return (uint64_t) r ^ (uint64_t) (r >> 64);
+}
+
+uint64_t hash64_bytes(const void* data, size_t len, uint64_t seed)
+{
+    const unsigned char *p = data;
+    uint64_t h = seed ^ fold(len ^ HASH64_K2, HASH64_K1);
+    for (; len >= sizeof(uint64_t); p += sizeof(uint64_t), len -= sizeof(uint64_t)) {
+        uint64_t word;
+        memcpy(&word, p, sizeof(word));
+        h = fold(h ^ word, HASH64_K2);
+    }
+    uint64_t tail = 0;
+    memcpy(&tail, p, len);
+    return hash64_mix(fold(h ^ tail, HASH64_K1));
+}
+
+uint64_t hash64_string(const void* key)
+{
+    return hash64_bytes(key, strlen(key), 0);
+}
+
+uint64_t hash64_u64(const void* key)
+{
+    uint64_t x;
+    memcpy(&x, key, sizeof(x));
+    return hash64_mix(x ^ HASH64_K1);
+}
+
+uint64_t hash64_u32(const void* key)
+{
+    uint32_t x;
+    memcpy(&x, key, sizeof(x));
+    return hash64_mix(x ^ HASH64_K1);
+}
@@ -0,0 +1,345 @@
+#include <ds/utils/logger.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <assert.h>
+
+#define CACHE_LINE 64
+
+_Static_assert((DS_LOG_RING_SIZE & (DS_LOG_RING_SIZE - 1)) == 0, "DS_LOG_RING_SIZE must be a power of two");
+
+/*
+    A record is everything LOG() needs to reproduce the line later. String
+    arguments are copied into text, their v.u holds the offset into it.
+*/
+
+struct ds_log_record {
+    uint64_t                    timestamp;      // CLOCK_REALTIME in nanoseconds
+    const struct ds_log_site    *site;
+    int                         err;
+    unsigned                    argc;
+    struct ds_log_arg           args[DS_LOG_MAX_ARGS];
+    char                        text[DS_LOG_TEXT_SIZE];
+};
+
+// Single producer (owner thread) single consumer (flusher, serialized by the registry lock)
+struct ds_log_ring {
+    _Alignas(CACHE_LINE) atomic_size_t  head;       // Written by the producer only
+    _Alignas(CACHE_LINE) atomic_size_t  tail;       // Written by the consumer only
+    atomic_size_t                       dropped;    // Records lost since the last flush
+    atomic_int                          dead;       // Owner thread exited
+    struct ds_log_ring                  *next;      // Registry list, guarded by the registry lock
+    struct ds_log_record                records[DS_LOG_RING_SIZE];
+};
+
+/*
+    LOG() call sites cannot carry a logger instance, so the state of the logger
+    is process wide. Everything but the thread local ring pointer is guarded by
+    registry_lock, except dropped_total which is atomic.
+*/
+
+static pthread_mutex_t registry_lock = PTHREAD_MUTEX_INITIALIZER;
+static struct ds_log_ring *rings = NULL;
+static FILE *output = NULL;
+static atomic_size_t dropped_total;
+static _Thread_local struct ds_log_ring *local_ring = NULL;
+static pthread_once_t setup_once = PTHREAD_ONCE_INIT;
+static pthread_key_t ring_key;
+
+static pthread_mutex_t flusher_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t flusher_cond = PTHREAD_COND_INITIALIZER;
+static pthread_t flusher;
+static int flusher_running = 0;
+static int flusher_stop = 0;
+static unsigned flusher_interval_ms = 0;
+
+static void logger_setup(void);
+static struct ds_log_ring *ring_attach(void);
+// Thread exit destructor, the ring is freed by the next flush once drained
+static void ring_detach(void *ring);
+// Must be called with the registry lock held
+static void ring_drain_locked(struct ds_log_ring *ring, FILE *out);
+static void format_record(FILE *out, const struct ds_log_record *rec);
+static void format_message(FILE *out, const struct ds_log_record *rec);
+static void *flusher_main(void *arg);
+
+/* =========================================================================
+ * Logging
+ * ========================================================================= */
+
+void ds_log_write(const struct ds_log_site *site, int err, size_t argc, const struct ds_log_arg *argv)
+{
+    struct ds_log_ring *ring = local_ring;
+    if (!ring) {
+        ring = ring_attach();
+        if (!ring) {
+            atomic_fetch_add_explicit(&dropped_total, 1, memory_order_relaxed);
+            return;
+        }
+    }
+    size_t head = atomic_load_explicit(&ring->head, memory_order_relaxed);
+    size_t tail = atomic_load_explicit(&ring->tail, memory_order_acquire);
+    if (head - tail == DS_LOG_RING_SIZE) {
+        atomic_fetch_add_explicit(&ring->dropped, 1, memory_order_relaxed);
+        return;
+    }
+    struct ds_log_record *rec = &ring->records[head & (DS_LOG_RING_SIZE - 1)];
+    struct timespec ts;
+    clock_gettime(CLOCK_REALTIME, &ts);
+    rec->timestamp = (uint64_t) ts.tv_sec * 1000000000ull + (uint64_t) ts.tv_nsec;
+    rec->site = site;
+    rec->err = err;
+    rec->argc = (argc < DS_LOG_MAX_ARGS) ? (unsigned) argc : DS_LOG_MAX_ARGS;
+    size_t used = 0;
+    for (unsigned i = 0; i < rec->argc; i++) {
+        rec->args[i] = argv[i];
+        if (argv[i].type != DS_LOG_ARG_STR)
+            continue;
+        // Copy strings, the caller's buffer might be gone by the time of the flush
+        const char *s = (argv[i].v.s) ? argv[i].v.s : "(null)";
+        size_t room = DS_LOG_TEXT_SIZE - used;
+        size_t len = strnlen(s, room ? room - 1 : 0);
+        if (room) {
+            memcpy(rec->text + used, s, len);
+            rec->text[used + len] = '\0';
+        }
+        rec->args[i].v.u = (room) ? used : DS_LOG_TEXT_SIZE - 1;
+        used += (room) ? len + 1 : 0;
+    }
+    atomic_store_explicit(&ring->head, head + 1, memory_order_release);
+}
+
+void ds_log_flush(void)
+{
+    pthread_mutex_lock(&registry_lock);
+    FILE *out = (output) ? output : stderr;
+    struct ds_log_ring **link = &rings;
+    while (*link) {
+        struct ds_log_ring *ring = *link;
+        ring_drain_locked(ring, out);
+        size_t head = atomic_load_explicit(&ring->head, memory_order_acquire);
+        size_t tail = atomic_load_explicit(&ring->tail, memory_order_relaxed);
+        if (atomic_load_explicit(&ring->dead, memory_order_acquire) && head == tail) {
+            *link = ring->next;
+            free(ring);
+        } else {
+            link = &ring->next;
+        }
+    }
+    fflush(out);
+    pthread_mutex_unlock(&registry_lock);
+}
+
+void ds_log_set_output(FILE *out)
+{
+    ds_log_flush();
+    pthread_mutex_lock(&registry_lock);
+    output = out;
+    pthread_mutex_unlock(&registry_lock);
+}
+
+int ds_log_start(unsigned interval_ms)
+{
+    pthread_mutex_lock(&flusher_lock);
+    if (flusher_running) {
+        pthread_mutex_unlock(&flusher_lock);
+        return 0;
+    }
+    flusher_stop = 0;
+    flusher_interval_ms = (interval_ms != 0) ? interval_ms : 1;
+    if (pthread_create(&flusher, NULL, flusher_main, NULL) != 0) {
+        pthread_mutex_unlock(&flusher_lock);
+        return 1;
+    }
+    flusher_running = 1;
+    pthread_mutex_unlock(&flusher_lock);
+    return 0;
+}
+
+void ds_log_stop(void)
+{
+    pthread_mutex_lock(&flusher_lock);
+    if (flusher_running) {
+        flusher_stop = 1;
+        pthread_cond_signal(&flusher_cond);
+        pthread_mutex_unlock(&flusher_lock);
+        pthread_join(flusher, NULL);
+        pthread_mutex_lock(&flusher_lock);
+        flusher_running = 0;
+    }
+    pthread_mutex_unlock(&flusher_lock);
+    ds_log_flush();
+}
+
+size_t ds_log_dropped(void)
+{
+    pthread_mutex_lock(&registry_lock);
+    size_t dropped = atomic_load_explicit(&dropped_total, memory_order_relaxed);
+    for (struct ds_log_ring *ring = rings; ring; ring = ring->next)
+        dropped += atomic_load_explicit(&ring->dropped, memory_order_relaxed);
+    pthread_mutex_unlock(&registry_lock);
+    return dropped;
+}
+
+// *** Helper functions *** //
+
+static void logger_setup(void)
+{
+    pthread_key_create(&ring_key, ring_detach);
+    // Records still in the rings at exit would be lost otherwise
+    atexit(ds_log_flush);
+}
+
+static struct ds_log_ring *ring_attach(void)
+{
+    pthread_once(&setup_once, logger_setup);
+    struct ds_log_ring *ring = aligned_alloc(CACHE_LINE, sizeof(struct ds_log_ring));
+    if (!ring)
+        return NULL;
+    atomic_init(&ring->head, 0);
+    atomic_init(&ring->tail, 0);
+    atomic_init(&ring->dropped, 0);
+    atomic_init(&ring->dead, 0);
+    pthread_mutex_lock(&registry_lock);
+    ring->next = rings;
+    rings = ring;
+    pthread_mutex_unlock(&registry_lock);
+    pthread_setspecific(ring_key, ring);
+    local_ring = ring;
+    return ring;
+}
+
+static void ring_detach(void *ring)
+{
+    struct ds_log_ring *r = ring;
+    // Destructors running later attach a fresh ring instead of touching this one
+    local_ring = NULL;
+    atomic_store_explicit(&r->dead, 1, memory_order_release);
+}
+
+static void ring_drain_locked(struct ds_log_ring *ring, FILE *out)
+{
+    size_t tail = atomic_load_explicit(&ring->tail, memory_order_relaxed);
+    size_t head = atomic_load_explicit(&ring->head, memory_order_acquire);
+    while (tail != head) {
+        format_record(out, &ring->records[tail & (DS_LOG_RING_SIZE - 1)]);
+        tail++;
+        atomic_store_explicit(&ring->tail, tail, memory_order_release);
+    }
+    size_t dropped = atomic_exchange_explicit(&ring->dropped, 0, memory_order_relaxed);
+    if (dropped) {
+        atomic_fetch_add_explicit(&dropped_total, dropped, memory_order_relaxed);
+        fprintf(out, "[LOGGER] %zu records dropped, ring was full\n", dropped);
+    }
+}
+
+static void format_record(FILE *out, const struct ds_log_record *rec)
+{
+    const struct ds_log_site *site = rec->site;
+    char time_buff[21];
+    time_t seconds = (time_t) (rec->timestamp / 1000000000ull);
+    struct tm tm;
+    localtime_r(&seconds, &tm);
+    strftime(time_buff, sizeof(time_buff), "%Y-%m-%d %H:%M:%S", &tm);
+    fprintf(out, "\x1b[35m%s.%06lu\x1b[0m %s %s\x1b[34m@\x1b[36mfn-%s\x1b[34m@\x1b[36mln-%d\x1b[0m: ",
+            time_buff, (unsigned long) (rec->timestamp % 1000000000ull / 1000), site->status,
+            site->file, site->func, site->line);
+    format_message(out, rec);
+    if (rec->err != 0)
+        fprintf(out, " (%s)", strerror(rec->err));
+    fputc('\n', out);
+}
+
+// Replays the format string, one conversion at a time with the captured argument
+static void format_message(FILE *out, const struct ds_log_record *rec)
+{
+    const char *p = rec->site->fmt;
+    unsigned next_arg = 0;
+    while (*p) {
+        if (*p != '%') {
+            const char *start = p;
+            while (*p && *p != '%')
+                p++;
+            fwrite(start, 1, (size_t) (p - start), out);
+            continue;
+        }
+        if (p[1] == '%') {
+            fputc('%', out);
+            p += 2;
+            continue;
+        }
+        // Flags, width and precision are kept, length modifiers are replaced
+        char spec[32];
+        size_t len = 0;
+        const char *start = p++;
+        while (*p && strchr("-+ #0123456789.", *p) && len < sizeof(spec) - 4)
+            spec[len++] = *p++;
+        while (*p && strchr("hlLqjzt", *p))
+            p++;
+        char conv = *p;
+        if (conv == '\0' || next_arg >= rec->argc) {
+            // Malformed or missing argument, print the rest as is
+            fputs(start, out);
+            return;
+        }
+        p++;
+        const struct ds_log_arg *arg = &rec->args[next_arg++];
+        char format[36] = "%";
+        memcpy(format + 1, spec, len);
+        char *tail = format + 1 + len;
+        switch (conv) {
+        case 'd': case 'i':
+            strcpy(tail, (char[]) { 'l', 'l', conv, '\0' });
+            fprintf(out, format, (arg->type == DS_LOG_ARG_INT) ? arg->v.i : (long long) arg->v.u);
+            break;
+        case 'u': case 'o': case 'x': case 'X':
+            strcpy(tail, (char[]) { 'l', 'l', conv, '\0' });
+            fprintf(out, format, arg->v.u);
+            break;
+        case 'c':
+            strcpy(tail, "c");
+            fprintf(out, format, (int) arg->v.i);
+            break;
+        case 'e': case 'E': case 'f': case 'F': case 'g': case 'G': case 'a': case 'A':
+            strcpy(tail, (char[]) { conv, '\0' });
+            fprintf(out, format, arg->v.d);
+            break;
+        case 's':
+            strcpy(tail, "s");
+            fprintf(out, format, (arg->type == DS_LOG_ARG_STR) ? rec->text + arg->v.u : "(?)");
+            break;
+        case 'p':
+            strcpy(tail, "p");
+            fprintf(out, format, arg->v.p);
+            break;
+        default:
+            // %n and unknown conversions consume their argument and print nothing
+            break;
+        }
+    }
+}
+
+static void *flusher_main(void *arg)
+{
+    (void) arg;
+    pthread_mutex_lock(&flusher_lock);
+    while (!flusher_stop) {
+        struct timespec deadline;
+        clock_gettime(CLOCK_REALTIME, &deadline);
+        deadline.tv_sec += flusher_interval_ms / 1000;
+        deadline.tv_nsec += (long) (flusher_interval_ms % 1000) * 1000000L;
+        if (deadline.tv_nsec >= 1000000000L) {
+            deadline.tv_sec++;
+            deadline.tv_nsec -= 1000000000L;
+        }
+        pthread_cond_timedwait(&flusher_cond, &flusher_lock, &deadline);
+        pthread_mutex_unlock(&flusher_lock);
+        ds_log_flush();
+        pthread_mutex_lock(&flusher_lock);
+    }
+    pthread_mutex_unlock(&flusher_lock);
+    return NULL;
+}
@@ -0,0 +1,185 @@
+#define _GNU_SOURCE
+#include <ds/utils/mmap_allocator.h>
+#include <ds/utils/debug.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <assert.h>
+
+#define ALIGN_UP(size, align) (((size) + (align) - 1) & ~((align) - 1))
+
+// Length of the mapping backing a buffer of size bytes, derived from the size
+// so that nothing has to be stored per buffer
+static size_t mapping_length(const struct mmap_allocator *ma, size_t size);
+static void *map_region(struct mmap_allocator *ma, size_t length, size_t align);
+static void unmap_region(struct mmap_allocator *ma, void *ptr, size_t length);
+static void advise_region(const struct mmap_allocator *ma, void *ptr, size_t length);
+static size_t page_size(void);
+// Alignment map_region gives, huge pages need their own size
+static size_t region_align(const struct mmap_allocator *ma, size_t align);
+
+/* =========================================================================
+ * Initialization
+ * ========================================================================= */
+
+void mmap_allocator_init(struct mmap_allocator *ma, size_t threshold, int flags)
+{
+    assert(ma != NULL);
+    ma->threshold = (threshold != 0) ? threshold : MMAP_ALLOCATOR_DEFAULT_THRESHOLD;
+    ma->flags = flags;
+    ma->mapped_bytes = 0;
+}
+
+/* =========================================================================
+ * Sized Allocator Concept
+ * ========================================================================= */
+
+void *mmap_alloc_sized(void *allocator, size_t size, size_t align)
+{
+    struct mmap_allocator *ma = allocator;
+    assert(ma != NULL);
+    assert(align != 0 && (align & (align - 1)) == 0 && align <= MMAP_ALLOCATOR_HUGEPAGE_SIZE);
+    if (size < ma->threshold)
+        return sysalloc_sized(NULL, size, align);
+    return map_region(ma, mapping_length(ma, size), align);
+}
+
+void *mmap_realloc_sized(void *allocator, void *ptr, size_t old_size, size_t new_size, size_t align)
+{
+    struct mmap_allocator *ma = allocator;
+    assert(ma != NULL && ptr != NULL);
+    int old_mapped = (old_size >= ma->threshold);
+    int new_mapped = (new_size >= ma->threshold);
+    if (!old_mapped && !new_mapped)
+        return sysrealloc_sized(NULL, ptr, old_size, new_size, align);
+    size_t old_length = (old_mapped) ? mapping_length(ma, old_size) : 0;
+    size_t new_length = (new_mapped) ? mapping_length(ma, new_size) : 0;
+    if (old_mapped && new_mapped) {
+        if (old_length == new_length)
+            return ptr;
+#ifdef MREMAP_MAYMOVE
+        // A moved mapping is only page aligned, shrinking keeps the address
+        if (region_align(ma, align) <= page_size() || new_length < old_length) {
+            void *moved = mremap(ptr, old_length, new_length, MREMAP_MAYMOVE);
+            if (moved == MAP_FAILED) {
+                LOG(LIB_LVL, CERROR, "Could not remap the buffer");
+                return NULL;
+            }
+            ma->mapped_bytes = ma->mapped_bytes - old_length + new_length;
+            if (new_length > old_length)
+                advise_region(ma, moved, new_length);
+            return moved;
+        }
+#ifdef MREMAP_FIXED
+        // Move the pages onto an aligned reservation, copy only if the kernel refuses
+        void *target = map_region(ma, new_length, align);
+        if (!target)
+            return NULL;
+        if (mremap(ptr, old_length, new_length, MREMAP_MAYMOVE | MREMAP_FIXED, target) != MAP_FAILED) {
+            ma->mapped_bytes -= old_length;
+            advise_region(ma, target, new_length);
+            return target;
+        }
+        memcpy(target, ptr, old_size);
+        mmap_free_sized(ma, ptr, old_size);
+        return target;
+#endif
+#endif
+    }
+    void *new_ptr = mmap_alloc_sized(ma, new_size, align);
+    if (!new_ptr)
+        return NULL;
+    memcpy(new_ptr, ptr, (old_size < new_size) ? old_size : new_size);
+    mmap_free_sized(ma, ptr, old_size);
+    return new_ptr;
+}
+
+void mmap_free_sized(void *allocator, void *ptr, size_t size)
+{
+    struct mmap_allocator *ma = allocator;
+    assert(ma != NULL);
+    if (!ptr)
+        return;
+    if (size < ma->threshold)
+        sysfree_sized(NULL, ptr, size);
+    else
+        unmap_region(ma, ptr, mapping_length(ma, size));
+}
+
+// *** Helper functions *** //
+
+static size_t mapping_length(const struct mmap_allocator *ma, size_t size)
+{
+    size_t granule = (ma->flags & MMAP_ALLOCATOR_HUGEPAGES) ? MMAP_ALLOCATOR_HUGEPAGE_SIZE : page_size();
+    return ALIGN_UP(size, granule);
+}
+
+static void *map_region(struct mmap_allocator *ma, size_t length, size_t align)
+{
+    align = region_align(ma, align);
+    size_t padding = (align > page_size()) ? align : 0;
+    int flags = MAP_PRIVATE | MAP_ANONYMOUS;
+#ifdef MAP_POPULATE
+    // Populating the padding would be wasted work, prefault after trimming instead
+    if ((ma->flags & MMAP_ALLOCATOR_POPULATE) && padding == 0)
+        flags |= MAP_POPULATE;
+#endif
+    char *raw = mmap(NULL, length + padding, PROT_READ | PROT_WRITE, flags, -1, 0);
+    if (raw == MAP_FAILED) {
+        LOG(LIB_LVL, CERROR, "Could not map the buffer");
+        return NULL;
+    }
+    char *aligned = raw;
+    if (padding) {
+        // Over-mapped by one alignment, trim both ends to an aligned range
+        aligned = (char *) ALIGN_UP((uintptr_t) raw, (uintptr_t) align);
+        size_t head = (size_t) (aligned - raw);
+        size_t tail = padding - head;
+        if (head)
+            munmap(raw, head);
+        if (tail)
+            munmap(aligned + length, tail);
+    }
+    ma->mapped_bytes += length;
+    advise_region(ma, aligned, length);
+#ifdef MADV_WILLNEED
+    if ((ma->flags & MMAP_ALLOCATOR_POPULATE) && padding)
+        madvise(aligned, length, MADV_WILLNEED);
+#endif
+    return aligned;
+}
+
+static void unmap_region(struct mmap_allocator *ma, void *ptr, size_t length)
+{
+    if (munmap(ptr, length) != 0) {
+        LOG(LIB_LVL, CERROR, "Could not unmap the buffer");
+        return;
+    }
+    ma->mapped_bytes -= length;
+}
+
+static void advise_region(const struct mmap_allocator *ma, void *ptr, size_t length)
+{
+#ifdef MADV_HUGEPAGE
+    if ((ma->flags & MMAP_ALLOCATOR_HUGEPAGES) && madvise(ptr, length, MADV_HUGEPAGE) != 0) {
+        LOG(LIB_LVL, CWARNING, "Transparent huge pages are not available");
+    }
+#else
+    (void) ma;
+    (void) ptr;
+    (void) length;
+#endif
+}
+
+static size_t page_size(void)
+{
+    return (size_t) sysconf(_SC_PAGESIZE);
+}
+
+static size_t region_align(const struct mmap_allocator *ma, size_t align)
+{
+    // Huge pages can only back 2MB aligned ranges of the mapping
+    return (ma->flags & MMAP_ALLOCATOR_HUGEPAGES) ? MMAP_ALLOCATOR_HUGEPAGE_SIZE : align;
+}
@@ -0,0 +1,124 @@
+#include <ds/utils/slab_pool.h>
+#include <ds/utils/debug.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <assert.h>
+#include <unistd.h>
+
+#define ALIGN_UP(size, align) (((size) + (align) - 1) & ~((align) - 1))
+#define SLOT_ALIGN _Alignof(max_align_t)
+
+/*
+    Every slab starts with a header linking it to the previous slab, slots follow it:
+
+    struct slab_header;
+    slot[(slab_size - SLAB_HEADER_SIZE) / obj_size];
+
+    A free slot stores the pointer to the next free slot in its first bytes.
+*/
+
+struct slab_header {
+    struct slab_header      *next;
+};
+
+#define SLAB_HEADER_SIZE ALIGN_UP(sizeof(struct slab_header), SLOT_ALIGN)
+
+static size_t page_size(void);
+static int slab_pool_grow(struct slab_pool *sp);
+
+/* =========================================================================
+ * Initialization & Deinitialization
+ * ========================================================================= */
+
+int slab_pool_init(struct slab_pool *sp, size_t obj_size, size_t slab_size)
+{
+    assert(sp != NULL && obj_size != 0);
+    if (slab_size == 0)
+        slab_size = SLAB_POOL_DEFAULT_SIZE;
+    size_t page = page_size();
+    sp->slab_size = ALIGN_UP(slab_size, page);
+    sp->obj_size = ALIGN_UP(obj_size < sizeof(void *) ? sizeof(void *) : obj_size, SLOT_ALIGN);
+    if (sp->slab_size < SLAB_HEADER_SIZE + sp->obj_size) {
+        LOG(LIB_LVL, CERROR, "Slab cannot hold a single object");
+        return 1;
+    }
+    sp->slab_count = 0;
+    sp->slabs = NULL;
+    sp->free_list = NULL;
+    sp->bump = NULL;
+    sp->bump_end = NULL;
+    return 0;
+}
+
+void slab_pool_deinit(struct slab_pool *sp)
+{
+    assert(sp != NULL);
+    struct slab_header *slab = sp->slabs;
+    while (slab) {
+        struct slab_header *next = slab->next;
+        free(slab);
+        slab = next;
+    }
+    sp->slab_count = 0;
+    sp->slabs = NULL;
+    sp->free_list = NULL;
+    sp->bump = NULL;
+    sp->bump_end = NULL;
+}
+
+/* =========================================================================
+ * Allocator Concept
+ * ========================================================================= */
+
+void *slab_alloc(void *allocator)
+{
+    struct slab_pool *sp = allocator;
+    assert(sp != NULL);
+    if (sp->free_list) {
+        void *slot = sp->free_list;
+        sp->free_list = *(void **) slot;
+        return slot;
+    }
+    // Slots of the newest slab are carved lazily, so untouched pages are never faulted in
+    if ((size_t) (sp->bump_end - sp->bump) < sp->obj_size) {
+        if (slab_pool_grow(sp) != 0)
+            return NULL;
+    }
+    void *slot = sp->bump;
+    sp->bump += sp->obj_size;
+    return slot;
+}
+
+void slab_free(void *allocator, void *ptr)
+{
+    struct slab_pool *sp = allocator;
+    assert(sp != NULL);
+    if (!ptr)
+        return;
+    *(void **) ptr = sp->free_list;
+    sp->free_list = ptr;
+}
+
+// *** Helper functions *** //
+
+static size_t page_size(void)
+{
+    long page = sysconf(_SC_PAGESIZE);
+    return (page > 0) ? (size_t) page : 4096;
+}
+
+static int slab_pool_grow(struct slab_pool *sp)
+{
+    void *memory;
+    if (posix_memalign(&memory, page_size(), sp->slab_size) != 0) {
+        LOG(LIB_LVL, CERROR, "Could not allocate a new slab");
+        return 1;
+    }
+    struct slab_header *slab = memory;
+    slab->next = sp->slabs;
+    sp->slabs = slab;
+    sp->slab_count++;
+    sp->bump = (char *) slab + SLAB_HEADER_SIZE;
+    sp->bump_end = (char *) slab + sp->slab_size;
+    return 0;
+}
@@ -0,0 +1,162 @@
+#include <ds/utils/tcache_pool.h>
+#include <ds/utils/debug.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+
+struct tcache {
+    struct tcache_pool      *owner;
+    struct tcache           *prev;
+    struct tcache           *next;
+    size_t                  count;
+    void                    *slots[TCACHE_MAGAZINE_SIZE];
+};
+
+static struct tcache *tcache_get(struct tcache_pool *tp);
+// Thread exit destructor, returns every slot of the magazine to the depot
+static void tcache_release(void *cache);
+// Must be called with the depot lock held
+static void tcache_flush_locked(struct tcache *cache, size_t count);
+
+/* =========================================================================
+ * Initialization & Deinitialization
+ * ========================================================================= */
+
+int tcache_pool_init(struct tcache_pool *tp, size_t obj_size, size_t slab_size)
+{
+    assert(tp != NULL);
+    if (slab_pool_init(&tp->depot, obj_size, slab_size) != 0)
+        return 1;
+    if (pthread_mutex_init(&tp->lock, NULL) != 0) {
+        LOG(LIB_LVL, CERROR, "Could not initialize depot lock");
+        slab_pool_deinit(&tp->depot);
+        return 1;
+    }
+    if (pthread_key_create(&tp->key, tcache_release) != 0) {
+        LOG(LIB_LVL, CERROR, "Could not create thread cache key");
+        pthread_mutex_destroy(&tp->lock);
+        slab_pool_deinit(&tp->depot);
+        return 1;
+    }
+    tp->caches = NULL;
+    return 0;
+}
+
+void tcache_pool_deinit(struct tcache_pool *tp)
+{
+    assert(tp != NULL);
+    // Deleting the key first guarantees no destructor runs on a dead pool
+    pthread_key_delete(tp->key);
+    struct tcache *cache = tp->caches;
+    while (cache) {
+        struct tcache *next = cache->next;
+        free(cache);
+        cache = next;
+    }
+    tp->caches = NULL;
+    slab_pool_deinit(&tp->depot);
+    pthread_mutex_destroy(&tp->lock);
+}
+
+/* =========================================================================
+ * Allocator Concept
+ * ========================================================================= */
+
+void *tcache_alloc(void *allocator)
+{
+    struct tcache_pool *tp = allocator;
+    assert(tp != NULL);
+    struct tcache *cache = tcache_get(tp);
+    if (!cache)
+        return NULL;
+    if (cache->count == 0) {
+        pthread_mutex_lock(&tp->lock);
+        while (cache->count < TCACHE_BATCH_SIZE) {
+            void *slot = slab_alloc(&tp->depot);
+            if (!slot)
+                break;
+            cache->slots[cache->count++] = slot;
+        }
+        pthread_mutex_unlock(&tp->lock);
+        if (cache->count == 0)
+            return NULL;
+    }
+    return cache->slots[--cache->count];
+}
+
+void tcache_free(void *allocator, void *ptr)
+{
+    struct tcache_pool *tp = allocator;
+    assert(tp != NULL);
+    if (!ptr)
+        return;
+    struct tcache *cache = tcache_get(tp);
+    if (!cache) {
+        // Could not get a magazine, hand the slot directly to the depot
+        pthread_mutex_lock(&tp->lock);
+        slab_free(&tp->depot, ptr);
+        pthread_mutex_unlock(&tp->lock);
+        return;
+    }
+    if (cache->count == TCACHE_MAGAZINE_SIZE) {
+        pthread_mutex_lock(&tp->lock);
+        tcache_flush_locked(cache, TCACHE_BATCH_SIZE);
+        pthread_mutex_unlock(&tp->lock);
+    }
+    cache->slots[cache->count++] = ptr;
+}
+
+// *** Helper functions *** //
+
+static struct tcache *tcache_get(struct tcache_pool *tp)
+{
+    struct tcache *cache = pthread_getspecific(tp->key);
+    if (cache)
+        return cache;
+    cache = malloc(sizeof(struct tcache));
+    if (!cache) {
+        LOG(LIB_LVL, CERROR, "Could not allocate thread cache");
+        return NULL;
+    }
+    cache->owner = tp;
+    cache->count = 0;
+    cache->prev = NULL;
+    pthread_mutex_lock(&tp->lock);
+    cache->next = tp->caches;
+    if (tp->caches)
+        tp->caches->prev = cache;
+    tp->caches = cache;
+    pthread_mutex_unlock(&tp->lock);
+    if (pthread_setspecific(tp->key, cache) != 0) {
+        LOG(LIB_LVL, CERROR, "Could not register thread cache");
+        tcache_release(cache);
+        return NULL;
+    }
+    return cache;
+}
+
+static void tcache_release(void *cache)
+{
+    struct tcache *tc = cache;
+    struct tcache_pool *tp = tc->owner;
+    pthread_mutex_lock(&tp->lock);
+    tcache_flush_locked(tc, tc->count);
+    if (tc->prev)
+        tc->prev->next = tc->next;
+    else
+        tp->caches = tc->next;
+    if (tc->next)
+        tc->next->prev = tc->prev;
+    pthread_mutex_unlock(&tp->lock);
+    free(tc);
+}
+
+static void tcache_flush_locked(struct tcache *cache, size_t count)
+{
+    assert(count <= cache->count);
+    // Flush the coldest slots, the most recently freed ones stay in the magazine
+    for (size_t i = 0; i < count; i++)
+        slab_free(&cache->owner->depot, cache->slots[i]);
+    cache->count -= count;
+    memmove(cache->slots, cache->slots + count, cache->count * sizeof(void *));
+}
@@ -0,0 +1,331 @@
+#include <ds/utils/thread_pool.h>
+#include <ds/utils/debug.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sched.h>
+#include <unistd.h>
+#include <assert.h>
+
+/**
+ * Helper functions declarations and macro definitions
+ */
+
+#define CACHE_LINE 64
+#define ALIGN_UP(size, align) (((size) + (align) - 1) & ~((align) - 1))
+
+// Initial capacity of every deque, doubled when full
+#define DEQUE_MIN_CAPACITY 64
+
+// Rounds thread_pool_wait yields with nothing to steal before it blocks on done
+#define WAIT_SPINS 64
+
+struct task {
+    thread_pool_task            fn;
+    void                        *arg;
+    struct thread_pool_group    *group;
+};
+
+// Ring buffer of tasks, the owner uses the back, thieves the front
+struct task_deque {
+    _Alignas(CACHE_LINE) pthread_mutex_t lock;
+    struct task                 *tasks;
+    size_t                      head;       // Index of the front task
+    size_t                      count;
+    size_t                      capacity;
+};
+
+struct worker {
+    struct task_deque           deque;
+    struct thread_pool          *pool;
+    pthread_t                   thread;
+    size_t                      index;
+};
+
+struct thread_pool {
+    struct worker               *workers;
+    size_t                      threads;
+    struct task_deque           shared;     // Tasks submitted from outside the pool
+    atomic_size_t               queued;     // Tasks sitting in any deque
+    atomic_size_t               sleepers;   // Workers blocked on wake
+    atomic_size_t               waiters;    // thread_pool_wait callers blocked on done
+    atomic_int                  stop;
+    pthread_mutex_t             lock;       // Guards sleeping only
+    pthread_cond_t              wake;
+    pthread_cond_t              done;       // A group finished or a task was queued
+};
+
+// Worker the calling thread is, NULL outside of every pool
+static _Thread_local struct worker *current_worker;
+
+static void *worker_main(void *arg);
+static int find_task(struct thread_pool *pool, struct worker *self, struct task *task);
+static void run_task(struct thread_pool *pool, struct task *task);
+static struct worker *worker_of(struct thread_pool *pool);
+static int deque_init(struct task_deque *dq);
+static void deque_deinit(struct task_deque *dq);
+static int deque_push_back(struct task_deque *dq, const struct task *task);
+static int deque_pop_back(struct task_deque *dq, struct task *task);
+static int deque_pop_front(struct task_deque *dq, struct task *task);
+
+/* =========================================================================
+ * Create & Destroy
+ * ========================================================================= */
+
+struct thread_pool *thread_pool_create(size_t threads)
+{
+    if (threads == 0) {
+        long online = sysconf(_SC_NPROCESSORS_ONLN);
+        threads = (online > 0) ? (size_t) online : 1;
+    }
+    // Deques are cache line aligned, malloc only guarantees 16 bytes
+    struct thread_pool *pool = aligned_alloc(CACHE_LINE, ALIGN_UP(sizeof(struct thread_pool), CACHE_LINE));
+    if (!pool) {
+        LOG(LIB_LVL, CERROR, "Could not allocate the pool");
+        return NULL;
+    }
+    pool->workers = aligned_alloc(CACHE_LINE, ALIGN_UP(threads * sizeof(struct worker), CACHE_LINE));
+    if (pool->workers)
+        memset(pool->workers, 0, threads * sizeof(struct worker));
+    if (!pool->workers || deque_init(&pool->shared) != 0) {
+        LOG(LIB_LVL, CERROR, "Could not allocate the workers");
+        free(pool->workers);
+        free(pool);
+        return NULL;
+    }
+    pool->threads = 0;
+    atomic_init(&pool->queued, 0);
+    atomic_init(&pool->sleepers, 0);
+    atomic_init(&pool->waiters, 0);
+    atomic_init(&pool->stop, 0);
+    pthread_mutex_init(&pool->lock, NULL);
+    pthread_cond_init(&pool->wake, NULL);
+    pthread_cond_init(&pool->done, NULL);
+    for (size_t i = 0; i < threads; i++) {
+        struct worker *w = &pool->workers[i];
+        w->pool = pool;
+        w->index = i;
+        if (deque_init(&w->deque) != 0)
+            break;
+        if (pthread_create(&w->thread, NULL, worker_main, w) != 0) {
+            deque_deinit(&w->deque);
+            break;
+        }
+        pool->threads++;
+    }
+    if (pool->threads != threads) {
+        LOG(LIB_LVL, CERROR, "Could only start %zu of %zu workers", pool->threads, threads);
+        thread_pool_destroy(pool);
+        return NULL;
+    }
+    return pool;
+}
+
+void thread_pool_destroy(struct thread_pool *pool)
+{
+    assert(pool != NULL);
+    pthread_mutex_lock(&pool->lock);
+    atomic_store(&pool->stop, 1);
+    pthread_cond_broadcast(&pool->wake);
+    pthread_mutex_unlock(&pool->lock);
+    for (size_t i = 0; i < pool->threads; i++) {
+        pthread_join(pool->workers[i].thread, NULL);
+        deque_deinit(&pool->workers[i].deque);
+    }
+    deque_deinit(&pool->shared);
+    pthread_mutex_destroy(&pool->lock);
+    pthread_cond_destroy(&pool->wake);
+    pthread_cond_destroy(&pool->done);
+    free(pool->workers);
+    free(pool);
+}
+
+size_t thread_pool_size(const struct thread_pool *pool)
+{
+    assert(pool != NULL);
+    return pool->threads;
+}
+
+/* =========================================================================
+ * Tasks
+ * ========================================================================= */
+
+int thread_pool_submit(struct thread_pool *pool, struct thread_pool_group *group, thread_pool_task task, void *arg)
+{
+    assert(pool != NULL && group != NULL && task != NULL);
+    struct task t = { task, arg, group };
+    struct worker *self = worker_of(pool);
+    __atomic_fetch_add(&group->pending, 1, __ATOMIC_RELAXED);
+    if (deque_push_back(self ? &self->deque : &pool->shared, &t) != 0) {
+        __atomic_fetch_sub(&group->pending, 1, __ATOMIC_RELAXED);
+        LOG(LIB_LVL, CERROR, "Could not queue the task");
+        return 1;
+    }
+    // Pairs with the sleepers and waiters increments before queued is checked, one of them sees the other
+    atomic_fetch_add(&pool->queued, 1);
+    int sleepers = atomic_load(&pool->sleepers) != 0;
+    int waiters = atomic_load(&pool->waiters) != 0;
+    if (sleepers || waiters) {
+        pthread_mutex_lock(&pool->lock);
+        if (sleepers)
+            pthread_cond_signal(&pool->wake);
+        // Blocked waiters help with the new task too, a pool of waiting workers would deadlock otherwise
+        if (waiters)
+            pthread_cond_broadcast(&pool->done);
+        pthread_mutex_unlock(&pool->lock);
+    }
+    return 0;
+}
+
+void thread_pool_wait(struct thread_pool *pool, struct thread_pool_group *group)
+{
+    assert(pool != NULL && group != NULL);
+    struct worker *self = worker_of(pool);
+    int spins = 0;
+    while (__atomic_load_n(&group->pending, __ATOMIC_ACQUIRE) != 0) {
+        struct task t;
+        if (find_task(pool, self, &t)) {
+            run_task(pool, &t);
+            spins = 0;
+        } else if (++spins < WAIT_SPINS) {
+            sched_yield();
+        } else {
+            // Nothing to steal for a while, sleep until the group finishes or a task is queued
+            pthread_mutex_lock(&pool->lock);
+            atomic_fetch_add(&pool->waiters, 1);
+            while (__atomic_load_n(&group->pending, __ATOMIC_SEQ_CST) != 0 && atomic_load(&pool->queued) == 0)
+                pthread_cond_wait(&pool->done, &pool->lock);
+            atomic_fetch_sub(&pool->waiters, 1);
+            pthread_mutex_unlock(&pool->lock);
+            spins = 0;
+        }
+    }
+}
+
+// *** Helper functions definitions *** //
+
+static void *worker_main(void *arg)
+{
+    struct worker *self = arg;
+    struct thread_pool *pool = self->pool;
+    current_worker = self;
+    while (1) {
+        struct task t;
+        if (find_task(pool, self, &t)) {
+            run_task(pool, &t);
+            continue;
+        }
+        pthread_mutex_lock(&pool->lock);
+        atomic_fetch_add(&pool->sleepers, 1);
+        while (atomic_load(&pool->queued) == 0 && !atomic_load(&pool->stop))
+            pthread_cond_wait(&pool->wake, &pool->lock);
+        atomic_fetch_sub(&pool->sleepers, 1);
+        int done = atomic_load(&pool->stop) && atomic_load(&pool->queued) == 0;
+        pthread_mutex_unlock(&pool->lock);
+        if (done)
+            break;
+    }
+    current_worker = NULL;
+    return NULL;
+}
+
+// Own deque first for locality, then the shared queue, then the others from the next worker on
+static int find_task(struct thread_pool *pool, struct worker *self, struct task *task)
+{
+    if (atomic_load_explicit(&pool->queued, memory_order_relaxed) == 0)
+        return 0;
+    int found = (self && deque_pop_back(&self->deque, task)) || deque_pop_front(&pool->shared, task);
+    size_t start = self ? self->index + 1 : 0;
+    for (size_t i = 0; !found && i < pool->threads; i++) {
+        struct worker *victim = &pool->workers[(start + i) % pool->threads];
+        if (victim != self)
+            found = deque_pop_front(&victim->deque, task);
+    }
+    if (found)
+        atomic_fetch_sub(&pool->queued, 1);
+    return found;
+}
+
+static void run_task(struct thread_pool *pool, struct task *task)
+{
+    task->fn(task->arg);
+    // The group may be gone once pending is zero, only the pool is touched afterwards.
+    // Pairs with the waiters increment before pending is checked, one of them sees the other
+    if (__atomic_fetch_sub(&task->group->pending, 1, __ATOMIC_SEQ_CST) == 1 && atomic_load(&pool->waiters) != 0) {
+        pthread_mutex_lock(&pool->lock);
+        pthread_cond_broadcast(&pool->done);
+        pthread_mutex_unlock(&pool->lock);
+    }
+}
+
+static struct worker *worker_of(struct thread_pool *pool)
+{
+    return (current_worker && current_worker->pool == pool) ? current_worker : NULL;
+}
+
+static int deque_init(struct task_deque *dq)
+{
+    dq->tasks = malloc(DEQUE_MIN_CAPACITY * sizeof(struct task));
+    if (!dq->tasks)
+        return 1;
+    dq->head = 0;
+    dq->count = 0;
+    dq->capacity = DEQUE_MIN_CAPACITY;
+    pthread_mutex_init(&dq->lock, NULL);
+    return 0;
+}
+
+static void deque_deinit(struct task_deque *dq)
+{
+    pthread_mutex_destroy(&dq->lock);
+    free(dq->tasks);
+    dq->tasks = NULL;
+}
+
+static int deque_push_back(struct task_deque *dq, const struct task *task)
+{
+    pthread_mutex_lock(&dq->lock);
+    if (dq->count == dq->capacity) {
+        struct task *tasks = malloc(2 * dq->capacity * sizeof(struct task));
+        if (!tasks) {
+            pthread_mutex_unlock(&dq->lock);
+            return 1;
+        }
+        for (size_t i = 0; i < dq->count; i++)
+            tasks[i] = dq->tasks[(dq->head + i) % dq->capacity];
+        free(dq->tasks);
+        dq->tasks = tasks;
+        dq->head = 0;
+        dq->capacity *= 2;
+    }
+    dq->tasks[(dq->head + dq->count) % dq->capacity] = *task;
+    dq->count++;
+    pthread_mutex_unlock(&dq->lock);
+    return 0;
+}
+
+static int deque_pop_back(struct task_deque *dq, struct task *task)
+{
+    pthread_mutex_lock(&dq->lock);
+    int found = dq->count != 0;
+    if (found) {
+        dq->count--;
+        *task = dq->tasks[(dq->head + dq->count) % dq->capacity];
+    }
+    pthread_mutex_unlock(&dq->lock);
+    return found;
+}
+
+static int deque_pop_front(struct task_deque *dq, struct task *task)
+{
+    pthread_mutex_lock(&dq->lock);
+    int found = dq->count != 0;
+    if (found) {
+        *task = dq->tasks[dq->head];
+        dq->head = (dq->head + 1) % dq->capacity;
+        dq->count--;
+    }
+    pthread_mutex_unlock(&dq->lock);
+    return found;
+}
@@ -0,0 +1,137 @@
+/**
+ * @file test_array_kernels_cmp.cpp
+ * @brief Array kernels per instruction set versus hand-written array_iterator_next loops.
+ *
+ * Compile with:
+ * g++ -std=c++17 -O2 test_array_kernels_cmp.cpp -I/path/to/include -L/path/to/lib -lds -o kernels_bench
+ *
+ * Run with optional element count: ./kernels_bench [elements]
+ */
+
+#include "../include/benchmark.hpp"
+#include <ds/arrays/array_kernels.h>
+#include <cstdint>
+#include <cstdlib>
+#include <vector>
+#include <iostream>
+
+static const int ROUNDS = 50;
+
+// What callers wrote before array kernels existed
+static long long loop_find(struct array *view, int32_t key)
+{
+    size_t index = 0;
+    for (void *it = array_iterator_begin(view); it != array_iterator_end(view); it = array_iterator_next(view, it), index++) {
+        if (*static_cast<int32_t *>(it) == key)
+            return index;
+    }
+    return index;
+}
+
+static long long loop_count(struct array *view, int32_t key)
+{
+    long long count = 0;
+    for (void *it = array_iterator_begin(view); it != array_iterator_end(view); it = array_iterator_next(view, it))
+        count += *static_cast<int32_t *>(it) == key;
+    return count;
+}
+
+static long long loop_min(struct array *view, int32_t)
+{
+    int32_t lowest = *static_cast<int32_t *>(array_iterator_begin(view));
+    for (void *it = array_iterator_begin(view); it != array_iterator_end(view); it = array_iterator_next(view, it)) {
+        if (*static_cast<int32_t *>(it) < lowest)
+            lowest = *static_cast<int32_t *>(it);
+    }
+    return lowest;
+}
+
+static long long loop_sum(struct array *view, int32_t)
+{
+    long long sum = 0;
+    for (void *it = array_iterator_begin(view); it != array_iterator_end(view); it = array_iterator_next(view, it))
+        sum += *static_cast<int32_t *>(it);
+    return sum;
+}
+
+static long long kernel_find(struct array *view, int32_t key)
+{
+    return array_find(view, ARRAY_I32, &key);
+}
+
+static long long kernel_count(struct array *view, int32_t key)
+{
+    return array_count(view, ARRAY_I32, &key);
+}
+
+static long long kernel_min(struct array *view, int32_t)
+{
+    int32_t lowest;
+    array_min(view, ARRAY_I32, &lowest);
+    return lowest;
+}
+
+static long long kernel_sum(struct array *view, int32_t)
+{
+    int64_t sum;
+    array_sum(view, ARRAY_I32, &sum);
+    return sum;
+}
+
+typedef long long (*operation)(struct array *view, int32_t key);
+
+static double run(operation op, struct array *view, int32_t key, long long &checksum)
+{
+    BenchmarkTimer timer;
+    BENCHMARK_START(timer);
+    for (int r = 0; r < ROUNDS; r++)
+        checksum += op(view, key);
+    BENCHMARK_STOP(timer);
+    return timer.elapsed_ms();
+}
+
+int main(int argc, char **argv)
+{
+    size_t count = (argc > 1) ? std::strtoull(argv[1], nullptr, 10) : 1000000;
+    std::vector<int32_t> data(count);
+    for (size_t i = 0; i < count; i++)
+        data[i] = std::rand() % 100000;
+    // Key sits near the end so find scans almost everything
+    int32_t key = -1;
+    data[count - count / 16] = key;
+    struct array view = { data.data(), count, sizeof(int32_t) };
+
+    const char *names[] = { "find", "count", "min", "sum" };
+    operation loops[] = { loop_find, loop_count, loop_min, loop_sum };
+    operation kernels[] = { kernel_find, kernel_count, kernel_min, kernel_sum };
+    enum array_isa selected = array_kernels_isa();
+
+    std::cout << std::string(70, '=') << std::endl;
+    std::cout << count << " int32, " << ROUNDS << " rounds, ms (speedup over the iterator loop)" << std::endl;
+    std::cout << std::string(70, '=') << std::endl;
+    std::cout << std::left << std::setw(8) << "Op" << std::right << std::setw(12) << "loop";
+    for (int isa = ARRAY_ISA_SCALAR; isa <= ARRAY_ISA_AVX512; isa++)
+        std::cout << std::setw(12) << array_isa_name(static_cast<enum array_isa>(isa));
+    std::cout << std::endl << std::string(70, '-') << std::endl;
+
+    for (int op = 0; op < 4; op++) {
+        long long expected = 0;
+        double baseline = run(loops[op], &view, key, expected);
+        std::cout << std::left << std::setw(8) << names[op] << std::right << std::fixed << std::setprecision(2)
+                  << std::setw(12) << baseline;
+        for (int isa = ARRAY_ISA_SCALAR; isa <= ARRAY_ISA_AVX512; isa++) {
+            if (array_kernels_set_isa(static_cast<enum array_isa>(isa)) != 0) {
+                std::cout << std::setw(12) << "-";
+                continue;
+            }
+            long long checksum = 0;
+            double ms = run(kernels[op], &view, key, checksum);
+            std::cout << std::setw(7) << ms << " (" << std::setprecision(1) << baseline / ms << "x)"
+                      << std::setprecision(2) << ((checksum == expected) ? "" : " mismatch");
+        }
+        std::cout << std::endl;
+    }
+    array_kernels_set_isa(selected);
+    std::cout << std::string(70, '=') << std::endl;
+    return 0;
+}
@@ -0,0 +1,89 @@
+/**
+ * @file test_array_parallel_cmp.cpp
+ * @brief array_sort versus array_parallel_sort and a parallel reduction over thread counts.
+ *
+ * Compile with:
+ * g++ -std=c++17 -O2 test_array_parallel_cmp.cpp -I/path/to/include -L/path/to/lib -lds -pthread -o parallel_bench
+ *
+ * Run with optional element count and max thread count: ./parallel_bench [elements] [threads]
+ */
+
+#include "../include/benchmark.hpp"
+#include <ds/arrays/array_parallel.h>
+#include <ds/arrays/array_sort.h>
+#include <cstdint>
+#include <cstdlib>
+#include <random>
+#include <vector>
+#include <iostream>
+#include <thread>
+
+static int u64_cmp(const void *a, const void *b)
+{
+    uint64_t x = *static_cast<const uint64_t *>(a), y = *static_cast<const uint64_t *>(b);
+    return (x > y) - (x < y);
+}
+
+static void sum_map(const struct array *range, void *partial, void *)
+{
+    const uint64_t *values = static_cast<const uint64_t *>(range->buffer);
+    uint64_t sum = 0;
+    for (size_t i = 0; i < range->size; i++)
+        sum += values[i] >> 8;
+    *static_cast<uint64_t *>(partial) += sum;
+}
+
+static void sum_combine(void *result, const void *partial, void *)
+{
+    *static_cast<uint64_t *>(result) += *static_cast<const uint64_t *>(partial);
+}
+
+int main(int argc, char **argv)
+{
+    size_t count = (argc > 1) ? std::strtoull(argv[1], nullptr, 10) : 10000000;
+    size_t max_threads = (argc > 2) ? std::strtoull(argv[2], nullptr, 10) : std::thread::hardware_concurrency();
+    std::mt19937_64 rng(7);
+    std::vector<uint64_t> input(count);
+    for (auto &v : input)
+        v = rng();
+
+    std::cout << std::string(70, '=') << std::endl;
+    std::cout << count << " uint64, up to " << max_threads << " threads" << std::endl;
+    std::cout << std::string(70, '=') << std::endl;
+
+    std::vector<uint64_t> data(input);
+    struct array view = { data.data(), count, sizeof(uint64_t) };
+    BenchmarkTimer timer;
+    BENCHMARK_START(timer);
+    array_sort(&view, u64_cmp);
+    BENCHMARK_STOP(timer);
+    double serial = timer.elapsed_ms();
+    std::cout << std::left << std::setw(28) << "array_sort" << std::right << std::fixed << std::setprecision(2)
+              << std::setw(12) << serial << " ms" << std::endl;
+
+    for (size_t threads = 1; threads <= max_threads; threads *= 2) {
+        // Workers plus the calling thread, a single thread runs without a pool
+        struct thread_pool *pool = (threads > 1) ? thread_pool_create(threads - 1) : nullptr;
+        data = input;
+        BenchmarkTimer sort_timer;
+        BENCHMARK_START(sort_timer);
+        array_parallel_sort(pool, &view, u64_cmp);
+        BENCHMARK_STOP(sort_timer);
+        double ms = sort_timer.elapsed_ms();
+        bool sorted = array_is_sorted(&view, u64_cmp);
+
+        uint64_t sum = 0;
+        BenchmarkTimer sum_timer;
+        BENCHMARK_START(sum_timer);
+        array_parallel_reduce(pool, &view, 0, &sum, sizeof(sum), nullptr, sum_map, sum_combine);
+        BENCHMARK_STOP(sum_timer);
+
+        std::cout << "parallel sort, " << std::left << std::setw(4) << threads << std::setw(10) << "threads"
+                  << std::right << std::setw(12) << ms << " ms" << std::setw(8) << serial / ms << "x"
+                  << "   reduce " << sum_timer.elapsed_ms() << " ms" << (sorted ? "" : "  NOT SORTED") << std::endl;
+        if (pool)
+            thread_pool_destroy(pool);
+    }
+    std::cout << std::string(70, '=') << std::endl;
+    return 0;
+}
@@ -0,0 +1,104 @@
+/**
+ * @file test_array_sort_cmp.cpp
+ * @brief qsort versus array_sort and array_radix_sort on 16 byte records keyed by an int64.
+ *
+ * Compile with:
+ * g++ -std=c++17 -O2 test_array_sort_cmp.cpp -I/path/to/include -L/path/to/lib -lds -o sort_bench
+ *
+ * Run with optional record count: ./sort_bench [records]
+ */
+
+#include "../include/benchmark.hpp"
+#include <ds/arrays/array_sort.h>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <vector>
+#include <iostream>
+
+struct record {
+    int64_t key;
+    uint64_t payload;
+};
+
+static int record_cmp(const void *a, const void *b)
+{
+    int64_t x = static_cast<const record *>(a)->key, y = static_cast<const record *>(b)->key;
+    return (x > y) - (x < y);
+}
+
+typedef void (*sorter)(std::vector<record> &records);
+
+static void sort_qsort(std::vector<record> &records)
+{
+    std::qsort(records.data(), records.size(), sizeof(record), record_cmp);
+}
+
+static void sort_pdq(std::vector<record> &records)
+{
+    struct array view = { records.data(), records.size(), sizeof(record) };
+    array_sort(&view, record_cmp);
+}
+
+static void sort_radix_stable(std::vector<record> &records)
+{
+    struct array view = { records.data(), records.size(), sizeof(record) };
+    array_radix_sort(&view, offsetof(record, key), ARRAY_I64, 1);
+}
+
+static void sort_radix_in_place(std::vector<record> &records)
+{
+    struct array view = { records.data(), records.size(), sizeof(record) };
+    array_radix_sort(&view, offsetof(record, key), ARRAY_I64, 0);
+}
+
+static double run(sorter sort, const std::vector<record> &input, bool &sorted)
+{
+    std::vector<record> records(input);
+    BenchmarkTimer timer;
+    BENCHMARK_START(timer);
+    sort(records);
+    BENCHMARK_STOP(timer);
+    struct array view = { records.data(), records.size(), sizeof(record) };
+    sorted = array_is_sorted(&view, record_cmp);
+    return timer.elapsed_ms();
+}
+
+int main(int argc, char **argv)
+{
+    size_t count = (argc > 1) ? std::strtoull(argv[1], nullptr, 10) : 10000000;
+    std::mt19937_64 rng(42);
+    std::vector<record> random(count), nearly(count);
+    for (size_t i = 0; i < count; i++) {
+        random[i] = { static_cast<int64_t>(rng()), i };
+        nearly[i] = { static_cast<int64_t>(i), i };
+    }
+    for (size_t i = 0; i < count / 100; i++)
+        std::swap(nearly[rng() % count], nearly[rng() % count]);
+
+    const char *names[] = { "qsort", "array_sort", "radix stable (LSD)", "radix in place (MSD)" };
+    sorter sorters[] = { sort_qsort, sort_pdq, sort_radix_stable, sort_radix_in_place };
+    const char *inputs[] = { "random", "1% swapped" };
+    const std::vector<record> *data[] = { &random, &nearly };
+
+    std::cout << std::string(70, '=') << std::endl;
+    std::cout << count << " records of 16 bytes, int64 keys" << std::endl;
+    std::cout << std::string(70, '=') << std::endl;
+    for (int in = 0; in < 2; in++) {
+        std::cout << inputs[in] << std::endl << std::string(70, '-') << std::endl;
+        double baseline = 0;
+        for (int s = 0; s < 4; s++) {
+            bool sorted;
+            double ms = run(sorters[s], *data[in], sorted);
+            if (s == 0)
+                baseline = ms;
+            std::cout << std::left << std::setw(24) << names[s] << std::right << std::fixed << std::setprecision(2)
+                      << std::setw(12) << ms << " ms" << std::setw(10) << baseline / ms << "x"
+                      << (sorted ? "" : "  NOT SORTED") << std::endl;
+        }
+    }
+    std::cout << std::string(70, '=') << std::endl;
+    return 0;
+}
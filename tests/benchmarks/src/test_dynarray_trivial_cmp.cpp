@@ -0,0 +1,107 @@
+/**
+ * @file test_dynarray_trivial_cmp.cpp
+ * @brief Bulk dynarray operations on ints, copied thru an init callback versus bitwise.
+ *
+ * A NULL object_concept.init makes dynarray treat objects as trivially copyable, so
+ * push back, range insert and resize turn into memcpy/memmove instead of a call per element.
+ *
+ * Compile with:
+ * g++ -std=c++17 -O2 test_dynarray_trivial_cmp.cpp -I/path/to/include -L/path/to/lib -lds -o trivial_bench
+ *
+ * Run with optional element count: ./trivial_bench [elements]
+ */
+
+#include "../include/benchmark.hpp"
+#include <ds/arrays/dynarray.h>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+#include <iostream>
+
+static int int_init(void *object, void *args)
+{
+    std::memcpy(object, args, sizeof(int));
+    return 0;
+}
+
+static double bench_push_back(struct object_concept oc, size_t count, long long &checksum)
+{
+    struct dynarray arr;
+    dynarray_init(&arr, 1, sizeof(int), oc);
+    BenchmarkTimer timer;
+    BENCHMARK_START(timer);
+    for (size_t i = 0; i < count; i++) {
+        int value = static_cast<int>(i);
+        dynarray_push_back(&arr, &value);
+    }
+    BENCHMARK_STOP(timer);
+    checksum += *static_cast<int *>(dynarray_back(&arr));
+    dynarray_deinit(&arr);
+    return timer.elapsed_ms();
+}
+
+static double bench_insert(struct object_concept oc, const std::vector<int> &source, long long &checksum)
+{
+    struct dynarray arr;
+    dynarray_init(&arr, 1, sizeof(int), oc);
+    int *begin = const_cast<int *>(source.data());
+    BenchmarkTimer timer;
+    BENCHMARK_START(timer);
+    dynarray_insert(&arr, 0, begin, begin + source.size());
+    // Second copy in the middle shifts the first half
+    dynarray_insert(&arr, source.size() / 2, begin, begin + source.size());
+    BENCHMARK_STOP(timer);
+    checksum += *static_cast<int *>(dynarray_back(&arr));
+    dynarray_deinit(&arr);
+    return timer.elapsed_ms();
+}
+
+static double bench_resize(struct object_concept oc, size_t count, long long &checksum)
+{
+    struct dynarray arr;
+    dynarray_init(&arr, 1, sizeof(int), oc);
+    int fill = 7;
+    BenchmarkTimer timer;
+    BENCHMARK_START(timer);
+    dynarray_resize(&arr, count, &fill);
+    BENCHMARK_STOP(timer);
+    checksum += *static_cast<int *>(dynarray_back(&arr));
+    dynarray_deinit(&arr);
+    return timer.elapsed_ms();
+}
+
+static void print_row(const char *name, double callback_ms, double trivial_ms)
+{
+    std::cout << std::left << std::setw(22) << name
+              << std::right << std::setw(12) << std::fixed << std::setprecision(2) << callback_ms << " ms"
+              << std::setw(12) << trivial_ms << " ms"
+              << std::setw(10) << callback_ms / trivial_ms << "x" << std::endl;
+}
+
+int main(int argc, char **argv)
+{
+    size_t count = (argc > 1) ? std::strtoull(argv[1], nullptr, 10) : 1000000;
+    std::vector<int> source(count);
+    for (size_t i = 0; i < count; i++)
+        source[i] = static_cast<int>(i);
+    struct object_concept callback = { int_init, NULL, NULL };
+    struct object_concept trivial = { NULL, NULL, NULL };
+
+    std::cout << std::string(70, '=') << std::endl;
+    std::cout << count << " ints" << std::endl;
+    std::cout << std::string(70, '=') << std::endl;
+    std::cout << std::left << std::setw(22) << "Operation"
+              << std::right << std::setw(15) << "init callback"
+              << std::setw(15) << "bitwise"
+              << std::setw(11) << "Speedup" << std::endl;
+    std::cout << std::string(70, '-') << std::endl;
+
+    long long checksum = 0;
+    print_row("push_back", bench_push_back(callback, count, checksum), bench_push_back(trivial, count, checksum));
+    print_row("insert range", bench_insert(callback, source, checksum), bench_insert(trivial, source, checksum));
+    print_row("resize", bench_resize(callback, count, checksum), bench_resize(trivial, count, checksum));
+
+    std::cout << std::string(70, '=') << std::endl;
+    std::cout << "checksum " << checksum << std::endl;
+    return 0;
+}
@@ -0,0 +1,137 @@
+/**
+ * @file test_flat_map_cmp.cpp
+ * @brief Lookups in flat_map (sorted and Eytzinger layouts) versus avl_search and Btree_search.
+ *
+ * Every structure holds the same int64 keyed entries and answers the same random hits
+ * and misses. Sizes go from cache resident to well past the last level cache.
+ *
+ * Compile with:
+ * g++ -std=c++17 -O2 test_flat_map_cmp.cpp -I/path/to/include -L/path/to/lib -lds -o flat_map_bench
+ *
+ * Run with optional lookup count: ./flat_map_bench [lookups]
+ */
+
+#include "../include/benchmark.hpp"
+#include <ds/arrays/flat_map.h>
+#include <ds/trees/avl.h>
+#include <ds/trees/Btree.h>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <algorithm>
+#include <random>
+#include <vector>
+#include <iostream>
+
+#define BTREE_ORDER 32
+
+struct entry {
+    int64_t key;
+    int64_t value;
+};
+
+// Intrusive node first, so a node pointer is an avl_entry pointer
+struct avl_entry {
+    struct avl_node node;
+    struct entry data;
+};
+
+static int key_cmp(const void *a, const void *b)
+{
+    int64_t x = *static_cast<const int64_t *>(a), y = *static_cast<const int64_t *>(b);
+    return (x > y) - (x < y);
+}
+
+static int avl_node_cmp(const struct bintree *a, const struct bintree *b)
+{
+    return key_cmp(&reinterpret_cast<const avl_entry *>(a)->data.key, &reinterpret_cast<const avl_entry *>(b)->data.key);
+}
+
+static int avl_key_cmp(const void *key, const struct bintree *node)
+{
+    return key_cmp(key, &reinterpret_cast<const avl_entry *>(node)->data.key);
+}
+
+// Sums found values so no lookup can be optimized away
+template <typename Find>
+static double run(const std::vector<int64_t> &queries, Find find, int64_t &checksum)
+{
+    BenchmarkTimer timer;
+    checksum = 0;
+    BENCHMARK_START(timer);
+    for (int64_t q : queries) {
+        const entry *e = find(q);
+        checksum += e ? e->value : -1;
+    }
+    BENCHMARK_STOP(timer);
+    return timer.elapsed_ms();
+}
+
+static void bench(size_t count, size_t lookups, std::mt19937_64 &rng)
+{
+    // Even keys are present, odd ones are misses
+    std::vector<entry> entries(count);
+    for (size_t i = 0; i < count; i++)
+        entries[i] = { static_cast<int64_t>(2 * i), static_cast<int64_t>(i) };
+    std::shuffle(entries.begin(), entries.end(), rng);
+    std::vector<int64_t> queries(lookups);
+    for (auto &q : queries)
+        q = static_cast<int64_t>(rng() % (2 * count));
+
+    struct flat_map sorted, eytzinger;
+    flat_map_init(&sorted, sizeof(entry), sizeof(int64_t), key_cmp);
+    flat_map_init(&eytzinger, sizeof(entry), sizeof(int64_t), key_cmp);
+    flat_map_set_layout(&eytzinger, FLAT_MAP_EYTZINGER);
+    flat_map_build(&sorted, entries.data(), count);
+    flat_map_build(&eytzinger, entries.data(), count);
+
+    std::vector<avl_entry> avl_nodes(count);
+    struct avl avl_tree;
+    avl_init(&avl_tree, avl_node_cmp);
+    for (size_t i = 0; i < count; i++) {
+        avl_nodes[i].node.btree.parent = avl_nodes[i].node.btree.left = avl_nodes[i].node.btree.right = NULL;
+        avl_nodes[i].data = entries[i];
+        avl_add(&avl_tree, &avl_nodes[i].node);
+    }
+
+    struct syspool pool = { Btree_node_sizeof(BTREE_ORDER) };
+    struct allocator_concept ac = { &pool, sysalloc, sysfree };
+    struct Btree btree;
+    Btree_init(&btree, BTREE_ORDER, key_cmp, &ac);
+    for (size_t i = 0; i < count; i++)
+        Btree_add(&btree, &entries[i]);
+
+    const char *names[] = { "avl_search", "Btree_search", "flat_map sorted", "flat_map Eytzinger" };
+    int64_t sums[4];
+    double ms[4];
+    ms[0] = run(queries, [&](int64_t q) {
+        struct avl_node *n = avl_search(&avl_tree, &q, avl_key_cmp);
+        return n ? &reinterpret_cast<const avl_entry *>(n)->data : nullptr;
+    }, sums[0]);
+    ms[1] = run(queries, [&](int64_t q) { return static_cast<const entry *>(Btree_search(&btree, &q)); }, sums[1]);
+    ms[2] = run(queries, [&](int64_t q) { return static_cast<const entry *>(flat_map_find(&sorted, &q)); }, sums[2]);
+    ms[3] = run(queries, [&](int64_t q) { return static_cast<const entry *>(flat_map_find(&eytzinger, &q)); }, sums[3]);
+
+    std::cout << count << " entries, " << lookups << " lookups, half of them misses" << std::endl;
+    std::cout << std::string(70, '-') << std::endl;
+    for (int i = 0; i < 4; i++) {
+        std::cout << std::left << std::setw(24) << names[i] << std::right << std::fixed << std::setprecision(2)
+                  << std::setw(12) << ms[i] << " ms" << std::setw(10) << ms[0] / ms[i] << "x"
+                  << (sums[i] == sums[0] ? "" : "  MISMATCH") << std::endl;
+    }
+    std::cout << std::string(70, '=') << std::endl;
+
+    Btree_deinit(&btree, NULL);
+    flat_map_deinit(&sorted);
+    flat_map_deinit(&eytzinger);
+}
+
+int main(int argc, char **argv)
+{
+    size_t lookups = (argc > 1) ? std::strtoull(argv[1], nullptr, 10) : 2000000;
+    std::mt19937_64 rng(42);
+    std::cout << std::string(70, '=') << std::endl;
+    for (size_t count : { 1000, 100000, 10000000 })
+        bench(count, lookups, rng);
+    return 0;
+}
@@ -0,0 +1,94 @@
+/**
+ * @file test_hash_table_churn_cmp.cpp
+ * @brief Lookups in hash_table after insert/remove churn, tombstone leaving modes versus
+ * HASH_TABLE_PROBE_ROBIN_HOOD.
+ *
+ * Every table goes thru the same random inserts and removes at a steady size, then answers
+ * the same hits and misses. Probe lengths come from hash_table_get_probe_stats.
+ *
+ * Compile with:
+ * g++ -std=c++17 -O2 test_hash_table_churn_cmp.cpp -I/path/to/include -L/path/to/lib -lds -o hash_churn_bench
+ *
+ * Run with optional churn operation count: ./hash_churn_bench [operations]
+ */
+
+#include "../include/benchmark.hpp"
+#include <ds/hashs/hash_table.h>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <random>
+#include <vector>
+#include <iostream>
+
+static int u64_cmp(const void *a, const void *b)
+{
+    return *static_cast<const uint64_t *>(a) != *static_cast<const uint64_t *>(b);
+}
+
+static void bench(size_t count, size_t operations)
+{
+    // Half of the key space is present at any time, so the size stays around count
+    std::vector<uint64_t> keys(2 * count);
+    for (size_t i = 0; i < keys.size(); i++)
+        keys[i] = i * 0x9e3779b97f4a7c15ull;
+    std::vector<size_t> picks(operations), queries(2000000);
+    std::mt19937_64 rng(42);
+    for (auto &p : picks)
+        p = rng() % keys.size();
+    for (auto &q : queries)
+        q = rng() % keys.size();
+
+    struct hash_concept hc = { NULL, u64_cmp, hash64_u64 };
+    const char *names[] = { "linear (tombstones)", "quadratic (tombstones)", "robin hood" };
+    enum hash_table_probing probings[] = { HASH_TABLE_PROBE_LINEAR, HASH_TABLE_PROBE_QUADRATIC, HASH_TABLE_PROBE_ROBIN_HOOD };
+
+    std::cout << count << " live keys, " << operations << " churn operations, " << queries.size()
+              << " lookups" << std::endl;
+    std::cout << std::string(70, '-') << std::endl;
+    std::cout << std::left << std::setw(24) << "mode" << std::right << std::setw(12) << "churn"
+              << std::setw(12) << "lookups" << std::setw(10) << "max" << std::setw(10) << "mean" << std::endl;
+    for (int t = 0; t < 3; t++) {
+        struct hash_table_config config = { .probing = probings[t], .engine = HASH_TABLE_ENGINE_OPEN, .store_hash = 0, .incremental = 0 };
+        struct hash_table *ht = hash_table_create_config(&hc, NULL, &config);
+        std::vector<char> present(keys.size(), 0);
+        for (size_t i = 0; i < keys.size(); i += 2) {
+            hash_table_insert(ht, &keys[i], &keys[i]);
+            present[i] = 1;
+        }
+
+        BenchmarkTimer churn_timer, lookup_timer;
+        BENCHMARK_START(churn_timer);
+        for (size_t p : picks) {
+            if (present[p])
+                hash_table_remove(ht, &keys[p]);
+            else
+                hash_table_insert(ht, &keys[p], &keys[p]);
+            present[p] ^= 1;
+        }
+        BENCHMARK_STOP(churn_timer);
+
+        size_t found = 0;
+        BENCHMARK_START(lookup_timer);
+        for (size_t q : queries)
+            found += hash_table_search(ht, &keys[q]) != NULL;
+        BENCHMARK_STOP(lookup_timer);
+
+        struct hash_table_probe_stats ps;
+        hash_table_get_probe_stats(ht, &ps);
+        std::cout << std::left << std::setw(24) << names[t] << std::right << std::fixed << std::setprecision(2)
+                  << std::setw(9) << churn_timer.elapsed_ms() << " ms" << std::setw(9) << lookup_timer.elapsed_ms() << " ms"
+                  << std::setw(10) << ps.max << std::setw(10) << ps.mean << "  (" << found << " hits)" << std::endl;
+        hash_table_destroy(ht, NULL);
+    }
+    std::cout << std::string(70, '=') << std::endl;
+}
+
+int main(int argc, char **argv)
+{
+    size_t operations = (argc > 1) ? std::strtoull(argv[1], nullptr, 10) : 4000000;
+    std::cout << std::string(70, '=') << std::endl;
+    for (size_t count : { 10000, 1000000 })
+        bench(count, operations);
+    return 0;
+}
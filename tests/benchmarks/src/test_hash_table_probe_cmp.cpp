@@ -0,0 +1,128 @@
+/**
+ * @file test_hash_table_probe_cmp.cpp
+ * @brief String key lookups in hash_table, double hashing thru hash_concept::hash versus
+ * one hash64 per lookup with linear and quadratic probing and the swiss engine, with and
+ * without stored hashes.
+ *
+ * Every table holds the same string keys and answers the same random hits and misses.
+ * Build time includes every resize on the way.
+ *
+ * Compile with:
+ * g++ -std=c++17 -O2 test_hash_table_probe_cmp.cpp -I/path/to/include -L/path/to/lib -lds -o hash_probe_bench
+ *
+ * Run with optional lookup count: ./hash_probe_bench [lookups]
+ */
+
+#include "../include/benchmark.hpp"
+#include <ds/hashs/hash_table.h>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+#include <iostream>
+
+#define HT_PRIME_1 151
+#define HT_PRIME_2 217
+
+// The sample hash of hash_table.h, rehashes the whole key twice per probe.
+// Its step is kept below capacity, hash_b + 1 == capacity would never leave the first slot
+static size_t hash_str(const char *s, int p, size_t capacity)
+{
+    unsigned long long hash = 0;
+    while (*s)
+        hash = hash * p + *s++;
+    return static_cast<size_t>(hash % capacity);
+}
+
+static size_t double_hash(const void *obj, size_t capacity, size_t attempts)
+{
+    size_t hash_a = hash_str(static_cast<const char *>(obj), HT_PRIME_1, capacity);
+    size_t hash_b = hash_str(static_cast<const char *>(obj), HT_PRIME_2, capacity);
+    return (hash_a + attempts * (hash_b % (capacity - 1) + 1)) % capacity;
+}
+
+static int string_cmp(const void *a, const void *b)
+{
+    return std::strcmp(static_cast<const char *>(a), static_cast<const char *>(b));
+}
+
+// Sums found values so no lookup can be optimized away
+static double run(struct hash_table *ht, const std::vector<std::string> &queries, int64_t &checksum)
+{
+    BenchmarkTimer timer;
+    checksum = 0;
+    BENCHMARK_START(timer);
+    for (const std::string &q : queries) {
+        const int64_t *v = static_cast<const int64_t *>(hash_table_search(ht, q.c_str()));
+        checksum += v ? *v : -1;
+    }
+    BENCHMARK_STOP(timer);
+    return timer.elapsed_ms();
+}
+
+static void bench(size_t count, size_t lookups, std::mt19937_64 &rng)
+{
+    // Long common prefix, as in path or URL keys
+    std::vector<std::string> keys(2 * count);
+    for (size_t i = 0; i < 2 * count; i++)
+        keys[i] = "/srv/data/objects/" + std::to_string(i * 2654435761u) + "/payload";
+    std::vector<int64_t> values(count);
+    std::vector<std::string> queries(lookups);
+    for (auto &q : queries)
+        q = keys[rng() % (2 * count)];
+
+    struct hash_concept hc = { double_hash, string_cmp, hash64_string };
+    const char *names[] = { "double hash (concept)", "hash64 linear", "hash64 quadratic", "swiss engine",
+                            "linear + stored hash", "robin hood + stored" };
+    struct hash_table_config configs[] = {
+        { .probing = HASH_TABLE_PROBE_CONCEPT, .engine = HASH_TABLE_ENGINE_OPEN, .store_hash = 0, .incremental = 0 },
+        { .probing = HASH_TABLE_PROBE_LINEAR, .engine = HASH_TABLE_ENGINE_OPEN, .store_hash = 0, .incremental = 0 },
+        { .probing = HASH_TABLE_PROBE_QUADRATIC, .engine = HASH_TABLE_ENGINE_OPEN, .store_hash = 0, .incremental = 0 },
+        { .probing = HASH_TABLE_PROBE_CONCEPT, .engine = HASH_TABLE_ENGINE_SWISS, .store_hash = 0, .incremental = 0 },
+        { .probing = HASH_TABLE_PROBE_LINEAR, .engine = HASH_TABLE_ENGINE_OPEN, .store_hash = 1, .incremental = 0 },
+        { .probing = HASH_TABLE_PROBE_ROBIN_HOOD, .engine = HASH_TABLE_ENGINE_OPEN, .store_hash = 1, .incremental = 0 },
+    };
+    const int TABLES = sizeof(configs) / sizeof(configs[0]);
+    int64_t sums[TABLES];
+    double ms[TABLES], build_ms[TABLES];
+    for (int t = 0; t < TABLES; t++) {
+        struct hash_table_config config = configs[t];
+        struct hash_table *ht = hash_table_create_config(&hc, NULL, &config);
+        // Only the first half of keys is inserted, the rest are misses
+        BenchmarkTimer timer;
+        BENCHMARK_START(timer);
+        for (size_t i = 0; i < count; i++) {
+            values[i] = static_cast<int64_t>(i);
+            hash_table_insert(ht, const_cast<char *>(keys[i].c_str()), &values[i]);
+        }
+        BENCHMARK_STOP(timer);
+        build_ms[t] = timer.elapsed_ms();
+        ms[t] = run(ht, queries, sums[t]);
+        hash_table_destroy(ht, NULL);
+    }
+
+    std::cout << count << " keys, " << lookups << " lookups, half of them misses" << std::endl;
+    std::cout << std::string(70, '-') << std::endl;
+    std::cout << std::left << std::setw(24) << "table" << std::right << std::setw(15) << "build"
+              << std::setw(15) << "lookups" << std::setw(10) << "speedup" << std::endl;
+    for (int i = 0; i < TABLES; i++) {
+        std::cout << std::left << std::setw(24) << names[i] << std::right << std::fixed << std::setprecision(2)
+                  << std::setw(12) << build_ms[i] << " ms" << std::setw(12) << ms[i] << " ms"
+                  << std::setw(10) << ms[0] / ms[i] << "x"
+                  << (sums[i] == sums[0] ? "" : "  MISMATCH") << std::endl;
+    }
+    std::cout << std::string(70, '=') << std::endl;
+}
+
+int main(int argc, char **argv)
+{
+    size_t lookups = (argc > 1) ? std::strtoull(argv[1], nullptr, 10) : 2000000;
+    std::mt19937_64 rng(42);
+    std::cout << std::string(70, '=') << std::endl;
+    for (size_t count : { 1000, 100000, 1000000 })
+        bench(count, lookups, rng);
+    return 0;
+}
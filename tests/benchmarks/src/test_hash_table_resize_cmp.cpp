@@ -0,0 +1,71 @@
+/**
+ * @file test_hash_table_resize_cmp.cpp
+ * @brief Per insert latency of hash_table, resizes in one call versus incremental resizes.
+ *
+ * Every table receives the same keys from empty, each insert is timed on its own.
+ * Percentiles show what the resizing calls cost, the total shows what the migration
+ * spread over later calls costs.
+ *
+ * Compile with:
+ * g++ -std=c++17 -O2 test_hash_table_resize_cmp.cpp -I/path/to/include -L/path/to/lib -lds -o hash_resize_bench
+ *
+ * Run with optional key count: ./hash_resize_bench [keys]
+ */
+
+#include "../include/benchmark.hpp"
+#include <ds/hashs/hash_table.h>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <algorithm>
+#include <chrono>
+#include <vector>
+#include <iostream>
+
+static int u64_cmp(const void *a, const void *b)
+{
+    return *static_cast<const uint64_t *>(a) != *static_cast<const uint64_t *>(b);
+}
+
+int main(int argc, char **argv)
+{
+    size_t count = (argc > 1) ? std::strtoull(argv[1], nullptr, 10) : 10000000;
+    std::vector<uint64_t> keys(count);
+    for (size_t i = 0; i < count; i++)
+        keys[i] = i * 0x9e3779b97f4a7c15ull;
+
+    struct hash_concept hc = { NULL, u64_cmp, hash64_u64 };
+    const char *names[] = { "linear, one call", "linear, incremental", "linear + stored, incremental" };
+    struct hash_table_config configs[] = {
+        { .probing = HASH_TABLE_PROBE_LINEAR, .engine = HASH_TABLE_ENGINE_OPEN, .store_hash = 0, .incremental = 0 },
+        { .probing = HASH_TABLE_PROBE_LINEAR, .engine = HASH_TABLE_ENGINE_OPEN, .store_hash = 0, .incremental = 1 },
+        { .probing = HASH_TABLE_PROBE_LINEAR, .engine = HASH_TABLE_ENGINE_OPEN, .store_hash = 1, .incremental = 1 },
+    };
+
+    std::cout << std::string(80, '=') << std::endl;
+    std::cout << count << " inserts into an empty table" << std::endl;
+    std::cout << std::string(80, '-') << std::endl;
+    std::cout << std::left << std::setw(30) << "table" << std::right << std::setw(12) << "total"
+              << std::setw(12) << "p99.9" << std::setw(12) << "p99.99" << std::setw(14) << "max" << std::endl;
+    std::vector<uint64_t> latencies(count);
+    for (int t = 0; t < 3; t++) {
+        struct hash_table *ht = hash_table_create_config(&hc, NULL, &configs[t]);
+        uint64_t total = 0;
+        for (size_t i = 0; i < count; i++) {
+            auto start = std::chrono::steady_clock::now();
+            hash_table_insert(ht, &keys[i], &keys[i]);
+            auto stop = std::chrono::steady_clock::now();
+            latencies[i] = std::chrono::duration_cast<std::chrono::nanoseconds>(stop - start).count();
+            total += latencies[i];
+        }
+        std::sort(latencies.begin(), latencies.end());
+        std::cout << std::left << std::setw(30) << names[t] << std::right << std::fixed << std::setprecision(2)
+                  << std::setw(9) << total / 1e6 << " ms"
+                  << std::setw(9) << latencies[count * 999 / 1000] << " ns"
+                  << std::setw(9) << latencies[count * 9999 / 10000] << " ns"
+                  << std::setw(11) << latencies[count - 1] / 1e3 << " us" << std::endl;
+        hash_table_destroy(ht, NULL);
+    }
+    std::cout << std::string(80, '=') << std::endl;
+    return 0;
+}
@@ -0,0 +1,139 @@
+/**
+ * @file test_hugepage_lookup_cmp.cpp
+ * @brief Random lookup throughput over mmap backed buffers, with and without huge pages.
+ *
+ * Both a dynarray gather and hash_table searches are measured. Buffers are far larger
+ * than the TLB reach of 4K pages, so most lookups miss the TLB unless transparent huge
+ * pages back the buffer. Check /sys/kernel/mm/transparent_hugepage/enabled is not "never".
+ *
+ * Compile with:
+ * g++ -std=c++17 -O2 test_hugepage_lookup_cmp.cpp -I/path/to/include -L/path/to/lib -lds -o hugepage_bench
+ *
+ * Run with optional element counts: ./hugepage_bench [array_elements] [hash_keys]
+ */
+
+#include "../include/benchmark.hpp"
+#include <ds/utils/mmap_allocator.h>
+#include <ds/arrays/dynarray.h>
+#include <ds/hashs/hash_table.h>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <vector>
+#include <iostream>
+
+static constexpr size_t LOOKUPS = 10000000;
+
+static int u64_init(void *object, void *args)
+{
+    std::memcpy(object, args, sizeof(uint64_t));
+    return 0;
+}
+
+static size_t u64_hash(const void *key, size_t capacity, size_t attempts)
+{
+    uint64_t x = *static_cast<const uint64_t *>(key) * 0x9E3779B97F4A7C15ull;
+    size_t step = 1 + static_cast<size_t>(x >> 41) % (capacity - 1);
+    return static_cast<size_t>((x >> 17) % capacity + attempts * step) % capacity;
+}
+
+static int u64_cmp(const void *a, const void *b)
+{
+    uint64_t x = *static_cast<const uint64_t *>(a), y = *static_cast<const uint64_t *>(b);
+    return (x > y) - (x < y);
+}
+
+static double bench_dynarray(int flags, size_t count, const std::vector<size_t> &indices, uint64_t &checksum)
+{
+    struct mmap_allocator ma;
+    mmap_allocator_init(&ma, 0, flags | MMAP_ALLOCATOR_POPULATE);
+    struct sized_allocator_concept sac = mmap_allocator_concept(&ma);
+    struct object_concept oc = { u64_init, NULL, NULL };
+    struct dynarray arr;
+    dynarray_init_with(&arr, count, sizeof(uint64_t), oc, &sac);
+    uint64_t zero = 0;
+    dynarray_resize(&arr, count, &zero);
+    uint64_t *data = static_cast<uint64_t *>(dynarray_iterator_begin(&arr));
+    for (size_t i = 0; i < count; i++)
+        data[i] = i;
+
+    BenchmarkTimer timer;
+    uint64_t sum = 0;
+    BENCHMARK_START(timer);
+    for (size_t index : indices)
+        sum += data[index % count];
+    BENCHMARK_STOP(timer);
+    checksum += sum;
+    dynarray_deinit(&arr);
+    return timer.elapsed_ms();
+}
+
+static double bench_hash_table(int flags, const std::vector<uint64_t> &keys, const std::vector<size_t> &indices, uint64_t &checksum)
+{
+    struct mmap_allocator ma;
+    mmap_allocator_init(&ma, 0, flags);
+    struct sized_allocator_concept sac = mmap_allocator_concept(&ma);
+    struct hash_concept hc = { u64_hash, u64_cmp, NULL };
+    struct hash_table *ht = hash_table_create_with(&hc, &sac);
+    for (const uint64_t &key : keys)
+        hash_table_insert(ht, const_cast<uint64_t *>(&key), const_cast<uint64_t *>(&key));
+
+    BenchmarkTimer timer;
+    uint64_t sum = 0;
+    BENCHMARK_START(timer);
+    for (size_t index : indices) {
+        const uint64_t &key = keys[index % keys.size()];
+        sum += *static_cast<uint64_t *>(hash_table_search(ht, &key));
+    }
+    BENCHMARK_STOP(timer);
+    checksum += sum;
+    hash_table_destroy(ht, NULL);
+    return timer.elapsed_ms();
+}
+
+static void print_row(const char *name, double base_ms, double huge_ms)
+{
+    double mops = LOOKUPS / 1000.0;
+    std::cout << std::left << std::setw(22) << name
+              << std::right << std::setw(10) << std::fixed << std::setprecision(1) << mops / base_ms << " Mop/s"
+              << std::setw(10) << mops / huge_ms << " Mop/s"
+              << std::setw(10) << std::setprecision(2) << base_ms / huge_ms << "x" << std::endl;
+}
+
+int main(int argc, char **argv)
+{
+    size_t array_count = (argc > 1) ? std::strtoull(argv[1], nullptr, 10) : (size_t) 64 << 20;
+    size_t key_count = (argc > 2) ? std::strtoull(argv[2], nullptr, 10) : (size_t) 4 << 20;
+
+    std::mt19937_64 rng(42);
+    std::vector<size_t> indices(LOOKUPS);
+    for (size_t &index : indices)
+        index = rng();
+    std::vector<uint64_t> keys(key_count);
+    for (size_t i = 0; i < key_count; i++)
+        keys[i] = i * 0x100000001B3ull;
+
+    std::cout << std::string(70, '=') << std::endl;
+    std::cout << LOOKUPS << " random lookups, " << array_count << " array elements, "
+              << key_count << " hash keys" << std::endl;
+    std::cout << std::string(70, '=') << std::endl;
+    std::cout << std::left << std::setw(22) << "Container"
+              << std::right << std::setw(16) << "4K pages"
+              << std::setw(16) << "Huge pages"
+              << std::setw(11) << "Speedup" << std::endl;
+    std::cout << std::string(70, '-') << std::endl;
+
+    uint64_t checksum = 0;
+    double base_ms = bench_dynarray(0, array_count, indices, checksum);
+    double huge_ms = bench_dynarray(MMAP_ALLOCATOR_HUGEPAGES, array_count, indices, checksum);
+    print_row("dynarray gather", base_ms, huge_ms);
+
+    base_ms = bench_hash_table(0, keys, indices, checksum);
+    huge_ms = bench_hash_table(MMAP_ALLOCATOR_HUGEPAGES, keys, indices, checksum);
+    print_row("hash_table search", base_ms, huge_ms);
+
+    std::cout << std::string(70, '=') << std::endl;
+    std::cout << "checksum " << checksum << std::endl;
+    return 0;
+}
@@ -0,0 +1,93 @@
+/**
+ * @file test_mapped_dynarray_cmp.cpp
+ * @brief Cold start of a checkpointed dynarray: fread into a dynarray versus reopening a mapped_dynarray.
+ *
+ * Both files hold the same uint64 objects and stay in the page cache, so the numbers
+ * show the cost of deserializing, not of the disk. Reopening is timed alone and with a
+ * full scan, which faults every page in.
+ *
+ * Compile with:
+ * g++ -std=c++17 -O2 test_mapped_dynarray_cmp.cpp -I/path/to/include -L/path/to/lib -lds -o mapped_bench
+ *
+ * Run with optional object count and directory: ./mapped_bench [objects] [dir]
+ */
+
+#include "../include/benchmark.hpp"
+#include <ds/arrays/mapped_dynarray.h>
+#include <ds/arrays/array_kernels.h>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <iostream>
+
+static uint64_t sum(struct dynarray *arr)
+{
+    uint64_t total;
+    array_sum(reinterpret_cast<struct array *>(arr), ARRAY_U64, &total);
+    return total;
+}
+
+int main(int argc, char **argv)
+{
+    size_t count = (argc > 1) ? std::strtoull(argv[1], nullptr, 10) : 20000000;
+    std::string dir = (argc > 2) ? argv[2] : "/tmp";
+    std::string raw_path = dir + "/mapped_bench.raw", mapped_path = dir + "/mapped_bench.map";
+    struct object_concept oc = { NULL, NULL, NULL };
+
+    // Checkpoint the same objects both ways
+    struct mapped_dynarray md;
+    mapped_dynarray_open(&md, mapped_path.c_str(), sizeof(uint64_t), count, MAPPED_DYNARRAY_TRUNCATE);
+    for (uint64_t i = 0; i < count; i++)
+        dynarray_push_back(mapped_dynarray_base(&md), &i);
+    FILE *f = std::fopen(raw_path.c_str(), "wb");
+    size_t size = mapped_dynarray_size(&md);
+    std::fwrite(&size, sizeof(size), 1, f);
+    std::fwrite(mapped_dynarray_base(&md)->base.buffer, sizeof(uint64_t), size, f);
+    std::fclose(f);
+    mapped_dynarray_close(&md);
+
+    BenchmarkTimer timer;
+    uint64_t sums[3];
+    double ms[3];
+
+    BENCHMARK_START(timer);
+    struct dynarray arr;
+    f = std::fopen(raw_path.c_str(), "rb");
+    std::fread(&size, sizeof(size), 1, f);
+    dynarray_init(&arr, size, sizeof(uint64_t), oc);
+    arr.base.size = std::fread(arr.base.buffer, sizeof(uint64_t), size, f);
+    std::fclose(f);
+    BENCHMARK_STOP(timer);
+    ms[0] = timer.elapsed_ms();
+    sums[0] = sum(&arr);
+    dynarray_deinit(&arr);
+
+    BENCHMARK_START(timer);
+    mapped_dynarray_open(&md, mapped_path.c_str(), sizeof(uint64_t), 1, 0);
+    BENCHMARK_STOP(timer);
+    ms[1] = timer.elapsed_ms();
+    sums[1] = sum(mapped_dynarray_base(&md));
+    mapped_dynarray_close(&md);
+
+    BENCHMARK_START(timer);
+    mapped_dynarray_open(&md, mapped_path.c_str(), sizeof(uint64_t), 1, 0);
+    sums[2] = sum(mapped_dynarray_base(&md));
+    BENCHMARK_STOP(timer);
+    ms[2] = timer.elapsed_ms();
+    mapped_dynarray_close(&md);
+
+    const char *names[] = { "fread into dynarray", "mapped open", "mapped open + scan" };
+    std::cout << std::string(70, '=') << std::endl;
+    std::cout << count << " uint64 objects, " << count * sizeof(uint64_t) / (1024 * 1024) << " MB" << std::endl;
+    std::cout << std::string(70, '-') << std::endl;
+    for (int i = 0; i < 3; i++) {
+        std::cout << std::left << std::setw(24) << names[i] << std::right << std::fixed << std::setprecision(3)
+                  << std::setw(12) << ms[i] << " ms" << std::setw(12) << std::setprecision(1) << ms[0] / ms[i] << "x"
+                  << (sums[i] == sums[0] ? "" : "  MISMATCH") << std::endl;
+    }
+    std::cout << std::string(70, '=') << std::endl;
+    std::remove(raw_path.c_str());
+    std::remove(mapped_path.c_str());
+    return 0;
+}
@@ -0,0 +1,143 @@
+/**
+ * @file test_rqueue_cmp.cpp
+ * @brief lqueue (malloc and slab pool nodes) versus rqueue, queueing pointers.
+ *
+ * "Fill & drain" enqueues every pointer then dequeues them all, "sliding" keeps a
+ * frontier of a thousand pointers, like a BFS over a wide graph.
+ *
+ * Compile with:
+ * g++ -std=c++17 -O2 test_rqueue_cmp.cpp -I/path/to/include -L/path/to/lib -lds -o rqueue_bench
+ *
+ * Run with optional operation count: ./rqueue_bench [operations]
+ */
+
+#include "../include/benchmark.hpp"
+#include <ds/queue/lqueue.h>
+#include <ds/queue/rqueue.h>
+#include <ds/utils/slab_pool.h>
+#include <cstdint>
+#include <cstdlib>
+#include <vector>
+#include <iostream>
+
+#define FRONTIER 1000
+#define BATCH 64
+
+// Pointers are never dereferenced, any distinct values do
+static void *item(size_t i)
+{
+    return reinterpret_cast<void *>(static_cast<uintptr_t>(i + 1));
+}
+
+static double lqueue_run(struct allocator_concept *ac, size_t count, bool sliding, uintptr_t &checksum)
+{
+    BenchmarkTimer timer;
+    checksum = 0;
+    BENCHMARK_START(timer);
+    struct lqueue *lq = lqueue_create(ac);
+    size_t fill = sliding ? FRONTIER : count;
+    for (size_t i = 0; i < fill; i++)
+        lenqueue(lq, item(i));
+    for (size_t i = fill; sliding && i < count; i++) {
+        checksum += reinterpret_cast<uintptr_t>(ldequeue(lq));
+        lenqueue(lq, item(i));
+    }
+    while (!lqueue_empty(lq))
+        checksum += reinterpret_cast<uintptr_t>(ldequeue(lq));
+    lqueue_destroy(lq, NULL);
+    BENCHMARK_STOP(timer);
+    return timer.elapsed_ms();
+}
+
+static double rqueue_run(size_t count, bool sliding, uintptr_t &checksum)
+{
+    BenchmarkTimer timer;
+    struct object_concept oc = { NULL, NULL, NULL };
+    checksum = 0;
+    BENCHMARK_START(timer);
+    struct rqueue *rq = rqueue_create(sizeof(void *), &oc);
+    size_t fill = sliding ? FRONTIER : count;
+    void *p;
+    for (size_t i = 0; i < fill; i++) {
+        p = item(i);
+        renqueue(rq, &p);
+    }
+    for (size_t i = fill; sliding && i < count; i++) {
+        rdequeue(rq, &p);
+        checksum += reinterpret_cast<uintptr_t>(p);
+        p = item(i);
+        renqueue(rq, &p);
+    }
+    while (rdequeue(rq, &p) == 0)
+        checksum += reinterpret_cast<uintptr_t>(p);
+    rqueue_destroy(rq);
+    BENCHMARK_STOP(timer);
+    return timer.elapsed_ms();
+}
+
+static double rqueue_batch_run(size_t count, bool sliding, uintptr_t &checksum)
+{
+    BenchmarkTimer timer;
+    struct object_concept oc = { NULL, NULL, NULL };
+    void *batch[BATCH];
+    checksum = 0;
+    BENCHMARK_START(timer);
+    struct rqueue *rq = rqueue_create(sizeof(void *), &oc);
+    size_t fill = sliding ? FRONTIER : count;
+    for (size_t i = 0; i < fill; i += BATCH) {
+        size_t n = (fill - i < BATCH) ? fill - i : BATCH;
+        for (size_t j = 0; j < n; j++)
+            batch[j] = item(i + j);
+        renqueue_n(rq, batch, n);
+    }
+    for (size_t i = fill; sliding && i < count; i += BATCH) {
+        size_t n = (count - i < BATCH) ? count - i : BATCH;
+        rdequeue_n(rq, batch, n);
+        for (size_t j = 0; j < n; j++) {
+            checksum += reinterpret_cast<uintptr_t>(batch[j]);
+            batch[j] = item(i + j);
+        }
+        renqueue_n(rq, batch, n);
+    }
+    size_t n;
+    while ((n = rdequeue_n(rq, batch, BATCH)) != 0) {
+        for (size_t j = 0; j < n; j++)
+            checksum += reinterpret_cast<uintptr_t>(batch[j]);
+    }
+    rqueue_destroy(rq);
+    BENCHMARK_STOP(timer);
+    return timer.elapsed_ms();
+}
+
+int main(int argc, char **argv)
+{
+    size_t count = (argc > 1) ? std::strtoull(argv[1], nullptr, 10) : 10000000;
+    struct syspool sys = { lqueue_node_sizeof() };
+    struct allocator_concept sys_ac = { &sys, sysalloc, sysfree };
+    struct slab_pool slab;
+    slab_pool_init(&slab, lqueue_node_sizeof(), 0);
+    struct allocator_concept slab_ac = { &slab, slab_alloc, slab_free };
+
+    const char *names[] = { "lqueue (malloc)", "lqueue (slab pool)", "rqueue", "rqueue batches of 64" };
+    const char *modes[] = { "Fill & drain", "Sliding frontier" };
+    std::cout << std::string(70, '=') << std::endl;
+    std::cout << count << " pointers" << std::endl;
+    for (int m = 0; m < 2; m++) {
+        bool sliding = m == 1;
+        uintptr_t sums[4];
+        double ms[4];
+        ms[0] = lqueue_run(&sys_ac, count, sliding, sums[0]);
+        ms[1] = lqueue_run(&slab_ac, count, sliding, sums[1]);
+        ms[2] = rqueue_run(count, sliding, sums[2]);
+        ms[3] = rqueue_batch_run(count, sliding, sums[3]);
+        std::cout << std::string(70, '-') << std::endl << modes[m] << std::endl;
+        for (int i = 0; i < 4; i++) {
+            std::cout << std::left << std::setw(24) << names[i] << std::right << std::fixed << std::setprecision(2)
+                      << std::setw(12) << ms[i] << " ms" << std::setw(10) << ms[0] / ms[i] << "x"
+                      << (sums[i] == sums[0] ? "" : "  MISMATCH") << std::endl;
+        }
+    }
+    std::cout << std::string(70, '=') << std::endl;
+    slab_pool_deinit(&slab);
+    return 0;
+}
@@ -0,0 +1,91 @@
+/**
+ * @file test_tcache_sysalloc_cmp.cpp
+ * @brief Multi-threaded node allocation: thread-caching pool vs sysalloc.
+ *
+ * Every thread owns an lqueue and an lstack, all of them sharing one allocator.
+ * Threads churn their containers so node allocation dominates the runtime.
+ *
+ * Compile with:
+ * g++ -std=c++17 -O2 test_tcache_sysalloc_cmp.cpp -I/path/to/include -L/path/to/lib -lds -pthread -o tcache_bench
+ */
+
+#include "../include/benchmark.hpp"
+#include <ds/utils/tcache_pool.h>
+#include <ds/queue/lqueue.h>
+#include <ds/stack/lstack.h>
+#include <thread>
+#include <vector>
+#include <iostream>
+#include <cstdlib>
+
+static constexpr int ROUNDS = 2000;
+static constexpr int ITEMS = 1000;
+
+static void churn(struct allocator_concept ac)
+{
+    static int values[ITEMS];
+    struct lqueue *lq = lqueue_create(&ac);
+    struct lstack *ls = lstack_create(&ac);
+    for (int round = 0; round < ROUNDS; round++) {
+        for (int i = 0; i < ITEMS; i++) {
+            lenqueue(lq, &values[i]);
+            lpush(ls, &values[i]);
+        }
+        for (int i = 0; i < ITEMS; i++) {
+            ldequeue(lq);
+            lpop(ls);
+        }
+    }
+    lqueue_destroy(lq, NULL);
+    lstack_destroy(ls, NULL);
+}
+
+static double run(struct allocator_concept ac, unsigned threads)
+{
+    BenchmarkTimer timer;
+    std::vector<std::thread> workers;
+    BENCHMARK_START(timer);
+    for (unsigned i = 0; i < threads; i++)
+        workers.emplace_back(churn, ac);
+    for (auto &worker : workers)
+        worker.join();
+    BENCHMARK_STOP(timer);
+    return timer.elapsed_ms();
+}
+
+int main(int argc, char **argv)
+{
+    unsigned max_threads = (argc > 1) ? std::atoi(argv[1]) : std::thread::hardware_concurrency();
+    if (max_threads == 0)
+        max_threads = 1;
+    // lqueue and lstack nodes have the same layout, so one object size serves both
+    size_t node_size = lqueue_node_sizeof() > lstack_node_sizeof() ? lqueue_node_sizeof() : lstack_node_sizeof();
+
+    std::cout << std::string(80, '=') << std::endl;
+    std::cout << "Node churn: " << ROUNDS << " rounds x " << ITEMS << " items x 2 containers per thread" << std::endl;
+    std::cout << std::string(80, '=') << std::endl;
+    std::cout << std::left << std::setw(10) << "Threads"
+              << std::right << std::setw(18) << "sysalloc"
+              << std::setw(18) << "tcache_pool"
+              << std::setw(12) << "Speedup" << std::endl;
+    std::cout << std::string(80, '-') << std::endl;
+
+    for (unsigned threads = 1; threads <= max_threads; threads *= 2) {
+        struct syspool sp = { node_size };
+        struct allocator_concept sys_ac = { &sp, sysalloc, sysfree };
+        double sys_ms = run(sys_ac, threads);
+
+        struct tcache_pool tp;
+        tcache_pool_init(&tp, node_size, 0);
+        struct allocator_concept tc_ac = { &tp, tcache_alloc, tcache_free };
+        double tc_ms = run(tc_ac, threads);
+        tcache_pool_deinit(&tp);
+
+        std::cout << std::left << std::setw(10) << threads
+                  << std::right << std::setw(15) << std::fixed << std::setprecision(3) << sys_ms << " ms"
+                  << std::setw(15) << tc_ms << " ms"
+                  << std::setw(11) << std::setprecision(2) << sys_ms / tc_ms << "x" << std::endl;
+    }
+    std::cout << std::string(80, '=') << std::endl;
+    return 0;
+}
@@ -0,0 +1,83 @@
+/**
+ * @file test_typed_dynarray_cmp.cpp
+ * @brief Generic dynarray versus a DEFINE_DYNARRAY specialisation on ints.
+ *
+ * Generic access scales every index by a runtime obj_size and copies thru memcpy of
+ * obj_size bytes, typed access indexes an int * and assigns, so loops can be vectorised.
+ *
+ * Compile with:
+ * g++ -std=c++17 -O2 test_typed_dynarray_cmp.cpp -I/path/to/include -L/path/to/lib -lds -o typed_bench
+ *
+ * Run with optional element count: ./typed_bench [elements]
+ */
+
+#include "../include/benchmark.hpp"
+#include <ds/arrays/typed_dynarray.h>
+#include <cstdlib>
+#include <iostream>
+
+DEFINE_DYNARRAY(intvec, int)
+
+static const int ROUNDS = 20;
+
+static double bench_generic(size_t count, long long &checksum)
+{
+    struct object_concept oc = { NULL, NULL, NULL };
+    struct dynarray arr;
+    dynarray_init(&arr, 1, sizeof(int), oc);
+    BenchmarkTimer timer;
+    BENCHMARK_START(timer);
+    for (size_t i = 0; i < count; i++) {
+        int value = static_cast<int>(i);
+        dynarray_push_back(&arr, &value);
+    }
+    for (int r = 0; r < ROUNDS; r++) {
+        long long sum = 0;
+        for (size_t i = 0; i < dynarray_size(&arr); i++)
+            sum += *static_cast<int *>(dynarray_iterator_at(&arr, i));
+        checksum += sum;
+    }
+    BENCHMARK_STOP(timer);
+    dynarray_deinit(&arr);
+    return timer.elapsed_ms();
+}
+
+static double bench_typed(size_t count, long long &checksum)
+{
+    struct intvec v;
+    intvec_init(&v, 1);
+    BenchmarkTimer timer;
+    BENCHMARK_START(timer);
+    for (size_t i = 0; i < count; i++)
+        intvec_push_back(&v, static_cast<int>(i));
+    for (int r = 0; r < ROUNDS; r++) {
+        long long sum = 0;
+        for (size_t i = 0; i < intvec_size(&v); i++)
+            sum += intvec_get(&v, i);
+        checksum += sum;
+    }
+    BENCHMARK_STOP(timer);
+    intvec_deinit(&v);
+    return timer.elapsed_ms();
+}
+
+int main(int argc, char **argv)
+{
+    size_t count = (argc > 1) ? std::strtoull(argv[1], nullptr, 10) : 1000000;
+    long long generic_sum = 0, typed_sum = 0;
+    double generic_ms = bench_generic(count, generic_sum);
+    double typed_ms = bench_typed(count, typed_sum);
+
+    std::cout << std::string(70, '=') << std::endl;
+    std::cout << count << " ints, push back then " << ROUNDS << " summing passes" << std::endl;
+    std::cout << std::string(70, '=') << std::endl;
+    std::cout << std::left << std::setw(22) << "generic dynarray" << std::right << std::fixed
+              << std::setprecision(2) << std::setw(12) << generic_ms << " ms" << std::endl;
+    std::cout << std::left << std::setw(22) << "DEFINE_DYNARRAY" << std::right
+              << std::setw(12) << typed_ms << " ms" << std::endl;
+    std::cout << std::left << std::setw(22) << "Speedup" << std::right
+              << std::setw(12) << generic_ms / typed_ms << " x" << std::endl;
+    std::cout << std::string(70, '=') << std::endl;
+    std::cout << "checksums " << generic_sum << " " << typed_sum << std::endl;
+    return generic_sum != typed_sum;
+}
@@ -0,0 +1,150 @@
+#include <ds/utils/alloc_stats.h>
+#include <ds/utils/arena.h>
+#include <ds/trees/Btree.h>
+#include <ds/trees/trie.h>
+#include <ds/arrays/dynarray.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+
+/*───────────────────────────────────────────────
+ * Test Statistics & Utilities
+ *───────────────────────────────────────────────*/
+static int tests_passed = 0;
+static int tests_failed = 0;
+
+#define TEST_ASSERT(condition, message) do { \
+    if (condition) { \
+        printf("  ✓ %s\n", message); \
+        tests_passed++; \
+    } else { \
+        printf("  ✗ FAILED: %s\n", message); \
+        tests_failed++; \
+    } \
+} while(0)
+
+#define TEST_SECTION(name) printf("\n=== %s ===\n", name)
+
+static size_t ascii_mapper(unsigned char c) { return (size_t) c; }
+static unsigned char ascii_unmapper(size_t i) { return (unsigned char) i; }
+
+static int int_cmp(const void *key, const void *data)
+{
+    int a = *(const int *) key, b = *(const int *) data;
+    return (a > b) - (a < b);
+}
+
+static int int_init(void *object, void *args)
+{
+    memcpy(object, args, sizeof(int));
+    return 0;
+}
+
+/*───────────────────────────────────────────────
+ * Test Cases
+ *───────────────────────────────────────────────*/
+
+static void test_Btree_footprint(void)
+{
+    TEST_SECTION("B-tree Footprint");
+    enum { ORDER = 5, COUNT = 3000 };
+    struct syspool sp = { Btree_node_sizeof(ORDER) };
+    struct allocator_concept sys_ac = { .allocator = &sp, .alloc = sysalloc, .free = sysfree };
+    struct alloc_stats st;
+    alloc_stats_init(&st, &sys_ac, Btree_node_sizeof(ORDER));
+    struct allocator_concept ac = alloc_stats_concept(&st);
+    struct Btree tree;
+    Btree_init(&tree, ORDER, int_cmp, &ac);
+    int *values = malloc(COUNT * sizeof(int));
+    for (int i = 0; i < COUNT; i++) {
+        values[i] = i;
+        Btree_add(&tree, &values[i]);
+    }
+    TEST_ASSERT(st.counters.live_objects == Btree_node_count(&tree), "Node count matches live allocations");
+    TEST_ASSERT(alloc_stats_live_bytes(&st) == Btree_memory_usage(&tree), "Memory usage matches live bytes");
+    size_t peak = alloc_stats_peak_bytes(&st);
+    for (int i = 0; i < COUNT; i += 3)
+        Btree_remove(&tree, &values[i]);
+    TEST_ASSERT(alloc_stats_live_bytes(&st) == Btree_memory_usage(&tree), "Footprint tracked thru merges");
+    TEST_ASSERT(alloc_stats_live_bytes(&st) < peak && alloc_stats_peak_bytes(&st) == peak, "High-water mark kept");
+    alloc_stats_dump(&st, stdout, "  Btree");
+    Btree_deinit(&tree, NULL);
+    struct alloc_counters c = alloc_stats_get(&st);
+    TEST_ASSERT(c.live_objects == 0 && c.live_bytes == 0 && c.alloc_count == c.free_count, "No node leaked");
+    free(values);
+}
+
+static void test_trie_footprint(void)
+{
+    TEST_SECTION("Trie Footprint");
+    struct syspool sp = { trie_node_sizeof(128) };
+    struct allocator_concept sys_ac = { .allocator = &sp, .alloc = sysalloc, .free = sysfree };
+    struct alloc_stats st;
+    alloc_stats_init(&st, &sys_ac, trie_node_sizeof(128));
+    struct allocator_concept ac = alloc_stats_concept(&st);
+    struct trie tr;
+    trie_init(&tr, &ac, 128, ascii_mapper, ascii_unmapper);
+    int value = 1;
+    char key[16];
+    for (int i = 0; i < 200; i++) {
+        snprintf(key, sizeof(key), "key%d", i);
+        trie_put(&tr, key, &value);
+    }
+    TEST_ASSERT(trie_node_count(&tr) == st.counters.live_objects, "Node count matches live allocations");
+    TEST_ASSERT(trie_memory_usage(&tr) == alloc_stats_live_bytes(&st), "Memory usage matches live bytes");
+    trie_deinit(&tr, NULL);
+    TEST_ASSERT(st.counters.live_objects == 0 && trie_memory_usage(&tr) == 0, "No node leaked");
+}
+
+static void test_region_inner(void)
+{
+    TEST_SECTION("Region Inner Allocator");
+    struct arena ar;
+    arena_init(&ar, 64, 0);
+    struct allocator_concept arena_ac = { .allocator = &ar, .alloc = arena_alloc, .free = NULL };
+    struct alloc_stats st;
+    alloc_stats_init(&st, &arena_ac, 64);
+    struct allocator_concept ac = alloc_stats_concept(&st);
+    TEST_ASSERT(ac.free == NULL, "Wrapper keeps the no-op free");
+    for (int i = 0; i < 10; i++)
+        ac.alloc(ac.allocator);
+    TEST_ASSERT(st.counters.live_objects == 10 && st.counters.live_bytes == 640, "Region allocations counted");
+    arena_reset(&ar);
+    alloc_stats_reset(&st);
+    TEST_ASSERT(st.counters.live_bytes == 0 && st.counters.peak_bytes == 0, "Reset zeroes counters");
+    arena_destroy(&ar);
+}
+
+static void test_sized(void)
+{
+    TEST_SECTION("Sized Allocator");
+    struct alloc_stats st;
+    alloc_stats_init_sized(&st, NULL);
+    struct sized_allocator_concept sac = alloc_stats_sized_concept(&st);
+    struct object_concept oc = { .init = int_init, .deinit = NULL };
+    struct dynarray arr;
+    dynarray_init_with(&arr, 2, sizeof(int), oc, &sac);
+    for (int i = 0; i < 1000; i++)
+        dynarray_push_back(&arr, &i);
+    TEST_ASSERT(st.counters.live_objects == 1, "Reallocations keep one live block");
+    TEST_ASSERT(alloc_stats_live_bytes(&st) == dynarray_capacity(&arr) * sizeof(int), "Live bytes follow the capacity");
+    dynarray_deinit(&arr);
+    TEST_ASSERT(st.counters.live_bytes == 0 && st.counters.free_count == 1, "Buffer released");
+}
+
+/*───────────────────────────────────────────────
+ * Main Test Runner
+ *───────────────────────────────────────────────*/
+int main(void)
+{
+    printf("\n=== ALLOCATOR STATISTICS TEST SUITE ===\n");
+
+    test_Btree_footprint();
+    test_trie_footprint();
+    test_region_inner();
+    test_sized();
+
+    printf("\nPassed: %d, Failed: %d\n", tests_passed, tests_failed);
+    return tests_failed > 0 ? 1 : 0;
+}
@@ -0,0 +1,144 @@
+#include <ds/utils/arena.h>
+#include <ds/trees/trie.h>
+#include <ds/trees/Btree.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <assert.h>
+
+/*───────────────────────────────────────────────
+ * Test Statistics & Utilities
+ *───────────────────────────────────────────────*/
+static int tests_passed = 0;
+static int tests_failed = 0;
+
+#define TEST_ASSERT(condition, message) do { \
+    if (condition) { \
+        printf("  ✓ %s\n", message); \
+        tests_passed++; \
+    } else { \
+        printf("  ✗ FAILED: %s\n", message); \
+        tests_failed++; \
+    } \
+} while(0)
+
+#define TEST_SECTION(name) printf("\n=== %s ===\n", name)
+
+static size_t ascii_mapper(unsigned char c) { return (size_t) c; }
+static unsigned char ascii_unmapper(size_t i) { return (unsigned char) i; }
+
+static int int_cmp(const void *key, const void *data)
+{
+    int a = *(const int *) key, b = *(const int *) data;
+    return (a > b) - (a < b);
+}
+
+/*───────────────────────────────────────────────
+ * Test Cases
+ *───────────────────────────────────────────────*/
+
+static void test_alignment(void)
+{
+    TEST_SECTION("Aligned Allocation");
+    struct arena ar;
+    arena_init(&ar, 0, 1024);
+    void *a = arena_alloc_aligned(&ar, 3, 1);
+    void *b = arena_alloc_aligned(&ar, 8, 64);
+    void *c = arena_alloc_aligned(&ar, 5, 8);
+    TEST_ASSERT(a && b && c, "Allocations succeeded");
+    TEST_ASSERT(((uintptr_t) b % 64) == 0, "64 byte alignment honoured");
+    TEST_ASSERT(((uintptr_t) c % 8) == 0, "8 byte alignment honoured");
+    TEST_ASSERT(ar.chunk_count == 1, "Small requests share one chunk");
+    void *big = arena_alloc_aligned(&ar, 4096, 16);
+    TEST_ASSERT(big != NULL && ar.chunk_count == 2, "Oversized request got a dedicated chunk");
+    void *d = arena_alloc_aligned(&ar, 8, 8);
+    TEST_ASSERT(d != NULL && ar.chunk_count == 2, "Regular chunk still used after dedicated one");
+    arena_destroy(&ar);
+    TEST_ASSERT(ar.chunk_count == 0 && ar.chunks == NULL, "Destroy releases every chunk");
+}
+
+static void test_reset(void)
+{
+    TEST_SECTION("Reset");
+    struct arena ar;
+    arena_init(&ar, 32, 4096);
+    for (int i = 0; i < 1000; i++)
+        memset(arena_alloc(&ar), 0xAB, 32);
+    TEST_ASSERT(ar.chunk_count > 1, "Arena grew past one chunk");
+    arena_reset(&ar);
+    TEST_ASSERT(ar.chunk_count == 1, "Reset keeps a single chunk");
+    void *first = arena_alloc(&ar);
+    TEST_ASSERT(first != NULL && ar.chunk_count == 1, "Kept chunk reused after reset");
+    arena_destroy(&ar);
+}
+
+static void test_trie_bulk_teardown(void)
+{
+    TEST_SECTION("Trie Bulk Teardown");
+    struct arena ar;
+    arena_init(&ar, trie_node_sizeof(256), 0);
+    struct allocator_concept ac = { .allocator = &ar, .alloc = arena_alloc, .free = NULL };
+    struct trie tr;
+    int value = 42;
+    for (int batch = 0; batch < 3; batch++) {
+        trie_init(&tr, &ac, 256, ascii_mapper, ascii_unmapper);
+        char key[16];
+        for (int i = 0; i < 500; i++) {
+            snprintf(key, sizeof(key), "k%d", i);
+            trie_put(&tr, key, &value);
+        }
+        TEST_ASSERT(trie_size(&tr) == 500, "Batch inserted");
+        void *out = NULL;
+        TEST_ASSERT(trie_get(&tr, "k123", &out) == TREES_OK && out == &value, "Key found in arena backed trie");
+        trie_deinit(&tr, NULL);
+        TEST_ASSERT(tr.root.child == NULL, "Trie deinitialized without visiting nodes");
+        arena_reset(&ar);
+    }
+    arena_destroy(&ar);
+}
+
+static void test_Btree_bulk_teardown(void)
+{
+    TEST_SECTION("B-tree Bulk Teardown");
+    struct arena ar;
+    arena_init(&ar, Btree_node_sizeof(5), 0);
+    struct allocator_concept ac = { .allocator = &ar, .alloc = arena_alloc, .free = NULL };
+    struct Btree tree;
+    Btree_init(&tree, 5, int_cmp, &ac);
+    enum { COUNT = 2000 };
+    int *values = malloc(COUNT * sizeof(int));
+    for (int i = 0; i < COUNT; i++) {
+        values[i] = i;
+        Btree_add(&tree, &values[i]);
+    }
+    for (int i = 0; i < COUNT; i += 2)
+        Btree_remove(&tree, &values[i]);
+    int ok = 1;
+    for (int i = 0; i < COUNT; i++) {
+        void *found = Btree_search(&tree, &values[i]);
+        if ((i % 2 == 0) != (found == NULL))
+            ok = 0;
+    }
+    TEST_ASSERT(ok, "Removals with no-op free keep the tree valid");
+    Btree_deinit(&tree, NULL);
+    TEST_ASSERT(tree.root == NULL, "B-tree deinitialized without visiting nodes");
+    arena_destroy(&ar);
+    free(values);
+}
+
+/*───────────────────────────────────────────────
+ * Main Test Runner
+ *───────────────────────────────────────────────*/
+int main(void)
+{
+    printf("\n=== ARENA TEST SUITE ===\n");
+
+    test_alignment();
+    test_reset();
+    test_trie_bulk_teardown();
+    test_Btree_bulk_teardown();
+
+    printf("\nPassed: %d, Failed: %d\n", tests_passed, tests_failed);
+    return tests_failed > 0 ? 1 : 0;
+}
@@ -0,0 +1,165 @@
+#include <ds/arrays/array_kernels.h>
+#include <ds/arrays/dynarray.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <assert.h>
+
+/*───────────────────────────────────────────────
+ * Test Statistics & Utilities
+ *───────────────────────────────────────────────*/
+static int tests_passed = 0;
+static int tests_failed = 0;
+
+#define TEST_ASSERT(condition, message) do { \
+    if (condition) { \
+        printf("  ✓ %s\n", message); \
+        tests_passed++; \
+    } else { \
+        printf("  ✗ FAILED: %s\n", message); \
+        tests_failed++; \
+    } \
+} while(0)
+
+#define TEST_SECTION(name) printf("\n=== %s ===\n", name)
+
+// Long enough for every vector width plus a ragged tail
+#define COUNT 1021
+
+static const size_t type_sizes[ARRAY_TYPE_COUNT] = { 1, 1, 2, 2, 4, 4, 8, 8, 4, 8 };
+
+// Small values so that equal elements and extremes repeat in every lane
+static void fill(void *buffer, enum array_type type, size_t count)
+{
+    for (size_t i = 0; i < count; i++) {
+        int v = rand() % 200 - 100;
+        switch (type) {
+            case ARRAY_I8: ((int8_t *) buffer)[i] = (int8_t) v; break;
+            case ARRAY_U8: ((uint8_t *) buffer)[i] = (uint8_t) (v + 100); break;
+            case ARRAY_I16: ((int16_t *) buffer)[i] = (int16_t) (v * 300); break;
+            case ARRAY_U16: ((uint16_t *) buffer)[i] = (uint16_t) ((v + 100) * 300); break;
+            case ARRAY_I32: ((int32_t *) buffer)[i] = v * 100000; break;
+            case ARRAY_U32: ((uint32_t *) buffer)[i] = (uint32_t) (v + 100) * 20000000u; break;
+            case ARRAY_I64: ((int64_t *) buffer)[i] = (int64_t) v * ((int64_t) 1 << 40); break;
+            case ARRAY_U64: ((uint64_t *) buffer)[i] = (uint64_t) (v + 100) << 56; break;
+            case ARRAY_F32: ((float *) buffer)[i] = (float) v * 0.5f; break;
+            case ARRAY_F64: ((double *) buffer)[i] = (double) v * 0.25; break;
+            default: break;
+        }
+    }
+}
+
+struct results {
+    size_t find, count;
+    uint64_t min, max, sum;
+};
+
+static void run(const struct array *arr, enum array_type type, const void *key, struct results *r)
+{
+    memset(r, 0, sizeof(*r));
+    r->find = array_find(arr, type, key);
+    r->count = array_count(arr, type, key);
+    array_min(arr, type, &r->min);
+    array_max(arr, type, &r->max);
+    array_sum(arr, type, &r->sum);
+}
+
+/*───────────────────────────────────────────────
+ * Test Cases
+ *───────────────────────────────────────────────*/
+
+static void test_known_values(void)
+{
+    TEST_SECTION("Known Values");
+    int32_t raw[] = { 5, -3, 9, 5, 12, -7, 5, 0, 1, 2, 3, 4, 5, 6, 7, 8, 100, -100, 42 };
+    struct array view = ARRAY_VIEW(raw);
+    int32_t key = 5, missing = 77, result;
+    TEST_ASSERT(array_find(&view, ARRAY_I32, &key) == 0, "Find returns first index");
+    TEST_ASSERT(array_find(&view, ARRAY_I32, &missing) == array_size(&view), "Find miss returns size");
+    TEST_ASSERT(array_count(&view, ARRAY_I32, &key) == 4, "Count matches");
+    TEST_ASSERT(array_min(&view, ARRAY_I32, &result) == 0 && result == -100, "Min");
+    TEST_ASSERT(array_max(&view, ARRAY_I32, &result) == 0 && result == 100, "Max");
+    int64_t sum;
+    array_sum(&view, ARRAY_I32, &sum);
+    TEST_ASSERT(sum == 104, "Sum");
+    uint8_t bytes[300];
+    memset(bytes, 255, sizeof(bytes));
+    struct array byte_view = ARRAY_VIEW(bytes);
+    uint64_t usum;
+    array_sum(&byte_view, ARRAY_U8, &usum);
+    TEST_ASSERT(usum == 300 * 255, "Narrow sums are widened");
+    struct array empty = { raw, 0, sizeof(int32_t) };
+    TEST_ASSERT(array_min(&empty, ARRAY_I32, &result) != 0, "Min of empty fails");
+    TEST_ASSERT(array_find(&empty, ARRAY_I32, &key) == 0, "Find in empty returns 0");
+}
+
+static void test_dynarray_view(void)
+{
+    TEST_SECTION("Dynarray Views");
+    struct object_concept oc = { NULL, NULL, NULL };
+    struct dynarray arr;
+    dynarray_init(&arr, 16, sizeof(double), oc);
+    for (int i = 0; i < 1000; i++) {
+        double v = (i == 777) ? -1.5 : i;
+        dynarray_push_back(&arr, &v);
+    }
+    double key = -1.5, lowest;
+    TEST_ASSERT(array_find((struct array *) &arr, ARRAY_F64, &key) == 777, "Find over dynarray");
+    TEST_ASSERT(array_min((struct array *) &arr, ARRAY_F64, &lowest) == 0 && lowest == -1.5, "Min over dynarray");
+    dynarray_deinit(&arr);
+}
+
+static void test_isa_agreement(void)
+{
+    TEST_SECTION("Instruction Sets Agree With Scalar");
+    printf("  Selected: %s\n", array_isa_name(array_kernels_isa()));
+    enum array_isa selected = array_kernels_isa();
+    char *buffer = malloc((COUNT + 1) * sizeof(uint64_t));
+    for (enum array_isa isa = ARRAY_ISA_SSE2; isa <= ARRAY_ISA_AVX512; isa++) {
+        if (array_kernels_set_isa(isa) != 0) {
+            printf("  - %s not supported, skipped\n", array_isa_name(isa));
+            continue;
+        }
+        int agree = 1;
+        for (enum array_type type = ARRAY_I8; type < ARRAY_TYPE_COUNT; type++) {
+            // One element offset makes vector loads unaligned, sizes cover the tail paths
+            for (size_t count = 1; count <= COUNT; count += 37) {
+                void *data = buffer + type_sizes[type];
+                fill(data, type, count);
+                struct array view = { data, count, type_sizes[type] };
+                char key[8];
+                memcpy(key, (char *) data + (count / 2) * type_sizes[type], type_sizes[type]);
+                struct results expected, actual;
+                array_kernels_set_isa(ARRAY_ISA_SCALAR);
+                run(&view, type, key, &expected);
+                array_kernels_set_isa(isa);
+                run(&view, type, key, &actual);
+                // Float sums are reassociated, values here are exact in binary
+                agree &= memcmp(&expected, &actual, sizeof(expected)) == 0;
+            }
+        }
+        char message[64];
+        snprintf(message, sizeof(message), "%s matches scalar on every type", array_isa_name(isa));
+        TEST_ASSERT(agree, message);
+    }
+    TEST_ASSERT(array_kernels_set_isa(selected) == 0, "Selected instruction set restored");
+    TEST_ASSERT(array_kernels_set_isa(ARRAY_ISA_SCALAR) == 0 && array_kernels_isa() == ARRAY_ISA_SCALAR, "Scalar always available");
+    array_kernels_set_isa(selected);
+    free(buffer);
+}
+
+/*───────────────────────────────────────────────
+ * Main Test Runner
+ *───────────────────────────────────────────────*/
+int main(void)
+{
+    printf("\n=== ARRAY KERNELS TEST SUITE ===\n");
+
+    test_known_values();
+    test_dynarray_view();
+    test_isa_agreement();
+
+    printf("\nPassed: %d, Failed: %d\n", tests_passed, tests_failed);
+    return tests_failed > 0 ? 1 : 0;
+}
@@ -0,0 +1,134 @@
+#include <ds/arrays/array_parallel.h>
+#include <ds/arrays/array_sort.h>
+#include <ds/arrays/dynarray.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+
+/*───────────────────────────────────────────────
+ * Test Statistics & Utilities
+ *───────────────────────────────────────────────*/
+static int tests_passed = 0;
+static int tests_failed = 0;
+
+#define TEST_ASSERT(condition, message) do { \
+    if (condition) { \
+        printf("  ✓ %s\n", message); \
+        tests_passed++; \
+    } else { \
+        printf("  ✗ FAILED: %s\n", message); \
+        tests_failed++; \
+    } \
+} while(0)
+
+#define TEST_SECTION(name) printf("\n=== %s ===\n", name)
+
+#define COUNT 200000
+
+static int int_cmp(const void *a, const void *b)
+{
+    int x = *(const int *) a, y = *(const int *) b;
+    return (x > y) - (x < y);
+}
+
+static void square(struct array *range, size_t first, void *context)
+{
+    (void) context;
+    for (size_t i = 0; i < array_size(range); i++) {
+        int *v = array_at(range, i);
+        *v = (int) ((first + i) % 1000) * (int) ((first + i) % 1000);
+    }
+}
+
+static void sum_map(const struct array *range, void *partial, void *context)
+{
+    (void) context;
+    for (size_t i = 0; i < array_size(range); i++)
+        *(long long *) partial += *(int *) array_at(range, i);
+}
+
+static void sum_combine(void *result, const void *partial, void *context)
+{
+    (void) context;
+    *(long long *) result += *(const long long *) partial;
+}
+
+/*───────────────────────────────────────────────
+ * Test Cases
+ *───────────────────────────────────────────────*/
+
+static void test_for_reduce(struct thread_pool *pool, const char *label)
+{
+    TEST_SECTION(label);
+    int *data = malloc(COUNT * sizeof(int));
+    struct array view = { data, COUNT, sizeof(int) };
+    array_parallel_for(pool, &view, 0, NULL, square);
+    int ok = 1;
+    long long expected = 0;
+    for (size_t i = 0; i < COUNT; i++) {
+        ok &= data[i] == (int) ((i % 1000) * (i % 1000));
+        expected += data[i];
+    }
+    TEST_ASSERT(ok, "For visits every index once");
+    long long sum = 0;
+    TEST_ASSERT(array_parallel_reduce(pool, &view, 1000, &sum, sizeof(sum), NULL, sum_map, sum_combine) == 0, "Reduce succeeds");
+    TEST_ASSERT(sum == expected, "Reduce matches serial sum");
+
+    for (size_t i = 0; i < COUNT; i++)
+        data[i] = rand();
+    TEST_ASSERT(array_parallel_sort(pool, &view, int_cmp) == 0, "Sort succeeds");
+    TEST_ASSERT(array_is_sorted(&view, int_cmp), "Random input sorted");
+    for (size_t i = 0; i < COUNT; i++)
+        data[i] = rand() % 3;
+    array_parallel_sort(pool, &view, int_cmp);
+    TEST_ASSERT(array_is_sorted(&view, int_cmp), "Few distinct values sorted");
+    for (size_t i = 0; i < COUNT; i++)
+        data[i] = COUNT - (int) i;
+    array_parallel_sort(pool, &view, int_cmp);
+    TEST_ASSERT(array_is_sorted(&view, int_cmp) && data[0] == 1 && data[COUNT - 1] == COUNT, "Reversed input sorted");
+    free(data);
+}
+
+static void test_odd_sizes(struct thread_pool *pool)
+{
+    TEST_SECTION("Odd Sizes");
+    int ok = 1;
+    // Sizes around the run boundaries produce odd run counts
+    size_t sizes[] = { 0, 1, 4095, 8193, 3 * 4096 + 7, 5 * 4096 + 1, 77777 };
+    for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+        struct object_concept oc = { NULL, NULL, NULL };
+        struct dynarray arr;
+        dynarray_init(&arr, 1, sizeof(int), oc);
+        for (size_t i = 0; i < sizes[s]; i++) {
+            int v = rand() % 1000;
+            dynarray_push_back(&arr, &v);
+        }
+        long long expected = 0, sum = 0;
+        for (size_t i = 0; i < sizes[s]; i++)
+            expected += *(int *) dynarray_iterator_at(&arr, i);
+        array_parallel_sort(pool, (struct array *) &arr, int_cmp);
+        array_parallel_reduce(pool, (struct array *) &arr, 0, &sum, sizeof(sum), NULL, sum_map, sum_combine);
+        ok &= array_is_sorted((struct array *) &arr, int_cmp) && sum == expected;
+        dynarray_deinit(&arr);
+    }
+    TEST_ASSERT(ok, "Dynarrays of odd sizes sorted and summed");
+}
+
+/*───────────────────────────────────────────────
+ * Main Test Runner
+ *───────────────────────────────────────────────*/
+int main(void)
+{
+    printf("\n=== ARRAY PARALLEL TEST SUITE ===\n");
+
+    struct thread_pool *pool = thread_pool_create(4);
+    assert(pool != NULL);
+    test_for_reduce(pool, "Thread Pool");
+    test_for_reduce(NULL, "Calling Thread Only");
+    test_odd_sizes(pool);
+    thread_pool_destroy(pool);
+
+    printf("\nPassed: %d, Failed: %d\n", tests_passed, tests_failed);
+    return tests_failed > 0 ? 1 : 0;
+}
@@ -0,0 +1,205 @@
+#include <ds/arrays/array_sort.h>
+#include <ds/arrays/dynarray.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <assert.h>
+
+/*───────────────────────────────────────────────
+ * Test Statistics & Utilities
+ *───────────────────────────────────────────────*/
+static int tests_passed = 0;
+static int tests_failed = 0;
+
+#define TEST_ASSERT(condition, message) do { \
+    if (condition) { \
+        printf("  ✓ %s\n", message); \
+        tests_passed++; \
+    } else { \
+        printf("  ✗ FAILED: %s\n", message); \
+        tests_failed++; \
+    } \
+} while(0)
+
+#define TEST_SECTION(name) printf("\n=== %s ===\n", name)
+
+#define COUNT 20000
+
+struct record {
+    char tag;               // Puts the key at a non-zero offset
+    int32_t key;
+    uint32_t seq;
+};
+
+static int int_cmp(const void *a, const void *b)
+{
+    int x = *(const int *) a, y = *(const int *) b;
+    return (x > y) - (x < y);
+}
+
+static int record_cmp(const void *a, const void *b)
+{
+    const struct record *x = a, *y = b;
+    return (x->key > y->key) - (x->key < y->key);
+}
+
+static int double_cmp(const void *a, const void *b)
+{
+    double x = *(const double *) a, y = *(const double *) b;
+    return (x > y) - (x < y);
+}
+
+// Sum and xor survive sorting, so a sorted result with equal ones is a permutation
+static int same_contents(const int *a, const int *b, size_t count)
+{
+    long long sum_a = 0, sum_b = 0;
+    int xor_a = 0, xor_b = 0;
+    for (size_t i = 0; i < count; i++) {
+        sum_a += a[i];
+        sum_b += b[i];
+        xor_a ^= a[i] * 2654435761u;
+        xor_b ^= b[i] * 2654435761u;
+    }
+    return sum_a == sum_b && xor_a == xor_b;
+}
+
+/*───────────────────────────────────────────────
+ * Test Cases
+ *───────────────────────────────────────────────*/
+
+static void test_patterns(void)
+{
+    TEST_SECTION("Comparison Sort Patterns");
+    int *data = malloc(COUNT * sizeof(int));
+    int *copy = malloc(COUNT * sizeof(int));
+    const char *names[] = { "Random", "Sorted", "Reversed", "All equal", "Organ pipe", "Few distinct", "Sawtooth" };
+    for (int pattern = 0; pattern < 7; pattern++) {
+        for (int i = 0; i < COUNT; i++) {
+            switch (pattern) {
+                case 0: data[i] = rand(); break;
+                case 1: data[i] = i; break;
+                case 2: data[i] = COUNT - i; break;
+                case 3: data[i] = 42; break;
+                case 4: data[i] = (i < COUNT / 2) ? i : COUNT - i; break;
+                case 5: data[i] = rand() % 4; break;
+                case 6: data[i] = i % 100; break;
+            }
+        }
+        memcpy(copy, data, COUNT * sizeof(int));
+        struct array view = { data, COUNT, sizeof(int) };
+        array_sort(&view, int_cmp);
+        char message[64];
+        snprintf(message, sizeof(message), "%s input sorted", names[pattern]);
+        TEST_ASSERT(array_is_sorted(&view, int_cmp) && same_contents(data, copy, COUNT), message);
+    }
+    for (size_t n = 0; n < 64; n++) {
+        for (size_t i = 0; i < n; i++)
+            data[i] = rand() % 10;
+        struct array view = { data, n, sizeof(int) };
+        array_sort(&view, int_cmp);
+        if (!array_is_sorted(&view, int_cmp)) {
+            TEST_ASSERT(0, "Small arrays sorted");
+            break;
+        }
+        if (n == 63)
+            TEST_ASSERT(1, "Small arrays sorted");
+    }
+    free(data);
+    free(copy);
+}
+
+static void test_records(void)
+{
+    TEST_SECTION("Records");
+    struct record *records = malloc(COUNT * sizeof(*records));
+    for (uint32_t i = 0; i < COUNT; i++)
+        records[i] = (struct record) { 'r', rand() % 1000 - 500, i };
+    struct array view = { records, COUNT, sizeof(*records) };
+    array_sort(&view, record_cmp);
+    TEST_ASSERT(array_is_sorted(&view, record_cmp), "Comparison sort on records");
+
+    for (uint32_t i = 0; i < COUNT; i++)
+        records[i] = (struct record) { 'r', rand() % 1000 - 500, i };
+    TEST_ASSERT(array_radix_sort(&view, offsetof(struct record, key), ARRAY_I32, 1) == 0, "Stable radix sort succeeds");
+    int stable = array_is_sorted(&view, record_cmp);
+    for (size_t i = 1; i < COUNT; i++) {
+        if (records[i].key == records[i - 1].key)
+            stable &= records[i].seq > records[i - 1].seq;
+    }
+    TEST_ASSERT(stable, "Equal keys keep their order");
+
+    for (uint32_t i = 0; i < COUNT; i++)
+        records[i] = (struct record) { 'r', rand() - RAND_MAX / 2, i };
+    TEST_ASSERT(array_radix_sort(&view, offsetof(struct record, key), ARRAY_I32, 0) == 0, "In place radix sort succeeds");
+    TEST_ASSERT(array_is_sorted(&view, record_cmp), "Negative keys sorted in place");
+    free(records);
+}
+
+static void test_radix_types(void)
+{
+    TEST_SECTION("Radix Key Types");
+    double *values = malloc(COUNT * sizeof(double));
+    for (int stable = 0; stable < 2; stable++) {
+        for (int i = 0; i < COUNT; i++)
+            values[i] = (rand() - RAND_MAX / 2) / 1000.0;
+        values[0] = -0.0;
+        values[1] = 0.0;
+        struct array view = { values, COUNT, sizeof(double) };
+        array_radix_sort(&view, 0, ARRAY_F64, stable);
+        TEST_ASSERT(array_is_sorted(&view, double_cmp), stable ? "Doubles sorted by LSD" : "Doubles sorted by MSD");
+    }
+    uint8_t bytes[1000];
+    for (int i = 0; i < 1000; i++)
+        bytes[i] = (uint8_t) rand();
+    struct array byte_view = ARRAY_VIEW(bytes);
+    array_radix_sort(&byte_view, 0, ARRAY_U8, 0);
+    int sorted = 1;
+    for (int i = 1; i < 1000; i++)
+        sorted &= bytes[i - 1] <= bytes[i];
+    TEST_ASSERT(sorted, "Bytes sorted");
+    int64_t wide[500];
+    for (int i = 0; i < 500; i++)
+        wide[i] = ((int64_t) rand() << 32) * ((i % 2) ? -1 : 1) + i;
+    struct array wide_view = ARRAY_VIEW(wide);
+    array_radix_sort(&wide_view, 0, ARRAY_I64, 1);
+    sorted = 1;
+    for (int i = 1; i < 500; i++)
+        sorted &= wide[i - 1] <= wide[i];
+    TEST_ASSERT(sorted, "64-bit signed keys sorted");
+    free(values);
+}
+
+static void test_dynarray(void)
+{
+    TEST_SECTION("Dynarray");
+    struct object_concept oc = { NULL, NULL, NULL };
+    struct dynarray arr;
+    dynarray_init(&arr, 16, sizeof(int), oc);
+    for (int i = 0; i < 1000; i++) {
+        int v = (i * 7919) % 1000;
+        dynarray_push_back(&arr, &v);
+    }
+    array_sort((struct array *) &arr, int_cmp);
+    int ok = 1;
+    for (int i = 0; i < 1000; i++)
+        ok &= *(int *) dynarray_iterator_at(&arr, i) == i;
+    TEST_ASSERT(ok, "Dynarray sorted thru its array view");
+    dynarray_deinit(&arr);
+}
+
+/*───────────────────────────────────────────────
+ * Main Test Runner
+ *───────────────────────────────────────────────*/
+int main(void)
+{
+    printf("\n=== ARRAY SORT TEST SUITE ===\n");
+
+    test_patterns();
+    test_records();
+    test_radix_types();
+    test_dynarray();
+
+    printf("\nPassed: %d, Failed: %d\n", tests_passed, tests_failed);
+    return tests_failed > 0 ? 1 : 0;
+}
@@ -3,6 +3,8 @@
 #include <assert.h>
 #include <string.h>
 #include <ds/arrays/dynarray.h>
+#include <ds/arrays/typed_dynarray.h>
+#include <ds/utils/arena.h>
 
 /* =========================================================================
  * MOCK OBJECT & CONCEPTS
@@ -277,6 +279,261 @@ void test_set_and_iter() {
     printf("PASS\n");
 }
 
+void test_custom_allocator() {
+    printf("Running test_custom_allocator...\n");
+    struct arena ar;
+    arena_init(&ar, 0, 4096);
+    struct sized_allocator_concept sac = {
+        .allocator = &ar, .alloc = arena_alloc_sized, .realloc = arena_realloc_sized, .free = NULL
+    };
+    struct dynarray arr;
+    assert(dynarray_init_with(&arr, 2, sizeof(struct TestObj), TestObjConcept, &sac) == 0);
+    void *first = dynarray_iterator_begin(&arr);
+    for (int i = 0; i < 100; i++) {
+        struct TestObj v = {i};
+        assert(dynarray_push_back(&arr, &v) == 0);
+    }
+    // Sole allocation of the arena grows in place
+    assert(dynarray_iterator_begin(&arr) == first);
+    assert(ar.chunk_count == 1);
+    struct TestObj check;
+    dynarray_get(&arr, 99, &check);
+    assert(check.value == 99);
+    dynarray_deinit(&arr);
+    assert(g_active_objects == 0);
+    arena_destroy(&ar);
+    printf("PASS\n");
+}
+
+void test_trivial_copy() {
+    printf("Running test_trivial_copy...\n");
+    struct object_concept pod = { .init = NULL, .deinit = NULL };
+    struct dynarray arr;
+    dynarray_init(&arr, 1, sizeof(int), pod);
+    for (int i = 0; i < 1000; i++)
+        assert(dynarray_push_back(&arr, &i) == 0);
+    assert(dynarray_size(&arr) == 1000);
+    for (int i = 0; i < 1000; i++)
+        assert(((int *) dynarray_iterator_begin(&arr))[i] == i);
+
+    // Self-insert whose source straddles the gap: [0..9] insert [3, 7) at 5
+    dynarray_resize(&arr, 10, NULL);
+    int *items = dynarray_iterator_begin(&arr);
+    int expected[] = {0, 1, 2, 3, 4, 3, 4, 5, 6, 5, 6, 7, 8, 9};
+    assert(dynarray_insert(&arr, 5, &items[3], &items[7]) == 0);
+    assert(dynarray_size(&arr) == 14);
+    items = dynarray_iterator_begin(&arr);
+    for (int i = 0; i < 14; i++)
+        assert(items[i] == expected[i]);
+
+    // Self-insert from behind the gap: insert [10, 12) at 2
+    int expected_tail[] = {0, 1, 7, 8, 2, 3};
+    assert(dynarray_insert(&arr, 2, &items[11], &items[13]) == 0);
+    items = dynarray_iterator_begin(&arr);
+    for (int i = 0; i < 6; i++)
+        assert(items[i] == expected_tail[i]);
+
+    int fill = 42;
+    dynarray_clear(&arr);
+    assert(dynarray_resize(&arr, 777, &fill) == 0);
+    items = dynarray_iterator_begin(&arr);
+    for (int i = 0; i < 777; i++)
+        assert(items[i] == 42);
+    int seven = 7;
+    assert(dynarray_set(&arr, 500, &seven) == 0 && items[500] == 7);
+    dynarray_deinit(&arr);
+    printf("PASS\n");
+}
+
+// Points into itself, so only a relocator can move it correctly
+struct SelfRef {
+    int value;
+    struct SelfRef *self;
+};
+
+int self_ref_init(void *self, void *args) {
+    struct SelfRef *s = self;
+    s->value = ((const struct SelfRef *) args)->value;
+    s->self = s;
+    return 0;
+}
+
+void self_ref_move(void *dest, void *src) {
+    struct SelfRef *d = dest;
+    d->value = ((const struct SelfRef *) src)->value;
+    d->self = d;
+}
+
+void test_relocation() {
+    printf("Running test_relocation...\n");
+    struct object_concept oc = { .init = self_ref_init, .deinit = NULL, .move = self_ref_move };
+    struct dynarray arr;
+    dynarray_init(&arr, 1, sizeof(struct SelfRef), oc);
+    // Front inserts shift every object, growth relocates them into new buffers
+    for (int i = 0; i < 200; i++) {
+        struct SelfRef v = {i, NULL};
+        assert(dynarray_insert(&arr, 0, &v, &v + 1) == 0);
+    }
+    dynarray_delete(&arr, 10, 50);
+    assert(dynarray_size(&arr) == 160);
+    struct SelfRef *items = dynarray_iterator_begin(&arr);
+    for (size_t i = 0; i < dynarray_size(&arr); i++) {
+        assert(items[i].self == &items[i]);
+        assert(items[i].value == (int) ((i < 10) ? 199 - i : 159 - i));
+    }
+    struct SelfRef last;
+    assert(dynarray_extract_back(&arr, &last) == 0);
+    assert(last.value == 0 && last.self == &last && dynarray_size(&arr) == 159);
+    dynarray_deinit(&arr);
+    printf("PASS\n");
+}
+
+void test_growth_policies() {
+    printf("Running test_growth_policies...\n");
+    struct object_concept pod = { .init = NULL, .deinit = NULL };
+    struct dynarray arr;
+    dynarray_init(&arr, 4, sizeof(int), pod);
+    size_t expected_golden[] = {7, 11, 17, 26};
+    dynarray_set_growth(&arr, dynarray_growth_golden, 0);
+    for (int step = 0; step < 4; step++) {
+        int v = step;
+        while (dynarray_size(&arr) < dynarray_capacity(&arr))
+            dynarray_push_back(&arr, &v);
+        dynarray_push_back(&arr, &v);
+        assert(dynarray_capacity(&arr) == expected_golden[step]);
+    }
+    dynarray_set_growth(&arr, dynarray_growth_chunk, 10);
+    int zero = 0;
+    dynarray_resize(&arr, 26, &zero);
+    dynarray_push_back(&arr, &zero);
+    assert(dynarray_capacity(&arr) == 36);
+    // Insertion beyond a single chunk rounds up to whole chunks
+    int many[25] = {0};
+    dynarray_insert(&arr, 0, many, many + 25);
+    assert(dynarray_capacity(&arr) == 56);
+    dynarray_deinit(&arr);
+
+    // 12 byte objects: 1.5x of 20 objects is 372 bytes, rounded to 512 bytes
+    char obj[12] = {0};
+    dynarray_init(&arr, 20, sizeof(obj), pod);
+    dynarray_set_growth(&arr, dynarray_growth_size_class, 0);
+    dynarray_resize(&arr, 20, obj);
+    dynarray_push_back(&arr, obj);
+    assert(dynarray_capacity(&arr) == 512 / sizeof(obj));
+    dynarray_deinit(&arr);
+    // Above the granule buffers are whole pages: 512 objects are 6144 bytes, rounded to 8192
+    dynarray_init(&arr, 341, sizeof(obj), pod);
+    dynarray_set_growth(&arr, dynarray_growth_size_class, 0);
+    dynarray_resize(&arr, 341, obj);
+    dynarray_push_back(&arr, obj);
+    assert(dynarray_capacity(&arr) == 8192 / sizeof(obj));
+    dynarray_deinit(&arr);
+    printf("PASS\n");
+}
+
+void test_emplace() {
+    printf("Running test_emplace...\n");
+    struct dynarray arr;
+    dynarray_init(&arr, 1, sizeof(struct TestObj), TestObjConcept);
+    for (int i = 0; i < 10; i++) {
+        struct TestObj *slot = dynarray_emplace_back(&arr);
+        assert(slot != NULL);
+        // Constructed in place, init is never called
+        slot->value = i;
+    }
+    assert(g_active_objects == 0);
+    struct TestObj *middle = dynarray_emplace_at(&arr, 5);
+    middle->value = 100;
+    struct TestObj *front = dynarray_emplace_at(&arr, 0);
+    front->value = -1;
+    int expected[] = {-1, 0, 1, 2, 3, 4, 100, 5, 6, 7, 8, 9};
+    assert(dynarray_size(&arr) == 12);
+    for (int i = 0; i < 12; i++)
+        assert(((struct TestObj *) dynarray_iterator_at(&arr, i))->value == expected[i]);
+    // Objects constructed in place are owned by the dynarray, balance the counter
+    g_active_objects += 12;
+    dynarray_deinit(&arr);
+    assert(g_active_objects == 0);
+    printf("PASS\n");
+}
+
+void test_small_buffer() {
+    printf("Running test_small_buffer...\n");
+    DYNARRAY_SBO(struct TestObj, 8) scratch;
+    assert(dynarray_sbo_init(&scratch, TestObjConcept) == 0);
+    assert(dynarray_capacity(&scratch.arr) == 8);
+    for (int i = 0; i < 8; i++) {
+        struct TestObj v = {i};
+        dynarray_push_back(&scratch.arr, &v);
+    }
+    assert(dynarray_is_inline(&scratch.arr, &scratch.sbo));
+    assert(dynarray_iterator_begin(&scratch.arr) == (void *) scratch.storage);
+    // Ninth object spills onto the heap
+    struct TestObj v = {8};
+    dynarray_push_back(&scratch.arr, &v);
+    assert(!dynarray_is_inline(&scratch.arr, &scratch.sbo));
+    for (int i = 0; i < 9; i++)
+        assert(((struct TestObj *) dynarray_iterator_at(&scratch.arr, i))->value == i);
+    // Shrinking back fits the inline buffer again
+    dynarray_delete(&scratch.arr, 2, 6);
+    dynarray_shrink_to_fit(&scratch.arr);
+    assert(dynarray_is_inline(&scratch.arr, &scratch.sbo));
+    int expected[] = {0, 1, 6, 7, 8};
+    for (int i = 0; i < 5; i++)
+        assert(((struct TestObj *) dynarray_iterator_at(&scratch.arr, i))->value == expected[i]);
+    dynarray_deinit(&scratch.arr);
+    assert(g_active_objects == 0);
+
+    // Relocator path spills thru allocate, move, free
+    DYNARRAY_SBO(struct SelfRef, 4) refs;
+    struct object_concept oc = { .init = self_ref_init, .deinit = NULL, .move = self_ref_move };
+    dynarray_sbo_init(&refs, oc);
+    for (int i = 0; i < 10; i++) {
+        struct SelfRef r = {i, NULL};
+        dynarray_push_back(&refs.arr, &r);
+    }
+    struct SelfRef *items = dynarray_iterator_begin(&refs.arr);
+    for (int i = 0; i < 10; i++)
+        assert(items[i].self == &items[i] && items[i].value == i);
+    dynarray_deinit(&refs.arr);
+    printf("PASS\n");
+}
+
+DEFINE_DYNARRAY(intvec, int)
+
+void test_typed() {
+    printf("Running test_typed...\n");
+    struct intvec v;
+    assert(intvec_init(&v, 2) == 0);
+    for (int i = 0; i < 100; i++)
+        assert(intvec_push_back(&v, i) == 0);
+    assert(intvec_size(&v) == 100 && intvec_capacity(&v) >= 100);
+    for (int i = 0; i < 100; i++)
+        assert(intvec_get(&v, i) == i);
+    intvec_set(&v, 0, -1);
+    assert(intvec_insert(&v, 1, 500) == 0);
+    assert(*intvec_at(&v, 0) == -1 && *intvec_at(&v, 1) == 500 && *intvec_at(&v, 2) == 1);
+    int extra[] = {7, 8, 9};
+    assert(intvec_insert_range(&v, intvec_size(&v), extra, 3) == 0);
+    assert(intvec_pop_back(&v) == 9 && intvec_size(&v) == 103);
+    intvec_erase(&v, 0, 2);
+    long sum = 0;
+    for (int *it = intvec_begin(&v); it != intvec_end(&v); it++)
+        sum += *it;
+    assert(sum == 4950 + 7 + 8);
+    // Typed and generic views share the same storage
+    struct dynarray *base = intvec_base(&v);
+    assert(dynarray_size(base) == intvec_size(&v));
+    assert(dynarray_iterator_at(base, 5) == (void *) intvec_at(&v, 5));
+    int value = 1234;
+    dynarray_push_back(base, &value);
+    assert(intvec_get(&v, intvec_size(&v) - 1) == 1234);
+    intvec_clear(&v);
+    assert(intvec_size(&v) == 0);
+    intvec_deinit(&v);
+    printf("PASS\n");
+}
+
 int main() {
     printf("=== DYNARRAY TEST SUITE ===\n");
     
@@ -286,6 +543,13 @@ int main() {
     test_self_insertion();
     test_resize_clear();
     test_set_and_iter();
+    test_custom_allocator();
+    test_trivial_copy();
+    test_relocation();
+    test_growth_policies();
+    test_emplace();
+    test_small_buffer();
+    test_typed();
 
     printf("\nAll tests passed successfully.\n");
     return 0;
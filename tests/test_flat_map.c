@@ -0,0 +1,192 @@
+#include <ds/arrays/flat_map.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+
+/*───────────────────────────────────────────────
+ * Test Statistics & Utilities
+ *───────────────────────────────────────────────*/
+static int tests_passed = 0;
+static int tests_failed = 0;
+
+#define TEST_ASSERT(condition, message) do { \
+    if (condition) { \
+        printf("  ✓ %s\n", message); \
+        tests_passed++; \
+    } else { \
+        printf("  ✗ FAILED: %s\n", message); \
+        tests_failed++; \
+    } \
+} while(0)
+
+#define TEST_SECTION(name) printf("\n=== %s ===\n", name)
+
+#define COUNT 5000
+
+struct entry {
+    int key;
+    int value;
+};
+
+static int int_cmp(const void *a, const void *b)
+{
+    int x = *(const int *) a, y = *(const int *) b;
+    return (x > y) - (x < y);
+}
+
+// Keys are even numbers in [0, 2 * COUNT), each one twice, shuffled
+static void make_entries(struct entry *entries)
+{
+    for (int i = 0; i < 2 * COUNT; i++)
+        entries[i] = (struct entry) { 2 * (i % COUNT), i };
+    for (int i = 2 * COUNT - 1; i > 0; i--) {
+        int j = rand() % (i + 1);
+        struct entry t = entries[i];
+        entries[i] = entries[j];
+        entries[j] = t;
+    }
+}
+
+// Checks every query against the known key set, odd keys are absent
+static int check_queries(struct flat_map *fm)
+{
+    int ok = 1;
+    for (int k = -1; k <= 2 * COUNT; k++) {
+        struct entry *e = flat_map_find(fm, &k);
+        size_t lower = flat_map_lower_bound(fm, &k), upper = flat_map_upper_bound(fm, &k);
+        size_t expected_lower = (k < 0) ? 0 : (size_t) (k + 1) / 2;
+        if (k % 2 == 0 && k >= 0 && k < 2 * COUNT) {
+            ok &= e != NULL && e->key == k && e->value % COUNT == k / 2;
+            ok &= lower == expected_lower && upper == expected_lower + 1;
+        } else {
+            ok &= e == NULL && lower == expected_lower && upper == expected_lower;
+        }
+    }
+    return ok;
+}
+
+/*───────────────────────────────────────────────
+ * Tests
+ *───────────────────────────────────────────────*/
+static void test_build(void)
+{
+    TEST_SECTION("Build");
+    struct entry *entries = malloc(2 * COUNT * sizeof(struct entry));
+    make_entries(entries);
+    struct flat_map fm;
+    flat_map_init(&fm, sizeof(struct entry), sizeof(int), int_cmp);
+    TEST_ASSERT(flat_map_build(&fm, entries, 2 * COUNT) == 0, "Built from shuffled entries");
+    TEST_ASSERT(flat_map_size(&fm) == COUNT, "Duplicate keys dropped");
+    int ok = 1;
+    for (size_t i = 0; i < COUNT; i++)
+        ok &= ((struct entry *) flat_map_at(&fm, i))->key == 2 * (int) i;
+    TEST_ASSERT(ok, "Entries in key order");
+    TEST_ASSERT(check_queries(&fm), "Find and bounds in sorted layout");
+    TEST_ASSERT(flat_map_set_layout(&fm, FLAT_MAP_EYTZINGER) == 0, "Switched to Eytzinger layout");
+    TEST_ASSERT(check_queries(&fm), "Find and bounds in Eytzinger layout");
+    TEST_ASSERT(flat_map_build(&fm, NULL, 0) == 0 && flat_map_empty(&fm), "Built empty");
+    int k = 4;
+    TEST_ASSERT(flat_map_find(&fm, &k) == NULL && flat_map_lower_bound(&fm, &k) == 0, "Empty lookups");
+    flat_map_deinit(&fm);
+    free(entries);
+}
+
+static void test_range(void)
+{
+    TEST_SECTION("Range");
+    struct entry *entries = malloc(2 * COUNT * sizeof(struct entry));
+    make_entries(entries);
+    struct flat_map fm;
+    flat_map_init(&fm, sizeof(struct entry), sizeof(int), int_cmp);
+    flat_map_build(&fm, entries, 2 * COUNT);
+    for (int layout = FLAT_MAP_SORTED; layout <= FLAT_MAP_EYTZINGER; layout++) {
+        flat_map_set_layout(&fm, layout);
+        int low = 11, high = 20;
+        struct array view = flat_map_range(&fm, &low, &high);
+        int ok = array_size(&view) == 4;
+        for (size_t i = 0; i < array_size(&view); i++)
+            ok &= ((struct entry *) array_iterator_at(&view, i))->key == 12 + 2 * (int) i;
+        TEST_ASSERT(ok, "Range [11, 20) holds 12 thru 18");
+        low = 20;
+        high = 10;
+        view = flat_map_range(&fm, &low, &high);
+        TEST_ASSERT(array_size(&view) == 0 && view.buffer != NULL, "Inverted range is empty");
+        low = 2 * COUNT;
+        high = 3 * COUNT;
+        view = flat_map_range(&fm, &low, &high);
+        TEST_ASSERT(array_size(&view) == 0, "Range past the end is empty");
+    }
+    flat_map_deinit(&fm);
+    free(entries);
+}
+
+static void test_modify(void)
+{
+    TEST_SECTION("Insert & Erase");
+    for (int layout = FLAT_MAP_SORTED; layout <= FLAT_MAP_EYTZINGER; layout++) {
+        struct flat_map fm;
+        flat_map_init(&fm, sizeof(struct entry), sizeof(int), int_cmp);
+        flat_map_set_layout(&fm, layout);
+        // Inserts in a scattered order so entries land in the middle
+        for (int i = 0; i < COUNT; i++) {
+            struct entry e = { 2 * ((i * 7919) % COUNT), (i * 7919) % COUNT };
+            flat_map_insert(&fm, &e);
+        }
+        TEST_ASSERT(flat_map_size(&fm) == COUNT && check_queries(&fm), "Inserted one by one");
+        struct entry e = { 10, -1 };
+        flat_map_insert(&fm, &e);
+        struct entry *found = flat_map_find(&fm, &e.key);
+        TEST_ASSERT(flat_map_size(&fm) == COUNT && found && found->value == -1, "Insert replaced value");
+        int ok = 1;
+        for (int k = 0; k < 2 * COUNT; k += 4)
+            ok &= flat_map_erase(&fm, &k) == 0;
+        TEST_ASSERT(ok && flat_map_size(&fm) == COUNT / 2, "Erased every other key");
+        ok = 1;
+        for (int k = 0; k < 2 * COUNT; k += 2) {
+            int present = flat_map_find(&fm, &k) != NULL;
+            ok &= present == (k % 4 != 0);
+        }
+        TEST_ASSERT(ok, "Only erased keys are gone");
+        int k = 4;
+        TEST_ASSERT(flat_map_erase(&fm, &k) != 0, "Erasing a missing key fails");
+        flat_map_clear(&fm);
+        TEST_ASSERT(flat_map_empty(&fm) && flat_map_find(&fm, &k) == NULL, "Cleared");
+        flat_map_deinit(&fm);
+    }
+}
+
+static void test_set(void)
+{
+    TEST_SECTION("Flat Set");
+    struct flat_map fs;
+    flat_map_init(&fs, sizeof(int), sizeof(int), int_cmp);
+    flat_map_set_layout(&fs, FLAT_MAP_EYTZINGER);
+    int keys[] = { 9, 3, 7, 3, 1, 9, 5 };
+    flat_map_build(&fs, keys, sizeof(keys) / sizeof(keys[0]));
+    struct array all = flat_map_entries(&fs);
+    int ok = array_size(&all) == 5;
+    for (size_t i = 0; i < array_size(&all); i++)
+        ok &= *(int *) array_iterator_at(&all, i) == 2 * (int) i + 1;
+    TEST_ASSERT(ok, "Set holds 1, 3, 5, 7, 9");
+    int k = 6;
+    TEST_ASSERT(flat_map_lower_bound(&fs, &k) == 3 && flat_map_upper_bound(&fs, &k) == 3, "Bounds of a missing key");
+    flat_map_deinit(&fs);
+}
+
+/*───────────────────────────────────────────────
+ * Main Test Runner
+ *───────────────────────────────────────────────*/
+int main(void)
+{
+    printf("\n=== FLAT MAP TEST SUITE ===\n");
+
+    srand(42);
+    test_build();
+    test_range();
+    test_modify();
+    test_set();
+
+    printf("\nPassed: %d, Failed: %d\n", tests_passed, tests_failed);
+    return tests_failed > 0 ? 1 : 0;
+}
@@ -4,6 +4,7 @@
 #include <string.h>
 #include <assert.h>
 #include <stdbool.h>
+#include <stdint.h>
 
 /*───────────────────────────────────────────────
  * Test Statistics & Utilities
@@ -443,6 +444,355 @@ static void test_integer_keys(void)
     hash_table_destroy(ht, NULL);
 }
 
+/* Test 11: Custom Bucket Allocator */
+static size_t live_bytes = 0;
+
+static void *counting_alloc(void* allocator, size_t size, size_t align)
+{
+    (void)allocator;
+    live_bytes += size;
+    return sysalloc_sized(NULL, size, align);
+}
+
+static void counting_free(void* allocator, void* ptr, size_t size)
+{
+    (void)allocator;
+    live_bytes -= size;
+    sysfree_sized(NULL, ptr, size);
+}
+
+static void test_custom_allocator(void)
+{
+    TEST_SECTION("Test 11: Custom Bucket Allocator");
+    
+    struct hash_concept hc = { .hash = int_hash, .cmp_key = int_cmp };
+    struct sized_allocator_concept sac = { .allocator = NULL, .alloc = counting_alloc, .realloc = NULL, .free = counting_free };
+    struct hash_table* ht = hash_table_create_with(&hc, &sac);
+    TEST_ASSERT(ht != NULL && live_bytes > 0, "Buckets allocated thru the given allocator");
+    
+    const int COUNT = 500;
+    int* keys = malloc(COUNT * sizeof(int));
+    for (int i = 0; i < COUNT; i++) {
+        keys[i] = i;
+        hash_table_insert(ht, &keys[i], &keys[i]);
+    }
+    for (int i = 0; i < COUNT; i += 2)
+        hash_table_remove(ht, &keys[i]);
+    TEST_ASSERT(hash_table_size(ht) == (size_t) COUNT / 2, "Table resized thru the given allocator");
+    
+    int search_key = 301;
+    TEST_ASSERT(hash_table_search(ht, &search_key) == &keys[301], "Key found after resizes");
+    
+    hash_table_destroy(ht, NULL);
+    TEST_ASSERT(live_bytes == 0, "Every bucket array released");
+    free(keys);
+}
+
+/* Test 12: Single Hash Probing */
+static void check_probing(enum hash_table_probing probing, const char* name)
+{
+    struct hash_concept hc = { .cmp_key = string_cmp, .hash64 = hash64_string };
+    struct hash_table_config config = { .probing = probing };
+    struct hash_table* ht = hash_table_create_config(&hc, NULL, &config);
+    TEST_ASSERT(ht != NULL, name);
+    size_t capacity = hash_table_capacity(ht);
+    TEST_ASSERT((capacity & (capacity - 1)) == 0, "Capacity is a power of two");
+    
+    const int COUNT = 2000;
+    // Keys are kept to free the removed ones below
+    char** keys = malloc(COUNT * sizeof(char*));
+    for (int i = 0; i < COUNT; i++) {
+        keys[i] = create_key("probe", i);
+        hash_table_insert(ht, keys[i], create_value(i));
+    }
+    capacity = hash_table_capacity(ht);
+    TEST_ASSERT(hash_table_size(ht) == COUNT, "All keys inserted");
+    TEST_ASSERT((capacity & (capacity - 1)) == 0, "Capacity stays a power of two after growth");
+    
+    bool all_found = true;
+    for (int i = 0; i < COUNT; i++) {
+        char keybuf[64];
+        snprintf(keybuf, 64, "probe%d", i);
+        int* val = hash_table_search(ht, keybuf);
+        if (!val || *val != i)
+            all_found = false;
+    }
+    TEST_ASSERT(all_found, "All keys found");
+    
+    for (int i = 0; i < COUNT; i++) {
+        if (i % 10 == 0)
+            continue;
+        char keybuf[64];
+        snprintf(keybuf, 64, "probe%d", i);
+        free(hash_table_search(ht, keybuf));
+        hash_table_remove(ht, keybuf);
+        free(keys[i]);
+    }
+    TEST_ASSERT(hash_table_size(ht) == COUNT / 10, "Keys removed while shrinking");
+    TEST_ASSERT(hash_table_search(ht, "probe1990") != NULL && hash_table_search(ht, "probe1991") == NULL,
+                "Kept keys found, removed ones not");
+    
+    // Kept pairs are freed with the table
+    struct object_concept oc = { .init = NULL, .deinit = free };
+    hash_table_destroy(ht, &oc);
+    free(keys);
+}
+
+static void test_single_hash_probing(void)
+{
+    TEST_SECTION("Test 12: Single Hash Probing");
+    
+    check_probing(HASH_TABLE_PROBE_LINEAR, "Linear probing table created");
+    check_probing(HASH_TABLE_PROBE_QUADRATIC, "Quadratic probing table created");
+    
+    struct hash_concept no_hash64 = { .hash = double_hash, .cmp_key = string_cmp };
+    struct hash_table_config config = { .probing = HASH_TABLE_PROBE_LINEAR };
+    TEST_ASSERT(hash_table_create_config(&no_hash64, NULL, &config) == NULL, "Probing without hash64 rejected");
+    
+    struct hash_concept hc = { .cmp_key = int_cmp, .hash64 = hash64_u32 };
+    config.probing = HASH_TABLE_PROBE_QUADRATIC;
+    struct hash_table* ht = hash_table_create_config(&hc, NULL, &config);
+    int keys[300];
+    for (int i = 0; i < 300; i++) {
+        keys[i] = i * 64;   // same low bits, hash64 must spread them
+        hash_table_insert(ht, &keys[i], &keys[i]);
+    }
+    int search_key = 128 * 64;
+    TEST_ASSERT(hash_table_search(ht, &search_key) == &keys[128], "Integer keys with equal low bits found");
+    hash_table_destroy(ht, NULL);
+}
+
+/* Test 13: Robin Hood Hashing */
+static int u64_cmp(const void* a, const void* b)
+{
+    return *(const uint64_t*) a != *(const uint64_t*) b;
+}
+
+// Inserts and removes random keys, returns 1 if the table matches a presence array
+static int churn(struct hash_table* ht, uint64_t* keys, bool* present, size_t count, int rounds)
+{
+    size_t live = 0;
+    for (size_t i = 0; i < count; i++)
+        live += present[i];
+    for (int r = 0; r < rounds; r++) {
+        size_t i = (size_t) rand() % count;
+        if (present[i]) {
+            hash_table_remove(ht, &keys[i]);
+            live--;
+        } else {
+            hash_table_insert(ht, &keys[i], &keys[i]);
+            live++;
+        }
+        present[i] = !present[i];
+    }
+    int ok = (hash_table_size(ht) == live);
+    for (size_t i = 0; i < count; i++)
+        ok &= (hash_table_search(ht, &keys[i]) == (present[i] ? &keys[i] : NULL));
+    return ok;
+}
+
+static void test_robin_hood(void)
+{
+    TEST_SECTION("Test 13: Robin Hood Hashing");
+    
+    struct hash_concept hc = { .cmp_key = u64_cmp, .hash64 = hash64_u64 };
+    struct hash_table_config config = { .probing = HASH_TABLE_PROBE_ROBIN_HOOD };
+    struct hash_table* ht = hash_table_create_config(&hc, NULL, &config);
+    TEST_ASSERT(ht != NULL, "Robin Hood table created");
+    
+    const size_t COUNT = 5000;
+    uint64_t* keys = malloc(COUNT * sizeof(*keys));
+    bool* present = calloc(COUNT, sizeof(*present));
+    for (size_t i = 0; i < COUNT; i++)
+        keys[i] = i * 0x1000;
+    srand(11);
+    TEST_ASSERT(churn(ht, keys, present, COUNT, 100000), "Table matches the reference after churn");
+    
+    struct hash_table_probe_stats ps;
+    hash_table_get_probe_stats(ht, &ps);
+    printf("  Info: size=%zu capacity=%zu max probe=%zu mean probe=%.2f\n",
+           hash_table_size(ht), hash_table_capacity(ht), ps.max, ps.mean);
+    TEST_ASSERT(ps.mean < 2.0 && ps.max < 32, "Probe lengths stay short without tombstones");
+    
+    for (size_t i = 0; i < COUNT; i++) {
+        if (present[i])
+            hash_table_remove(ht, &keys[i]);
+    }
+    hash_table_get_probe_stats(ht, &ps);
+    TEST_ASSERT(hash_table_size(ht) == 0 && ps.max == 0 && ps.mean == 0.0, "Empty table has no probes");
+    hash_table_destroy(ht, NULL);
+    
+    // Stats replay probes in the other modes
+    struct hash_concept hc_concept = { .hash = int_hash, .cmp_key = int_cmp };
+    ht = hash_table_create(&hc_concept);
+    int ints[100];
+    for (int i = 0; i < 100; i++) {
+        ints[i] = i;
+        hash_table_insert(ht, &ints[i], &ints[i]);
+    }
+    hash_table_get_probe_stats(ht, &ps);
+    TEST_ASSERT(ps.mean >= 0.0 && ps.mean <= (double) ps.max, "Probe stats of a double hashing table");
+    hash_table_destroy(ht, NULL);
+    
+    free(present);
+    free(keys);
+}
+
+/* Test 14: Stored Hashes */
+static size_t hash_calls = 0;
+static size_t cmp_calls = 0;
+
+static uint64_t counting_hash64(const void* key)
+{
+    hash_calls++;
+    return hash64_string(key);
+}
+
+static int counting_cmp(const void* a, const void* b)
+{
+    cmp_calls++;
+    return strcmp((const char*) a, (const char*) b);
+}
+
+static void check_stored_hash(enum hash_table_probing probing, const char* name)
+{
+    struct hash_concept hc = { .cmp_key = counting_cmp, .hash64 = counting_hash64 };
+    struct hash_table_config config = { .probing = probing, .store_hash = 1 };
+    struct hash_table* ht = hash_table_create_config(&hc, NULL, &config);
+    
+    const int COUNT = 3000;
+    char (*keys)[16] = malloc(COUNT * sizeof(*keys));
+    hash_calls = cmp_calls = 0;
+    for (int i = 0; i < COUNT; i++) {
+        snprintf(keys[i], 16, "stored%d", i);
+        hash_table_insert(ht, keys[i], keys[i]);
+    }
+    bool ok = (hash_calls == (size_t) COUNT && cmp_calls == 0);
+    
+    // Misses only compare keys whose 64-bit hash collides
+    cmp_calls = 0;
+    for (int i = 0; i < COUNT; i++) {
+        char miss[16];
+        snprintf(miss, 16, "missing%d", i);
+        ok &= (hash_table_search(ht, miss) == NULL);
+    }
+    ok &= (cmp_calls == 0);
+    
+    for (int i = 0; i < COUNT; i++)
+        ok &= (hash_table_search(ht, keys[i]) == keys[i]);
+    hash_calls = 0;
+    for (int i = 0; i < COUNT; i += 2)
+        hash_table_remove(ht, keys[i]);
+    ok &= (hash_calls == (size_t) COUNT / 2);
+    for (int i = 0; i < COUNT; i++)
+        ok &= (hash_table_search(ht, keys[i]) == ((i % 2) ? keys[i] : NULL));
+    TEST_ASSERT(ok, name);
+    
+    hash_table_destroy(ht, NULL);
+    free(keys);
+}
+
+static void test_stored_hash(void)
+{
+    TEST_SECTION("Test 14: Stored Hashes");
+    
+    check_stored_hash(HASH_TABLE_PROBE_LINEAR, "Linear: one hash per call, resizes reuse stored hashes, misses skip cmp_key");
+    check_stored_hash(HASH_TABLE_PROBE_QUADRATIC, "Quadratic: one hash per call, resizes reuse stored hashes, misses skip cmp_key");
+    check_stored_hash(HASH_TABLE_PROBE_ROBIN_HOOD, "Robin Hood: one hash per call, resizes reuse stored hashes, misses skip cmp_key");
+    
+    struct hash_concept hc = { .hash = double_hash, .cmp_key = string_cmp };
+    struct hash_table_config config = { .store_hash = 1 };
+    TEST_ASSERT(hash_table_create_config(&hc, NULL, &config) == NULL, "store_hash without hash64 probing rejected");
+}
+
+/* Test 15: Incremental Resizing */
+static size_t u64_double_hash(const void* key, size_t capacity, size_t attempts)
+{
+    uint64_t h = hash64_u64(key);
+    return (size_t) ((h % capacity + attempts * (1 + (h >> 32) % (capacity - 1))) % capacity);
+}
+
+static size_t pairs_walked = 0;
+
+static void count_walk(void* key, void* value, void* context)
+{
+    (void) key;
+    (void) value;
+    (void) context;
+    pairs_walked++;
+}
+
+static void check_incremental(enum hash_table_probing probing, int store_hash, const char* name)
+{
+    struct hash_concept hc = { .hash = u64_double_hash, .cmp_key = u64_cmp, .hash64 = hash64_u64 };
+    struct hash_table_config config = { .probing = probing, .store_hash = store_hash, .incremental = 1 };
+    struct hash_table* ht = hash_table_create_config(&hc, NULL, &config);
+    
+    const size_t COUNT = 4000;
+    uint64_t* keys = malloc(COUNT * sizeof(*keys));
+    bool* present = calloc(COUNT, sizeof(*present));
+    for (size_t i = 0; i < COUNT; i++)
+        keys[i] = i * 0x1000;
+    
+    // Every step is checked, so lookups run while arrays are being drained
+    bool ok = true;
+    size_t capacity = hash_table_capacity(ht);
+    for (size_t i = 0; i < COUNT; i++) {
+        hash_table_insert(ht, &keys[i], &keys[i]);
+        present[i] = true;
+        ok &= (hash_table_search(ht, &keys[i / 2]) == &keys[i / 2]);
+        pairs_walked = 0;
+        if (hash_table_capacity(ht) != capacity) {
+            hash_table_walk(ht, NULL, count_walk);
+            ok &= (pairs_walked == hash_table_size(ht));
+            capacity = hash_table_capacity(ht);
+        }
+    }
+    ok &= (hash_table_size(ht) == COUNT);
+    srand(5);
+    ok &= churn(ht, keys, present, COUNT, 50000);
+    for (size_t i = 0; i < COUNT; i++) {
+        if (present[i])
+            hash_table_remove(ht, &keys[i]);
+        present[i] = false;
+    }
+    ok &= churn(ht, keys, present, COUNT, 5000);
+    TEST_ASSERT(ok, name);
+    
+    hash_table_destroy(ht, NULL);
+    free(present);
+    free(keys);
+}
+
+static void test_incremental(void)
+{
+    TEST_SECTION("Test 15: Incremental Resizing");
+    
+    check_incremental(HASH_TABLE_PROBE_CONCEPT, 0, "Double hashing stays consistent across incremental resizes");
+    check_incremental(HASH_TABLE_PROBE_LINEAR, 0, "Linear probing stays consistent across incremental resizes");
+    check_incremental(HASH_TABLE_PROBE_QUADRATIC, 1, "Quadratic probing with stored hashes stays consistent");
+    
+    struct hash_concept hc = { .cmp_key = u64_cmp, .hash64 = hash64_u64 };
+    struct hash_table_config config = { .probing = HASH_TABLE_PROBE_ROBIN_HOOD, .incremental = 1 };
+    TEST_ASSERT(hash_table_create_config(&hc, NULL, &config) == NULL, "Robin Hood with incremental resize rejected");
+    
+    // Pairs of an array being drained are released by destroy
+    struct hash_concept hc_str = { .cmp_key = string_cmp, .hash64 = hash64_string };
+    config.probing = HASH_TABLE_PROBE_LINEAR;
+    struct hash_table* ht = hash_table_create_config(&hc_str, NULL, &config);
+    // The 46th pair starts the resize, the new array is zeroed over two calls before pairs move
+    for (int i = 0; i < 46; i++)
+        hash_table_insert(ht, create_key("drain", i), create_value(i));
+    TEST_ASSERT(hash_table_capacity(ht) == 64 && hash_table_search(ht, "drain45") != NULL,
+                "Old array serves while the new one is zeroed");
+    hash_table_search(ht, "drain0");
+    pairs_walked = 0;
+    hash_table_walk(ht, NULL, count_walk);
+    TEST_ASSERT(hash_table_capacity(ht) == 128 && pairs_walked == 46, "Walk covers both arrays mid resize");
+    struct object_concept oc = { .init = NULL, .deinit = free };
+    hash_table_destroy(ht, &oc);
+}
+
 /*───────────────────────────────────────────────
  * Main Test Runner
  *───────────────────────────────────────────────*/
@@ -464,6 +814,11 @@ int main(void)
     test_large_dataset();
     test_collisions();
     test_integer_keys();
+    test_custom_allocator();
+    test_single_hash_probing();
+    test_robin_hood();
+    test_stored_hash();
+    test_incremental();
     
     // Print summary
     printf("\n");
@@ -135,6 +135,65 @@ void test_resizing_stress() {
     printf("PASSED\n");
 }
 
+// Points into itself, so only a relocator can move it correctly
+typedef struct tracked {
+    int value;
+    struct tracked *self;
+} tracked_t;
+
+static int g_copies = 0;
+
+int copy_tracked(void *dest, void *src)
+{
+    tracked_t *d = dest;
+    d->value = ((const tracked_t *) src)->value;
+    d->self = d;
+    g_copies++;
+    return 0;
+}
+
+void move_tracked(void *dest, void *src)
+{
+    tracked_t *d = dest;
+    d->value = ((const tracked_t *) src)->value;
+    d->self = d;
+}
+
+int compare_tracked(const void* a, const void* b) {
+    return ((const tracked_t *) a)->value - ((const tracked_t *) b)->value;
+}
+
+void check_tracked(void* data, void* userdata) {
+    int *broken = userdata;
+    if (((tracked_t *) data)->self != data)
+        (*broken)++;
+}
+
+void test_relocation() {
+    printf("Test: Relocation instead of copies...\n");
+    struct object_concept tracked_oc = { .init = copy_tracked, .deinit = NULL, .move = move_tracked };
+    struct array_heap h;
+    assert(array_heap_init(&h, sizeof(tracked_t), &tracked_oc, compare_tracked) == 0);
+    const int count = 500;
+    for (int i = 0; i < count; i++) {
+        tracked_t t = { (i * 7919) % count, NULL };
+        assert(array_heap_add(&h, &t) == 0);
+    }
+    // Only the adds copy, sifting and growth relocate
+    assert(g_copies == count);
+    int broken = 0;
+    array_heap_walk(&h, &broken, check_tracked);
+    assert(broken == 0);
+    tracked_t popped;
+    for (int i = count - 1; i >= 0; i--) {
+        assert(array_heap_remove(&h, &popped) == 0);
+        assert(popped.value == i && popped.self == &popped);
+    }
+    assert(g_copies == count);
+    array_heap_deinit(&h);
+    printf("PASSED\n");
+}
+
 /*───────────────────────────────────────────────
  * Main Entry
  *───────────────────────────────────────────────*/
@@ -146,6 +205,7 @@ int main() {
 
     test_lifecycle_and_properties();
     test_resizing_stress();
+    test_relocation();
 
     printf("================================\n");
     printf("All Tests Passed Successfully.\n");
@@ -0,0 +1,173 @@
+// Compile CINFO out of this translation unit to check filtering
+#define DS_LOG_MIN_SEVERITY DS_LOG_SEVERITY_CWARNING
+
+#include <ds/utils/debug.h>
+#include <ds/utils/logger.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <pthread.h>
+#include <assert.h>
+
+/*───────────────────────────────────────────────
+ * Test Statistics & Utilities
+ *───────────────────────────────────────────────*/
+static int tests_passed = 0;
+static int tests_failed = 0;
+
+#define TEST_ASSERT(condition, message) do { \
+    if (condition) { \
+        printf("  ✓ %s\n", message); \
+        tests_passed++; \
+    } else { \
+        printf("  ✗ FAILED: %s\n", message); \
+        tests_failed++; \
+    } \
+} while(0)
+
+#define TEST_SECTION(name) printf("\n=== %s ===\n", name)
+
+#define THREAD_COUNT 4
+#define LOGS_PER_THREAD 500
+
+// Flushes into a fresh temporary file and returns its contents
+static char *flush_to_string(FILE *out)
+{
+    ds_log_flush();
+    long size = ftell(out);
+    char *text = malloc((size_t) size + 1);
+    rewind(out);
+    size_t n = fread(text, 1, (size_t) size, out);
+    text[n] = '\0';
+    return text;
+}
+
+static size_t count_occurrences(const char *text, const char *needle)
+{
+    size_t count = 0;
+    for (const char *p = strstr(text, needle); p; p = strstr(p + 1, needle))
+        count++;
+    return count;
+}
+
+static void *log_worker(void *arg)
+{
+    int id = *(int *) arg;
+    for (int i = 0; i < LOGS_PER_THREAD; i++)
+        LOG(USER_LVL, CWARNING, "worker %d message %d", id, i);
+    return NULL;
+}
+
+/*───────────────────────────────────────────────
+ * Test Cases
+ *───────────────────────────────────────────────*/
+
+static void test_arguments(void)
+{
+    TEST_SECTION("Argument Capture");
+    FILE *out = tmpfile();
+    ds_log_set_output(out);
+    char buffer[16];
+    strcpy(buffer, "hello");
+    size_t count = 42;
+    LOG(USER_LVL, CWARNING, "int=%d uint=%u hex=%#x str=%s dbl=%.2f ch=%c size=%zu", -5, 7u, 255, buffer, 3.14159, 'x', count);
+    // The record must have copied the string already
+    strcpy(buffer, "changed");
+    char *text = flush_to_string(out);
+    TEST_ASSERT(strstr(text, "int=-5 uint=7 hex=0xff str=hello dbl=3.14 ch=x") != NULL, "Arguments formatted at flush");
+    TEST_ASSERT(strstr(text, "fn-test_arguments") != NULL, "Call site recorded");
+    free(text);
+    ds_log_set_output(NULL);
+    fclose(out);
+}
+
+static void test_filtering(void)
+{
+    TEST_SECTION("Compile-time Filtering");
+    FILE *out = tmpfile();
+    ds_log_set_output(out);
+    int evaluated = 0;
+    LOG(USER_LVL, CINFO, "filtered %d", ++evaluated);
+    LOG_IF(1, USER_LVL, CINFO, "filtered too %d", ++evaluated);
+    LOG(USER_LVL, CERROR, "kept");
+    char *text = flush_to_string(out);
+    TEST_ASSERT(evaluated == 0, "Arguments of filtered calls not evaluated");
+    TEST_ASSERT(strstr(text, "filtered") == NULL && strstr(text, "kept") != NULL, "Only severities above minimum recorded");
+    free(text);
+    ds_log_set_output(NULL);
+    fclose(out);
+}
+
+static void test_errno(void)
+{
+    TEST_SECTION("Errno");
+    FILE *out = tmpfile();
+    ds_log_set_output(out);
+    errno = ENOENT;
+    LOG(USER_LVL, CERROR, "open failed");
+    TEST_ASSERT(errno == 0, "errno cleared by LOG");
+    char *text = flush_to_string(out);
+    TEST_ASSERT(strstr(text, strerror(ENOENT)) != NULL, "errno text appended");
+    free(text);
+    ds_log_set_output(NULL);
+    fclose(out);
+}
+
+static void test_threads(void)
+{
+    TEST_SECTION("Background Flush");
+    FILE *out = tmpfile();
+    ds_log_set_output(out);
+    size_t dropped = ds_log_dropped();
+    TEST_ASSERT(ds_log_start(1) == 0, "Flusher started");
+    pthread_t threads[THREAD_COUNT];
+    int ids[THREAD_COUNT];
+    for (int i = 0; i < THREAD_COUNT; i++) {
+        ids[i] = i;
+        pthread_create(&threads[i], NULL, log_worker, &ids[i]);
+    }
+    for (int i = 0; i < THREAD_COUNT; i++)
+        pthread_join(threads[i], NULL);
+    ds_log_stop();
+    char *text = flush_to_string(out);
+    size_t lines = count_occurrences(text, "message");
+    TEST_ASSERT(lines == THREAD_COUNT * LOGS_PER_THREAD && ds_log_dropped() == dropped, "Every record of exited threads written");
+    TEST_ASSERT(strstr(text, "worker 3 message 499") != NULL, "Records of every thread present");
+    free(text);
+    ds_log_set_output(NULL);
+    fclose(out);
+}
+
+static void test_overflow(void)
+{
+    TEST_SECTION("Overflow");
+    FILE *out = tmpfile();
+    ds_log_set_output(out);
+    size_t dropped = ds_log_dropped();
+    for (int i = 0; i < DS_LOG_RING_SIZE + 100; i++)
+        LOG(USER_LVL, CWARNING, "burst %d", i);
+    char *text = flush_to_string(out);
+    TEST_ASSERT(count_occurrences(text, "burst") == DS_LOG_RING_SIZE, "Full ring kept the oldest records");
+    TEST_ASSERT(ds_log_dropped() - dropped == 100, "Dropped records counted");
+    free(text);
+    ds_log_set_output(NULL);
+    fclose(out);
+}
+
+/*───────────────────────────────────────────────
+ * Main Test Runner
+ *───────────────────────────────────────────────*/
+int main(void)
+{
+    printf("\n=== LOGGER TEST SUITE ===\n");
+
+    test_arguments();
+    test_filtering();
+    test_errno();
+    test_threads();
+    test_overflow();
+
+    printf("\nPassed: %d, Failed: %d\n", tests_passed, tests_failed);
+    return tests_failed > 0 ? 1 : 0;
+}
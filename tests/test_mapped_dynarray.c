@@ -0,0 +1,112 @@
+#include <ds/arrays/mapped_dynarray.h>
+#include <ds/arrays/array_kernels.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <unistd.h>
+#include <assert.h>
+
+/*───────────────────────────────────────────────
+ * Test Statistics & Utilities
+ *───────────────────────────────────────────────*/
+static int tests_passed = 0;
+static int tests_failed = 0;
+
+#define TEST_ASSERT(condition, message) do { \
+    if (condition) { \
+        printf("  ✓ %s\n", message); \
+        tests_passed++; \
+    } else { \
+        printf("  ✗ FAILED: %s\n", message); \
+        tests_failed++; \
+    } \
+} while(0)
+
+#define TEST_SECTION(name) printf("\n=== %s ===\n", name)
+
+#define COUNT 100000
+
+static char path[] = "/tmp/test_mapped_dynarray_XXXXXX";
+
+static int check_values(struct mapped_dynarray *md, size_t count)
+{
+    int ok = mapped_dynarray_size(md) == count;
+    for (size_t i = 0; ok && i < count; i++)
+        ok &= *(uint64_t *) dynarray_iterator_at(mapped_dynarray_base(md), i) == i * i;
+    return ok;
+}
+
+/*───────────────────────────────────────────────
+ * Tests
+ *───────────────────────────────────────────────*/
+static void test_persist(void)
+{
+    TEST_SECTION("Persist & Reopen");
+    struct mapped_dynarray md;
+    TEST_ASSERT(mapped_dynarray_open(&md, path, sizeof(uint64_t), 16, 0) == 0, "Opened empty file");
+    TEST_ASSERT(mapped_dynarray_size(&md) == 0, "New file is empty");
+    int ok = 1;
+    for (uint64_t i = 0; i < COUNT; i++) {
+        uint64_t v = i * i;
+        ok &= dynarray_push_back(mapped_dynarray_base(&md), &v) == 0;
+    }
+    TEST_ASSERT(ok && check_values(&md, COUNT), "Pushed past many remaps");
+    TEST_ASSERT(((uintptr_t) md.arr.base.buffer & 63) == 0, "Objects are 64 byte aligned");
+    size_t capacity = dynarray_capacity(mapped_dynarray_base(&md));
+    TEST_ASSERT(mapped_dynarray_close(&md) == 0, "Closed");
+
+    TEST_ASSERT(mapped_dynarray_open(&md, path, sizeof(uint64_t), 1, 0) == 0, "Reopened");
+    TEST_ASSERT(check_values(&md, COUNT), "Objects survived reopening");
+    TEST_ASSERT(dynarray_capacity(mapped_dynarray_base(&md)) == capacity, "Capacity kept from the file");
+    uint64_t square = 99 * 99;
+    TEST_ASSERT(array_find((struct array *) mapped_dynarray_base(&md), ARRAY_U64, &square) == 99,
+                "Array functions work on the view");
+    dynarray_delete(mapped_dynarray_base(&md), COUNT / 2, COUNT);
+    dynarray_shrink_to_fit(mapped_dynarray_base(&md));
+    TEST_ASSERT(mapped_dynarray_file_size(&md) == sizeof(struct mapped_dynarray_header) + COUNT / 2 * sizeof(uint64_t),
+                "Shrinking shrinks the file");
+    TEST_ASSERT(mapped_dynarray_sync(&md) == 0, "Synced");
+    mapped_dynarray_close(&md);
+
+    TEST_ASSERT(mapped_dynarray_open(&md, path, sizeof(uint64_t), 1, 0) == 0 && check_values(&md, COUNT / 2),
+                "Shrunk array reopened");
+    mapped_dynarray_close(&md);
+}
+
+static void test_invalid(void)
+{
+    TEST_SECTION("Invalid Files");
+    struct mapped_dynarray md;
+    TEST_ASSERT(mapped_dynarray_open(&md, path, sizeof(uint32_t), 1, 0) != 0, "Object size mismatch rejected");
+    FILE *f = fopen(path, "r+b");
+    fwrite("garbage", 1, 7, f);
+    fclose(f);
+    TEST_ASSERT(mapped_dynarray_open(&md, path, sizeof(uint64_t), 1, 0) != 0, "Bad magic rejected");
+    TEST_ASSERT(mapped_dynarray_open(&md, path, sizeof(uint32_t), 8, MAPPED_DYNARRAY_TRUNCATE) == 0,
+                "Truncate overwrites any file");
+    TEST_ASSERT(mapped_dynarray_size(&md) == 0, "Truncated file is empty");
+    TEST_ASSERT(mapped_dynarray_file_size(&md) == sizeof(struct mapped_dynarray_header) + 8 * sizeof(uint32_t),
+                "Truncated file sized for the capacity");
+    mapped_dynarray_close(&md);
+    TEST_ASSERT(mapped_dynarray_open(&md, "/nonexistent/dir/file", sizeof(uint64_t), 1, 0) != 0,
+                "Unopenable path rejected");
+}
+
+/*───────────────────────────────────────────────
+ * Main Test Runner
+ *───────────────────────────────────────────────*/
+int main(void)
+{
+    printf("\n=== MAPPED DYNARRAY TEST SUITE ===\n");
+
+    int fd = mkstemp(path);
+    assert(fd >= 0);
+    close(fd);
+    test_persist();
+    test_invalid();
+    unlink(path);
+
+    printf("\nPassed: %d, Failed: %d\n", tests_passed, tests_failed);
+    return tests_failed > 0 ? 1 : 0;
+}
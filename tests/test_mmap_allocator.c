@@ -0,0 +1,165 @@
+#include <ds/utils/mmap_allocator.h>
+#include <ds/arrays/dynarray.h>
+#include <ds/hashs/hash_table.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <assert.h>
+
+/*───────────────────────────────────────────────
+ * Test Statistics & Utilities
+ *───────────────────────────────────────────────*/
+static int tests_passed = 0;
+static int tests_failed = 0;
+
+#define TEST_ASSERT(condition, message) do { \
+    if (condition) { \
+        printf("  ✓ %s\n", message); \
+        tests_passed++; \
+    } else { \
+        printf("  ✗ FAILED: %s\n", message); \
+        tests_failed++; \
+    } \
+} while(0)
+
+#define TEST_SECTION(name) printf("\n=== %s ===\n", name)
+
+#define SMALL_THRESHOLD (64 * 1024)
+
+static int u64_init(void *object, void *args)
+{
+    memcpy(object, args, sizeof(uint64_t));
+    return 0;
+}
+
+static size_t u64_hash(const void *key, size_t capacity, size_t attempts)
+{
+    uint64_t x = *(const uint64_t *) key * 0x9E3779B97F4A7C15ull;
+    // Capacity is prime, any step in [1, capacity) visits every bucket
+    size_t step = 1 + (size_t) (x >> 41) % (capacity - 1);
+    return (size_t) ((x >> 17) % capacity + attempts * step) % capacity;
+}
+
+static int u64_cmp(const void *a, const void *b)
+{
+    uint64_t x = *(const uint64_t *) a, y = *(const uint64_t *) b;
+    return (x > y) - (x < y);
+}
+
+static int check_pattern(const uint64_t *buffer, size_t count)
+{
+    for (size_t i = 0; i < count; i++) {
+        if (buffer[i] != i * 7)
+            return 0;
+    }
+    return 1;
+}
+
+/*───────────────────────────────────────────────
+ * Test Cases
+ *───────────────────────────────────────────────*/
+
+static void test_threshold(void)
+{
+    TEST_SECTION("Threshold");
+    struct mmap_allocator ma;
+    mmap_allocator_init(&ma, SMALL_THRESHOLD, 0);
+    void *small = mmap_alloc_sized(&ma, 128, 16);
+    TEST_ASSERT(small != NULL && ma.mapped_bytes == 0, "Small buffer served by malloc");
+    void *big = mmap_alloc_sized(&ma, SMALL_THRESHOLD + 1, 64);
+    TEST_ASSERT(big != NULL && ma.mapped_bytes >= SMALL_THRESHOLD + 1, "Big buffer mapped");
+    TEST_ASSERT(((uintptr_t) big % 64) == 0, "Mapped buffer aligned");
+    mmap_free_sized(&ma, small, 128);
+    mmap_free_sized(&ma, big, SMALL_THRESHOLD + 1);
+    TEST_ASSERT(ma.mapped_bytes == 0, "Every mapping released");
+}
+
+static void test_realloc(void)
+{
+    TEST_SECTION("Reallocation");
+    struct mmap_allocator ma;
+    mmap_allocator_init(&ma, SMALL_THRESHOLD, 0);
+    size_t count = 1024;
+    uint64_t *buffer = mmap_alloc_sized(&ma, count * sizeof(uint64_t), 8);
+    for (size_t i = 0; i < count; i++)
+        buffer[i] = i * 7;
+    // Crosses the threshold, then keeps growing thru mremap
+    for (int step = 0; step < 6; step++) {
+        size_t new_count = count * 4;
+        buffer = mmap_realloc_sized(&ma, buffer, count * sizeof(uint64_t), new_count * sizeof(uint64_t), 8);
+        if (!buffer)
+            break;
+        for (size_t i = count; i < new_count; i++)
+            buffer[i] = i * 7;
+        count = new_count;
+    }
+    TEST_ASSERT(buffer != NULL && check_pattern(buffer, count), "Contents preserved while growing");
+    size_t shrunk = 100;
+    buffer = mmap_realloc_sized(&ma, buffer, count * sizeof(uint64_t), shrunk * sizeof(uint64_t), 8);
+    TEST_ASSERT(buffer != NULL && check_pattern(buffer, shrunk), "Contents preserved while shrinking below threshold");
+    TEST_ASSERT(ma.mapped_bytes == 0, "Shrunk buffer left the mapping");
+    mmap_free_sized(&ma, buffer, shrunk * sizeof(uint64_t));
+}
+
+static void test_hugepage_dynarray(void)
+{
+    TEST_SECTION("Huge Page Dynarray");
+    struct mmap_allocator ma;
+    mmap_allocator_init(&ma, SMALL_THRESHOLD, MMAP_ALLOCATOR_HUGEPAGES);
+    struct sized_allocator_concept sac = mmap_allocator_concept(&ma);
+    struct object_concept oc = { .init = u64_init, .deinit = NULL };
+    struct dynarray arr;
+    TEST_ASSERT(dynarray_init_with(&arr, 4, sizeof(uint64_t), oc, &sac) == 0, "Dynarray initialized");
+    int ok = 1;
+    for (uint64_t i = 0; i < 500000 && ok; i++) {
+        uint64_t value = i * 7;
+        ok = (dynarray_push_back(&arr, &value) == 0);
+    }
+    TEST_ASSERT(ok && check_pattern(dynarray_iterator_begin(&arr), dynarray_size(&arr)), "Pushed half a million elements");
+    TEST_ASSERT(((uintptr_t) dynarray_iterator_begin(&arr) % MMAP_ALLOCATOR_HUGEPAGE_SIZE) == 0, "Grown buffer stays 2MB aligned");
+    dynarray_deinit(&arr);
+    TEST_ASSERT(ma.mapped_bytes == 0, "Dynarray released its mapping");
+}
+
+static void test_hash_table(void)
+{
+    TEST_SECTION("Hash Table");
+    struct mmap_allocator ma;
+    mmap_allocator_init(&ma, SMALL_THRESHOLD, 0);
+    struct sized_allocator_concept sac = mmap_allocator_concept(&ma);
+    struct hash_concept hc = { .hash = u64_hash, .cmp_key = u64_cmp };
+    struct hash_table *ht = hash_table_create_with(&hc, &sac);
+    enum { COUNT = 20000 };
+    uint64_t *keys = malloc(COUNT * sizeof(uint64_t));
+    for (size_t i = 0; i < COUNT; i++) {
+        keys[i] = i * 7;
+        hash_table_insert(ht, &keys[i], &keys[i]);
+    }
+    TEST_ASSERT(ma.mapped_bytes > 0, "Bucket array moved into a mapping while resizing");
+    int ok = 1;
+    for (size_t i = 0; i < COUNT; i++) {
+        if (hash_table_search(ht, &keys[i]) != &keys[i])
+            ok = 0;
+    }
+    TEST_ASSERT(ok, "Every key found");
+    hash_table_destroy(ht, NULL);
+    TEST_ASSERT(ma.mapped_bytes == 0, "Hash table released its mapping");
+    free(keys);
+}
+
+/*───────────────────────────────────────────────
+ * Main Test Runner
+ *───────────────────────────────────────────────*/
+int main(void)
+{
+    printf("\n=== MMAP ALLOCATOR TEST SUITE ===\n");
+
+    test_threshold();
+    test_realloc();
+    test_hugepage_dynarray();
+    test_hash_table();
+
+    printf("\nPassed: %d, Failed: %d\n", tests_passed, tests_failed);
+    return tests_failed > 0 ? 1 : 0;
+}
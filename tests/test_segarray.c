@@ -0,0 +1,185 @@
+#include <ds/arrays/segarray.h>
+#include <ds/utils/slab_pool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+
+/*───────────────────────────────────────────────
+ * Test Statistics & Utilities
+ *───────────────────────────────────────────────*/
+static int tests_passed = 0;
+static int tests_failed = 0;
+
+#define TEST_ASSERT(condition, message) do { \
+    if (condition) { \
+        printf("  ✓ %s\n", message); \
+        tests_passed++; \
+    } else { \
+        printf("  ✗ FAILED: %s\n", message); \
+        tests_failed++; \
+    } \
+} while(0)
+
+#define TEST_SECTION(name) printf("\n=== %s ===\n", name)
+
+#define CHUNK 8
+
+static int g_live = 0;
+
+static int counted_init(void *object, void *args)
+{
+    memcpy(object, args, sizeof(int));
+    g_live++;
+    return 0;
+}
+
+static void counted_deinit(void *object)
+{
+    (void) object;
+    g_live--;
+}
+
+static void sum_handler(void *data, void *context)
+{
+    *(long *) context += *(int *) data;
+}
+
+static struct syspool g_sp = { CHUNK * sizeof(int) };
+static struct allocator_concept g_ac = { .allocator = &g_sp, .alloc = sysalloc, .free = sysfree };
+
+/*───────────────────────────────────────────────
+ * Test Cases
+ *───────────────────────────────────────────────*/
+
+static void test_both_ends(void)
+{
+    TEST_SECTION("Push & Pop at Both Ends");
+    struct object_concept oc = { .init = NULL, .deinit = NULL };
+    struct segarray sa;
+    TEST_ASSERT(segarray_init(&sa, sizeof(int), CHUNK, oc, &g_ac) == 0, "Initialized");
+    TEST_ASSERT(segarray_init(&sa, sizeof(int), 6, oc, &g_ac) != 0, "Non power of two chunks rejected");
+    segarray_init(&sa, sizeof(int), CHUNK, oc, &g_ac);
+    // Result: -99 ... -1 0 1 ... 99
+    for (int i = 0; i < 100; i++) {
+        int back = i, front = -i - 1;
+        segarray_push_back(&sa, &back);
+        segarray_push_front(&sa, &front);
+    }
+    TEST_ASSERT(segarray_size(&sa) == 200, "Size counts both ends");
+    int ordered = 1;
+    for (size_t i = 0; i < segarray_size(&sa); i++)
+        ordered &= *(int *) segarray_at(&sa, i) == (int) i - 100;
+    TEST_ASSERT(ordered, "Indexing follows insertion order");
+    TEST_ASSERT(*(int *) segarray_front(&sa) == -100 && *(int *) segarray_back(&sa) == 99, "Front and back");
+    int value;
+    segarray_pop_front(&sa, &value);
+    TEST_ASSERT(value == -100, "Pop front relocates the first object");
+    segarray_pop_back(&sa, &value);
+    TEST_ASSERT(value == 99, "Pop back relocates the last object");
+    while (segarray_pop_back(&sa, NULL) == 0)
+        ;
+    TEST_ASSERT(segarray_empty(&sa) && sa.chunk_count == 0, "Empty chunks released");
+    TEST_ASSERT(segarray_pop_front(&sa, NULL) != 0, "Pop of empty fails");
+    segarray_deinit(&sa);
+}
+
+static void test_stable_addresses(void)
+{
+    TEST_SECTION("Stable Addresses");
+    enum { COUNT = 5000 };
+    struct object_concept oc = { .init = NULL, .deinit = NULL };
+    struct segarray sa;
+    segarray_init(&sa, sizeof(int), CHUNK, oc, &g_ac);
+    int **addresses = malloc(COUNT * sizeof(int *));
+    int zero = 0;
+    segarray_push_back(&sa, &zero);
+    addresses[0] = segarray_at(&sa, 0);
+    // Growing at the front shifts indices but never objects
+    for (int i = 1; i < COUNT; i++) {
+        if (i % 2) {
+            segarray_push_front(&sa, &i);
+            addresses[i] = segarray_front(&sa);
+        } else {
+            segarray_push_back(&sa, &i);
+            addresses[i] = segarray_back(&sa);
+        }
+    }
+    int stable = 1;
+    for (int i = 0; i < COUNT; i++)
+        stable &= *addresses[i] == i;
+    TEST_ASSERT(stable, "Pointers survive directory growth");
+    size_t chunks = sa.chunk_count;
+    TEST_ASSERT(chunks * CHUNK >= COUNT && chunks <= COUNT / CHUNK + 2, "Only partial end chunks wasted");
+    TEST_ASSERT(segarray_memory_usage(&sa) >= chunks * CHUNK * sizeof(int), "Memory usage covers chunks");
+    free(addresses);
+    segarray_deinit(&sa);
+}
+
+static void test_spans(void)
+{
+    TEST_SECTION("Spans");
+    struct object_concept oc = { .init = NULL, .deinit = NULL };
+    struct segarray sa;
+    segarray_init(&sa, sizeof(int), CHUNK, oc, &g_ac);
+    long expected = 0;
+    for (int i = 0; i < 77; i++) {
+        segarray_push_front(&sa, &i);
+        expected += i;
+    }
+    size_t spans = 0, visited = 0;
+    int contiguous = 1;
+    for (size_t i = 0; i < segarray_size(&sa); ) {
+        struct array span = segarray_span(&sa, i);
+        for (size_t j = 0; j < array_size(&span); j++)
+            contiguous &= array_at(&span, j) == segarray_at(&sa, i + j);
+        visited += array_size(&span);
+        spans++;
+        i += span.size;
+    }
+    TEST_ASSERT(contiguous && visited == 77, "Spans cover every object in order");
+    TEST_ASSERT(spans <= 77 / CHUNK + 2, "One span per chunk");
+    long sum = 0;
+    segarray_walk(&sa, &sum, sum_handler);
+    TEST_ASSERT(sum == expected, "Walk visits every object");
+    segarray_deinit(&sa);
+}
+
+static void test_lifecycle(void)
+{
+    TEST_SECTION("Object Lifecycle");
+    struct object_concept oc = { .init = counted_init, .deinit = counted_deinit };
+    struct slab_pool pool;
+    slab_pool_init(&pool, segarray_chunk_sizeof(CHUNK, sizeof(int)), 0);
+    struct allocator_concept ac = { .allocator = &pool, .alloc = slab_alloc, .free = slab_free };
+    struct segarray sa;
+    segarray_init(&sa, sizeof(int), CHUNK, oc, &ac);
+    // Queue usage: chunks are recycled thru the pool
+    for (int i = 0; i < 1000; i++) {
+        segarray_push_back(&sa, &i);
+        if (i >= 10)
+            segarray_pop_front(&sa, NULL);
+    }
+    TEST_ASSERT(g_live == 10 && segarray_size(&sa) == 10, "Pops deinit objects");
+    TEST_ASSERT(*(int *) segarray_front(&sa) == 990, "FIFO order kept");
+    TEST_ASSERT(sa.chunk_count <= 3, "Chunks released behind the queue");
+    segarray_deinit(&sa);
+    TEST_ASSERT(g_live == 0, "Deinit destroys remaining objects");
+    slab_pool_deinit(&pool);
+}
+
+/*───────────────────────────────────────────────
+ * Main Test Runner
+ *───────────────────────────────────────────────*/
+int main(void)
+{
+    printf("\n=== SEGARRAY TEST SUITE ===\n");
+
+    test_both_ends();
+    test_stable_addresses();
+    test_spans();
+    test_lifecycle();
+
+    printf("\nPassed: %d, Failed: %d\n", tests_passed, tests_failed);
+    return tests_failed > 0 ? 1 : 0;
+}
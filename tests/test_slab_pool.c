@@ -0,0 +1,134 @@
+#include <ds/utils/slab_pool.h>
+#include <ds/queue/lqueue.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <assert.h>
+
+/*───────────────────────────────────────────────
+ * Test Statistics & Utilities
+ *───────────────────────────────────────────────*/
+static int tests_passed = 0;
+static int tests_failed = 0;
+
+#define TEST_ASSERT(condition, message) do { \
+    if (condition) { \
+        printf("  ✓ %s\n", message); \
+        tests_passed++; \
+    } else { \
+        printf("  ✗ FAILED: %s\n", message); \
+        tests_failed++; \
+    } \
+} while(0)
+
+#define TEST_SECTION(name) printf("\n=== %s ===\n", name)
+
+/*───────────────────────────────────────────────
+ * Test Cases
+ *───────────────────────────────────────────────*/
+
+static void test_init_deinit(void)
+{
+    TEST_SECTION("Init & Deinit");
+    struct slab_pool sp;
+    TEST_ASSERT(slab_pool_init(&sp, 24, 0) == 0, "Pool initialized with default slab size");
+    TEST_ASSERT(sp.slab_count == 0, "No slab allocated before the first request");
+    TEST_ASSERT(sp.obj_size >= 24 && sp.obj_size % sizeof(void *) == 0, "Object size rounded up");
+    slab_pool_deinit(&sp);
+    TEST_ASSERT(slab_pool_init(&sp, 8 * 1024 * 1024, 4096) != 0, "Object larger than slab rejected");
+}
+
+static void test_alloc_free_reuse(void)
+{
+    TEST_SECTION("Alloc, Free & Reuse");
+    struct slab_pool sp;
+    slab_pool_init(&sp, sizeof(uint64_t) * 4, 4096);
+    void *a = slab_alloc(&sp);
+    void *b = slab_alloc(&sp);
+    TEST_ASSERT(a != NULL && b != NULL && a != b, "Two distinct slots allocated");
+    TEST_ASSERT(((uintptr_t) a % sizeof(void *)) == 0, "Slots are aligned");
+    TEST_ASSERT(sp.slab_count == 1, "Both slots carved from one slab");
+    slab_free(&sp, a);
+    TEST_ASSERT(slab_alloc(&sp) == a, "Freed slot reused first");
+    slab_free(&sp, NULL);
+    TEST_ASSERT(slab_alloc(&sp) != NULL, "Freeing NULL is a no-op");
+    slab_pool_deinit(&sp);
+}
+
+static void test_many_slabs(void)
+{
+    TEST_SECTION("Many Slabs");
+    struct slab_pool sp;
+    slab_pool_init(&sp, 48, 4096);
+    enum { COUNT = 10000 };
+    uint64_t **slots = malloc(COUNT * sizeof(*slots));
+    int ok = 1;
+    for (size_t i = 0; i < COUNT; i++) {
+        slots[i] = slab_alloc(&sp);
+        if (!slots[i]) {
+            ok = 0;
+            break;
+        }
+        memset(slots[i], 0, 48);
+        slots[i][0] = i;
+    }
+    TEST_ASSERT(ok, "All slots allocated");
+    TEST_ASSERT(sp.slab_count > 1, "Pool grew past one slab");
+    for (size_t i = 0; i < COUNT; i++) {
+        if (slots[i][0] != i)
+            ok = 0;
+    }
+    TEST_ASSERT(ok, "Slots do not overlap");
+    size_t slabs = sp.slab_count;
+    for (size_t i = 0; i < COUNT; i++)
+        slab_free(&sp, slots[i]);
+    for (size_t i = 0; i < COUNT; i++)
+        slots[i] = slab_alloc(&sp);
+    TEST_ASSERT(sp.slab_count == slabs, "Reallocation served from free list");
+    free(slots);
+    slab_pool_deinit(&sp);
+    TEST_ASSERT(sp.slab_count == 0 && sp.slabs == NULL, "All slabs released");
+}
+
+static void test_with_lqueue(void)
+{
+    TEST_SECTION("Plugged Into lqueue");
+    struct slab_pool sp;
+    slab_pool_init(&sp, lqueue_node_sizeof(), 0);
+    struct allocator_concept ac = { .allocator = &sp, .alloc = slab_alloc, .free = slab_free };
+    struct lqueue *lq = lqueue_create(&ac);
+    int values[1000];
+    for (int round = 0; round < 3; round++) {
+        for (int i = 0; i < 1000; i++) {
+            values[i] = i;
+            lenqueue(lq, &values[i]);
+        }
+        int ok = 1;
+        for (int i = 0; i < 1000; i++) {
+            int *v = ldequeue(lq);
+            if (!v || *v != i)
+                ok = 0;
+        }
+        TEST_ASSERT(ok, "FIFO order preserved with pooled nodes");
+    }
+    TEST_ASSERT(sp.slab_count == 1, "Queue churn reused the same slab");
+    lqueue_destroy(lq, NULL);
+    slab_pool_deinit(&sp);
+}
+
+/*───────────────────────────────────────────────
+ * Main Test Runner
+ *───────────────────────────────────────────────*/
+int main(void)
+{
+    printf("\n=== SLAB POOL TEST SUITE ===\n");
+
+    test_init_deinit();
+    test_alloc_free_reuse();
+    test_many_slabs();
+    test_with_lqueue();
+
+    printf("\nPassed: %d, Failed: %d\n", tests_passed, tests_failed);
+    return tests_failed > 0 ? 1 : 0;
+}
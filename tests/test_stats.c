@@ -0,0 +1,217 @@
+#include <ds/utils/stats.h>
+#include <ds/hashs/hash_table.h>
+#include <ds/trees/avl.h>
+#include <ds/trees/Btree.h>
+#include <ds/trees/trie.h>
+#include <ds/arrays/dynarray.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+
+/*───────────────────────────────────────────────
+ * Test Statistics & Utilities
+ *───────────────────────────────────────────────*/
+static int tests_passed = 0;
+static int tests_failed = 0;
+
+#define TEST_ASSERT(condition, message) do { \
+    if (condition) { \
+        printf("  ✓ %s\n", message); \
+        tests_passed++; \
+    } else { \
+        printf("  ✗ FAILED: %s\n", message); \
+        tests_failed++; \
+    } \
+} while(0)
+
+#define TEST_SECTION(name) printf("\n=== %s ===\n", name)
+
+#ifdef DS_STATS
+
+struct int_node {
+    struct avl_node node;  // Intrusive AVL node MUST be first
+    int key;
+};
+
+static int node_cmp(const struct bintree *a, const struct bintree *b)
+{
+    int x = ((const struct int_node *) a)->key, y = ((const struct int_node *) b)->key;
+    return (x > y) - (x < y);
+}
+
+static int int_cmp(const void *key, const void *data)
+{
+    int a = *(const int *) key, b = *(const int *) data;
+    return (a > b) - (a < b);
+}
+
+static int int_init(void *object, void *args)
+{
+    memcpy(object, args, sizeof(int));
+    return 0;
+}
+
+// Folds keys into 97 home slots to force collisions
+static size_t int_hash(const void *key, size_t capacity, size_t attempts)
+{
+    size_t x = (size_t) *(const int *) key;
+    return (x % 97 + attempts) % capacity;
+}
+
+static size_t ascii_mapper(unsigned char c) { return (size_t) c; }
+static unsigned char ascii_unmapper(size_t i) { return (unsigned char) i; }
+
+static size_t probe_total(const struct hash_table_stats *stats)
+{
+    size_t total = 0;
+    for (size_t i = 0; i < HASH_TABLE_PROBE_BUCKETS; i++)
+        total += stats->probes[i];
+    return total;
+}
+
+/*───────────────────────────────────────────────
+ * Test Cases
+ *───────────────────────────────────────────────*/
+
+static void test_hash_table(void)
+{
+    TEST_SECTION("Hash Table Probes");
+    enum { COUNT = 500 };
+    struct hash_concept hc = { .hash = int_hash, .cmp_key = int_cmp };
+    struct hash_table *ht = hash_table_create(&hc);
+    int *keys = malloc(COUNT * sizeof(int));
+    TEST_ASSERT(probe_total(hash_table_get_stats(ht)) == 0, "Counters start zeroed");
+    for (int i = 0; i < COUNT; i++) {
+        keys[i] = i * 7;
+        hash_table_insert(ht, &keys[i], &keys[i]);
+    }
+    const struct hash_table_stats *stats = hash_table_get_stats(ht);
+    TEST_ASSERT(probe_total(stats) == COUNT, "Every insert recorded once");
+    TEST_ASSERT(stats->resizes > 0, "Growth counted as resizes");
+    hash_table_reset_stats(ht);
+    int missing = -1;
+    for (int i = 0; i < COUNT; i++)
+        hash_table_search(ht, &keys[i]);
+    hash_table_search(ht, &missing);
+    TEST_ASSERT(probe_total(stats) == COUNT + 1, "Hits and misses recorded");
+    TEST_ASSERT(stats->probes[0] > 0 && stats->probes[HASH_TABLE_PROBE_BUCKETS - 1] > 0, "Collisions spread over the histogram");
+    hash_table_destroy(ht, NULL);
+    free(keys);
+}
+
+static void test_avl(void)
+{
+    TEST_SECTION("AVL Rotations");
+    enum { COUNT = 1024 };
+    struct int_node *nodes = malloc(COUNT * sizeof(*nodes));
+    struct avl tree;
+    avl_init(&tree, node_cmp);
+    for (int i = 0; i < COUNT; i++) {
+        nodes[i].key = i;
+        avl_add(&tree, &nodes[i].node);
+    }
+    // Ascending keys only ever make the right side heavy
+    TEST_ASSERT(tree.stats.rotations_left > 0 && tree.stats.rotations_right == 0, "Ascending inserts rotate left only");
+    avl_init(&tree, node_cmp);
+    for (int i = COUNT - 1; i >= 0; i--)
+        avl_add(&tree, &nodes[i].node);
+    TEST_ASSERT(tree.stats.rotations_right > 0 && tree.stats.rotations_left == 0, "Descending inserts rotate right only");
+    free(nodes);
+}
+
+static void test_Btree(void)
+{
+    TEST_SECTION("B-tree Splits & Merges");
+    enum { ORDER = 5, COUNT = 3000 };
+    struct syspool sp = { Btree_node_sizeof(ORDER) };
+    struct allocator_concept ac = { .allocator = &sp, .alloc = sysalloc, .free = sysfree };
+    struct Btree tree;
+    Btree_init(&tree, ORDER, int_cmp, &ac);
+    int *values = malloc(COUNT * sizeof(int));
+    for (int i = 0; i < COUNT; i++) {
+        values[i] = i;
+        Btree_add(&tree, &values[i]);
+    }
+    // Every node but the first root comes from a split or a root growth
+    TEST_ASSERT(tree.stats.splits > 0 && tree.stats.splits < Btree_node_count(&tree), "Splits counted");
+    TEST_ASSERT(tree.stats.merges == 0, "No merges while inserting");
+    for (int i = 0; i < COUNT; i += 2)
+        Btree_remove(&tree, &values[i]);
+    TEST_ASSERT(tree.stats.merges > 0, "Merges counted");
+    TEST_ASSERT(tree.stats.borrows_left + tree.stats.borrows_right > 0, "Borrows counted");
+    Btree_deinit(&tree, NULL);
+    free(values);
+}
+
+static void test_trie(void)
+{
+    TEST_SECTION("Trie Node Allocations");
+    struct syspool sp = { trie_node_sizeof(128) };
+    struct allocator_concept ac = { .allocator = &sp, .alloc = sysalloc, .free = sysfree };
+    struct trie tr;
+    trie_init(&tr, &ac, 128, ascii_mapper, ascii_unmapper);
+    int value = 1;
+    char key[16];
+    for (int i = 0; i < 200; i++) {
+        snprintf(key, sizeof(key), "key%d", i);
+        trie_put(&tr, key, &value);
+    }
+    TEST_ASSERT(tr.stats.node_allocs == trie_node_count(&tr), "Allocations match live nodes");
+    trie_deinit(&tr, NULL);
+}
+
+static void test_dynarray(void)
+{
+    TEST_SECTION("Dynarray Reallocations");
+    struct object_concept oc = { .init = int_init, .deinit = NULL };
+    struct dynarray arr;
+    dynarray_init(&arr, 1, sizeof(int), oc);
+    size_t capacity_changes = 0, capacity = dynarray_capacity(&arr);
+    for (int i = 0; i < 1000; i++) {
+        dynarray_push_back(&arr, &i);
+        if (dynarray_capacity(&arr) != capacity) {
+            capacity = dynarray_capacity(&arr);
+            capacity_changes++;
+        }
+    }
+    TEST_ASSERT(arr.stats.reallocs == capacity_changes, "Every growth counted");
+    dynarray_shrink_to_fit(&arr);
+    TEST_ASSERT(arr.stats.reallocs == capacity_changes + 1, "Shrink counted");
+    dynarray_deinit(&arr);
+}
+
+#else
+
+static void test_disabled(void)
+{
+    TEST_SECTION("Disabled Instrumentation");
+    size_t counter = 0;
+    DS_STATS_INC(counter);
+    TEST_ASSERT(counter == 0, "Increments compile to nothing");
+    struct plain { size_t a; DS_STATS_FIELD(size_t, stats) };
+    TEST_ASSERT(sizeof(struct plain) == sizeof(size_t), "Stats members compile to nothing");
+}
+
+#endif // DS_STATS
+
+/*───────────────────────────────────────────────
+ * Main Test Runner
+ *───────────────────────────────────────────────*/
+int main(void)
+{
+    printf("\n=== EVENT COUNTERS TEST SUITE ===\n");
+
+#ifdef DS_STATS
+    test_hash_table();
+    test_avl();
+    test_Btree();
+    test_trie();
+    test_dynarray();
+#else
+    test_disabled();
+#endif // DS_STATS
+
+    printf("\nPassed: %d, Failed: %d\n", tests_passed, tests_failed);
+    return tests_failed > 0 ? 1 : 0;
+}
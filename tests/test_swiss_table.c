@@ -0,0 +1,200 @@
+#include <ds/hashs/swiss_table.h>
+#include <ds/hashs/hash_table.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <assert.h>
+#include <stdbool.h>
+
+/*───────────────────────────────────────────────
+ * Test Statistics & Utilities
+ *───────────────────────────────────────────────*/
+static int tests_passed = 0;
+static int tests_failed = 0;
+
+#define TEST_ASSERT(condition, message) do { \
+    if (condition) { \
+        printf("  ✓ %s\n", message); \
+        tests_passed++; \
+    } else { \
+        printf("  ✗ FAILED: %s\n", message); \
+        tests_failed++; \
+    } \
+} while(0)
+
+#define TEST_SECTION(name) printf("\n=== %s ===\n", name)
+
+static int string_cmp(const void* a, const void* b)
+{
+    return strcmp((const char*) a, (const char*) b);
+}
+
+static int u64_cmp(const void* a, const void* b)
+{
+    return *(const uint64_t*) a != *(const uint64_t*) b;
+}
+
+// Every key lands in group 0 with the same control byte, so every probe runs into collisions
+static uint64_t constant_hash(const void* key)
+{
+    (void) key;
+    return 0;
+}
+
+static void count_pairs(void* key, void* value, void* context)
+{
+    (void) key;
+    (void) value;
+    (*(int*) context)++;
+}
+
+static void free_pair(void* object)
+{
+    free(object);
+}
+
+/*───────────────────────────────────────────────
+ * Tests
+ *───────────────────────────────────────────────*/
+static void test_basic(void)
+{
+    TEST_SECTION("Insert, Search & Remove");
+    struct hash_concept hc = { .cmp_key = string_cmp, .hash64 = hash64_string };
+    struct swiss_table* st = swiss_table_create(&hc, NULL);
+    TEST_ASSERT(st != NULL && swiss_table_size(st) == 0, "Empty table created");
+    TEST_ASSERT(swiss_table_capacity(st) % SWISS_TABLE_GROUP == 0, "Capacity is made of whole groups");
+
+    int values[3] = { 1, 2, 3 };
+    swiss_table_insert(st, "alpha", &values[0]);
+    swiss_table_insert(st, "beta", &values[1]);
+    TEST_ASSERT(swiss_table_search(st, "alpha") == &values[0], "Inserted key found");
+    TEST_ASSERT(swiss_table_search(st, "gamma") == NULL, "Missing key not found");
+
+    swiss_table_insert(st, "alpha", &values[2]);
+    TEST_ASSERT(swiss_table_size(st) == 2 && swiss_table_search(st, "alpha") == &values[2], "Existing key replaced");
+
+    TEST_ASSERT(swiss_table_remove(st, "alpha") == 0, "Remove succeeds");
+    TEST_ASSERT(swiss_table_remove(st, "alpha") != 0, "Second remove fails");
+    TEST_ASSERT(swiss_table_search(st, "alpha") == NULL && swiss_table_size(st) == 1, "Removed key gone");
+
+    struct hash_concept no_hash64 = { .cmp_key = string_cmp };
+    TEST_ASSERT(swiss_table_create(&no_hash64, NULL) == NULL, "Table without hash64 rejected");
+    swiss_table_destroy(st, NULL);
+}
+
+static void test_churn(void)
+{
+    TEST_SECTION("Growth, Shrink & Churn");
+    struct hash_concept hc = { .cmp_key = u64_cmp, .hash64 = hash64_u64 };
+    struct swiss_table* st = swiss_table_create(&hc, NULL);
+
+    const size_t COUNT = 20000;
+    uint64_t* keys = malloc(COUNT * sizeof(*keys));
+    bool* present = calloc(COUNT, sizeof(*present));
+    for (size_t i = 0; i < COUNT; i++)
+        keys[i] = i * 0x10000;   // same low bits
+    for (size_t i = 0; i < COUNT; i++)
+        swiss_table_insert(st, &keys[i], &keys[i]);
+    TEST_ASSERT(swiss_table_size(st) == COUNT, "All keys inserted");
+    TEST_ASSERT(swiss_table_size(st) <= swiss_table_capacity(st) * 7 / 8, "Load stays below 7/8");
+
+    // Random inserts and removes, checked against a presence array
+    for (size_t i = 0; i < COUNT; i++)
+        present[i] = true;
+    srand(7);
+    size_t live = COUNT;
+    for (int round = 0; round < 200000; round++) {
+        size_t i = (size_t) rand() % COUNT;
+        if (present[i]) {
+            swiss_table_remove(st, &keys[i]);
+            live--;
+        } else {
+            swiss_table_insert(st, &keys[i], &keys[i]);
+            live++;
+        }
+        present[i] = !present[i];
+    }
+    bool consistent = (swiss_table_size(st) == live);
+    for (size_t i = 0; i < COUNT; i++)
+        consistent &= (swiss_table_search(st, &keys[i]) == (present[i] ? &keys[i] : NULL));
+    TEST_ASSERT(consistent, "Table matches the reference after churn");
+
+    size_t grown = swiss_table_capacity(st);
+    for (size_t i = 0; i < COUNT; i++) {
+        if (present[i])
+            swiss_table_remove(st, &keys[i]);
+    }
+    TEST_ASSERT(swiss_table_size(st) == 0 && swiss_table_capacity(st) < grown, "Table shrinks as it empties");
+
+    swiss_table_destroy(st, NULL);
+    free(present);
+    free(keys);
+}
+
+static void test_collisions(void)
+{
+    TEST_SECTION("Full Hash Collisions");
+    struct hash_concept hc = { .cmp_key = u64_cmp, .hash64 = constant_hash };
+    struct swiss_table* st = swiss_table_create(&hc, NULL);
+    uint64_t keys[200];
+    for (int i = 0; i < 200; i++) {
+        keys[i] = (uint64_t) i;
+        swiss_table_insert(st, &keys[i], &keys[i]);
+    }
+    for (int i = 0; i < 200; i += 2)
+        swiss_table_remove(st, &keys[i]);
+    bool ok = true;
+    for (int i = 0; i < 200; i++)
+        ok &= (swiss_table_search(st, &keys[i]) == ((i % 2) ? &keys[i] : NULL));
+    TEST_ASSERT(ok && swiss_table_size(st) == 100, "Colliding keys probe past each other and tombstones");
+
+    int count = 0;
+    swiss_table_walk(st, &count, count_pairs);
+    TEST_ASSERT(count == 100, "Walk visits every pair");
+    swiss_table_destroy(st, NULL);
+}
+
+static void test_hash_table_engine(void)
+{
+    TEST_SECTION("hash_table Engine");
+    struct hash_concept hc = { .cmp_key = string_cmp, .hash64 = hash64_string };
+    struct hash_table_config config = { .engine = HASH_TABLE_ENGINE_SWISS };
+    struct hash_table* ht = hash_table_create_config(&hc, NULL, &config);
+    TEST_ASSERT(ht != NULL, "hash_table created on the swiss engine");
+
+    for (int i = 0; i < 1000; i++) {
+        char* key = malloc(16);
+        char* value = malloc(16);
+        snprintf(key, 16, "key%d", i);
+        snprintf(value, 16, "value%d", i);
+        hash_table_insert(ht, key, value);
+    }
+    const char* found = hash_table_search(ht, "key512");
+    TEST_ASSERT(found != NULL && strcmp(found, "value512") == 0, "hash_table_search forwards");
+    TEST_ASSERT(hash_table_size(ht) == 1000 && hash_table_capacity(ht) >= 1000, "Properties forward");
+
+    int count = 0;
+    hash_table_walk(ht, &count, count_pairs);
+    TEST_ASSERT(count == 1000, "hash_table_walk forwards");
+
+    // Pairs are released by destroy
+    struct object_concept oc = { .init = NULL, .deinit = free_pair };
+    hash_table_destroy(ht, &oc);
+}
+
+/*───────────────────────────────────────────────
+ * Main Test Runner
+ *───────────────────────────────────────────────*/
+int main(void)
+{
+    printf("\n=== SWISS TABLE TEST SUITE ===\n");
+
+    test_basic();
+    test_churn();
+    test_collisions();
+    test_hash_table_engine();
+
+    printf("\nPassed: %d, Failed: %d\n", tests_passed, tests_failed);
+    return tests_failed > 0 ? 1 : 0;
+}
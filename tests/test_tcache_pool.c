@@ -0,0 +1,149 @@
+#include <ds/utils/tcache_pool.h>
+#include <ds/stack/lstack.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <pthread.h>
+#include <assert.h>
+
+/*───────────────────────────────────────────────
+ * Test Statistics & Utilities
+ *───────────────────────────────────────────────*/
+static int tests_passed = 0;
+static int tests_failed = 0;
+
+#define TEST_ASSERT(condition, message) do { \
+    if (condition) { \
+        printf("  ✓ %s\n", message); \
+        tests_passed++; \
+    } else { \
+        printf("  ✗ FAILED: %s\n", message); \
+        tests_failed++; \
+    } \
+} while(0)
+
+#define TEST_SECTION(name) printf("\n=== %s ===\n", name)
+
+#define THREAD_COUNT 4
+#define ROUNDS 200
+#define ITEMS 500
+
+struct worker_args {
+    struct tcache_pool      *pool;
+    int                     ok;
+};
+
+static void *lstack_worker(void *arg)
+{
+    struct worker_args *wa = arg;
+    struct allocator_concept ac = { .allocator = wa->pool, .alloc = tcache_alloc, .free = tcache_free };
+    struct lstack *ls = lstack_create(&ac);
+    static int values[ITEMS];
+    wa->ok = (ls != NULL);
+    for (int round = 0; round < ROUNDS && wa->ok; round++) {
+        for (int i = 0; i < ITEMS; i++) {
+            if (lpush(ls, &values[i]) != 0)
+                wa->ok = 0;
+        }
+        for (int i = ITEMS - 1; i >= 0; i--) {
+            if (lpop(ls) != &values[i])
+                wa->ok = 0;
+        }
+    }
+    lstack_destroy(ls, NULL);
+    return NULL;
+}
+
+struct handoff_args {
+    struct tcache_pool      *pool;
+    void                    **slots;
+    size_t                  count;
+};
+
+static void *free_worker(void *arg)
+{
+    struct handoff_args *ha = arg;
+    for (size_t i = 0; i < ha->count; i++)
+        tcache_free(ha->pool, ha->slots[i]);
+    return NULL;
+}
+
+/*───────────────────────────────────────────────
+ * Test Cases
+ *───────────────────────────────────────────────*/
+
+static void test_single_thread(void)
+{
+    TEST_SECTION("Single Thread");
+    struct tcache_pool tp;
+    TEST_ASSERT(tcache_pool_init(&tp, 32, 0) == 0, "Pool initialized");
+    void *a = tcache_alloc(&tp);
+    void *b = tcache_alloc(&tp);
+    TEST_ASSERT(a != NULL && b != NULL && a != b, "Distinct slots allocated");
+    tcache_free(&tp, b);
+    TEST_ASSERT(tcache_alloc(&tp) == b, "Magazine returns the hottest slot");
+    void *slots[TCACHE_MAGAZINE_SIZE * 4];
+    for (size_t i = 0; i < sizeof(slots) / sizeof(slots[0]); i++)
+        slots[i] = tcache_alloc(&tp);
+    for (size_t i = 0; i < sizeof(slots) / sizeof(slots[0]); i++)
+        tcache_free(&tp, slots[i]);
+    TEST_ASSERT(tp.depot.free_list != NULL, "Full magazine flushed into the depot");
+    tcache_pool_deinit(&tp);
+}
+
+static void test_concurrent_lstacks(void)
+{
+    TEST_SECTION("Concurrent lstacks");
+    struct tcache_pool tp;
+    tcache_pool_init(&tp, lstack_node_sizeof(), 0);
+    pthread_t threads[THREAD_COUNT];
+    struct worker_args args[THREAD_COUNT];
+    for (int i = 0; i < THREAD_COUNT; i++) {
+        args[i].pool = &tp;
+        pthread_create(&threads[i], NULL, lstack_worker, &args[i]);
+    }
+    int ok = 1;
+    for (int i = 0; i < THREAD_COUNT; i++) {
+        pthread_join(threads[i], NULL);
+        ok &= args[i].ok;
+    }
+    TEST_ASSERT(ok, "Every thread kept its stack consistent");
+    TEST_ASSERT(tp.caches == NULL, "Exited threads released their magazines");
+    tcache_pool_deinit(&tp);
+}
+
+static void test_cross_thread_free(void)
+{
+    TEST_SECTION("Cross Thread Free");
+    struct tcache_pool tp;
+    tcache_pool_init(&tp, 64, 0);
+    enum { COUNT = 1000 };
+    void **slots = malloc(COUNT * sizeof(void *));
+    for (size_t i = 0; i < COUNT; i++)
+        slots[i] = tcache_alloc(&tp);
+    struct handoff_args ha = { .pool = &tp, .slots = slots, .count = COUNT };
+    pthread_t thread;
+    pthread_create(&thread, NULL, free_worker, &ha);
+    pthread_join(thread, NULL);
+    size_t slabs = tp.depot.slab_count;
+    for (size_t i = 0; i < COUNT; i++)
+        slots[i] = tcache_alloc(&tp);
+    TEST_ASSERT(tp.depot.slab_count == slabs, "Slots freed by another thread are reused");
+    free(slots);
+    tcache_pool_deinit(&tp);
+}
+
+/*───────────────────────────────────────────────
+ * Main Test Runner
+ *───────────────────────────────────────────────*/
+int main(void)
+{
+    printf("\n=== THREAD-CACHING POOL TEST SUITE ===\n");
+
+    test_single_thread();
+    test_concurrent_lstacks();
+    test_cross_thread_free();
+
+    printf("\nPassed: %d, Failed: %d\n", tests_passed, tests_failed);
+    return tests_failed > 0 ? 1 : 0;
+}
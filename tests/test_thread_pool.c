@@ -0,0 +1,181 @@
+#include <ds/utils/thread_pool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include <pthread.h>
+#include <time.h>
+#include <unistd.h>
+
+/*───────────────────────────────────────────────
+ * Test Statistics & Utilities
+ *───────────────────────────────────────────────*/
+static int tests_passed = 0;
+static int tests_failed = 0;
+
+#define TEST_ASSERT(condition, message) do { \
+    if (condition) { \
+        printf("  ✓ %s\n", message); \
+        tests_passed++; \
+    } else { \
+        printf("  ✗ FAILED: %s\n", message); \
+        tests_failed++; \
+    } \
+} while(0)
+
+#define TEST_SECTION(name) printf("\n=== %s ===\n", name)
+
+static struct thread_pool *g_pool;
+
+static void increment(void *arg)
+{
+    __atomic_fetch_add((long *) arg, 1, __ATOMIC_RELAXED);
+}
+
+struct fib {
+    int n;
+    long result;
+};
+
+// Every call forks its subproblems and waits on them from inside a task
+static void fib_task(void *arg)
+{
+    struct fib *f = arg;
+    if (f->n < 2) {
+        f->result = f->n;
+        return;
+    }
+    struct fib left = { f->n - 1, 0 }, right = { f->n - 2, 0 };
+    struct thread_pool_group group;
+    thread_pool_group_init(&group);
+    thread_pool_submit(g_pool, &group, fib_task, &left);
+    thread_pool_submit(g_pool, &group, fib_task, &right);
+    thread_pool_wait(g_pool, &group);
+    f->result = left.result + right.result;
+}
+
+struct tid_record {
+    pthread_t ids[64];
+    int count;
+    pthread_mutex_t lock;
+};
+
+static void record_thread(void *arg)
+{
+    struct tid_record *rec = arg;
+    // Keep the task busy so other threads get a chance to steal
+    volatile long spin = 0;
+    for (long i = 0; i < 200000; i++)
+        spin += i;
+    pthread_mutex_lock(&rec->lock);
+    pthread_t self = pthread_self();
+    int seen = 0;
+    for (int i = 0; i < rec->count; i++)
+        seen |= pthread_equal(rec->ids[i], self);
+    if (!seen && rec->count < 64)
+        rec->ids[rec->count++] = self;
+    pthread_mutex_unlock(&rec->lock);
+}
+
+static void sleep_task(void *arg)
+{
+    __atomic_store_n((int *) arg, 1, __ATOMIC_RELEASE);
+    usleep(300000);
+}
+
+/*───────────────────────────────────────────────
+ * Test Cases
+ *───────────────────────────────────────────────*/
+
+static void test_many_tasks(void)
+{
+    TEST_SECTION("Many Tasks");
+    long counter = 0;
+    struct thread_pool_group group;
+    thread_pool_group_init(&group);
+    for (int i = 0; i < 100000; i++)
+        thread_pool_submit(g_pool, &group, increment, &counter);
+    thread_pool_wait(g_pool, &group);
+    TEST_ASSERT(counter == 100000, "Every task ran once");
+    TEST_ASSERT(group.pending == 0, "Group drained");
+}
+
+static void test_nested(void)
+{
+    TEST_SECTION("Nested Fork-Join");
+    struct fib f = { 20, 0 };
+    struct thread_pool_group group;
+    thread_pool_group_init(&group);
+    thread_pool_submit(g_pool, &group, fib_task, &f);
+    thread_pool_wait(g_pool, &group);
+    TEST_ASSERT(f.result == 6765, "Tasks waiting on subtasks do not deadlock");
+}
+
+static void test_spread(void)
+{
+    TEST_SECTION("Work Spread");
+    struct tid_record rec = { .count = 0 };
+    pthread_mutex_init(&rec.lock, NULL);
+    struct thread_pool_group group;
+    thread_pool_group_init(&group);
+    for (int i = 0; i < 64; i++)
+        thread_pool_submit(g_pool, &group, record_thread, &rec);
+    thread_pool_wait(g_pool, &group);
+    TEST_ASSERT(rec.count >= 2, "Tasks ran on several threads");
+    pthread_mutex_destroy(&rec.lock);
+}
+
+static void test_blocking_wait(void)
+{
+    TEST_SECTION("Blocking Wait");
+    int started = 0;
+    struct thread_pool_group group;
+    thread_pool_group_init(&group);
+    thread_pool_submit(g_pool, &group, sleep_task, &started);
+    // Wait from outside only once a worker runs the task, so there is nothing to steal
+    while (!__atomic_load_n(&started, __ATOMIC_ACQUIRE))
+        usleep(1000);
+    // Process CPU time, a spinning waiter would burn about the whole sleep
+    clock_t start = clock();
+    thread_pool_wait(g_pool, &group);
+    double cpu = (double) (clock() - start) / CLOCKS_PER_SEC;
+    TEST_ASSERT(group.pending == 0, "Waiter returns after a long task");
+    TEST_ASSERT(cpu < 0.1, "Waiter sleeps instead of spinning");
+}
+
+static void test_lifecycle(void)
+{
+    TEST_SECTION("Lifecycle");
+    struct thread_pool *pool = thread_pool_create(0);
+    TEST_ASSERT(pool != NULL && thread_pool_size(pool) >= 1, "Default size follows online CPUs");
+    thread_pool_destroy(pool);
+    pool = thread_pool_create(1);
+    long counter = 0;
+    struct thread_pool_group group;
+    thread_pool_group_init(&group);
+    for (int i = 0; i < 1000; i++)
+        thread_pool_submit(pool, &group, increment, &counter);
+    thread_pool_wait(pool, &group);
+    TEST_ASSERT(counter == 1000, "Single worker pool drains");
+    thread_pool_destroy(pool);
+}
+
+/*───────────────────────────────────────────────
+ * Main Test Runner
+ *───────────────────────────────────────────────*/
+int main(void)
+{
+    printf("\n=== THREAD POOL TEST SUITE ===\n");
+
+    g_pool = thread_pool_create(4);
+    assert(g_pool != NULL);
+    test_many_tasks();
+    test_nested();
+    test_spread();
+    test_blocking_wait();
+    thread_pool_destroy(g_pool);
+    test_lifecycle();
+
+    printf("\nPassed: %d, Failed: %d\n", tests_passed, tests_failed);
+    return tests_failed > 0 ? 1 : 0;
+}